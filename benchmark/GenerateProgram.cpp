@@ -0,0 +1,284 @@
+/*
+ * GenerateProgram.cpp
+ * Author: Joshua Cao
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+/*
+ * writes a synthetic program to stdout for compile time benchmarks
+ *
+ * every function has the same shape: blocks of straight line code where
+ * `pressure` values are live at once, alternating with statement nests of
+ * `depth` levels. even levels are while loops, odd levels are ifs, and the
+ * innermost level reads and writes the arrays. loops only assign their
+ * counter and the accumulator s, so the number of loop carried phis stays
+ * at depth / 2 + 1 no matter how large the program is
+ *
+ * the programs are only meant to be compiled. they stay in bounds and
+ * terminate, but calls nest deeply and the output is meaningless
+ */
+
+struct Options
+{
+	int functions = 4;
+	int statements = 40;
+	int depth = 4;
+	int vars = 8;
+	int arrays = 2;
+	int dims = 2;
+	int pressure = 6;
+	unsigned seed = 1;
+};
+
+static Options options;
+static std::mt19937 rng;
+static std::string out;
+
+static int random(int n)
+{
+	return std::uniform_int_distribution<int>(0, n - 1)(rng);
+}
+
+static void line(int indent, std::string s)
+{
+	out += std::string(indent, '\t') + s + '\n';
+}
+
+static std::string var(int i)
+{
+	return "v" + std::to_string(i);
+}
+
+// dimensions are small so loops over them stay short
+static int dimSize(int dim)
+{
+	return 4 + dim % 3;
+}
+
+// a[i][j]..., indexed by the innermost loop counters that are in scope
+static std::string arrayAccess(int array, int loops)
+{
+	std::string s = "a" + std::to_string(array);
+	for (int d = 0; d < options.dims; ++d)
+	{
+		int counter = loops - options.dims + d;
+		if (counter >= 0)
+		{
+			s += "[i" + std::to_string(counter) + "]";
+		}
+		else
+		{
+			s += "[" + std::to_string(random(dimSize(d))) + "]";
+		}
+	}
+	return s;
+}
+
+static std::string operand(int loops)
+{
+	switch (random(4))
+	{
+	case 0:
+		return std::to_string(random(100));
+	case 1:
+		if (loops > 0)
+		{
+			return "i" + std::to_string(random(loops));
+		}
+		return "s";
+	default:
+		return var(random(options.vars));
+	}
+}
+
+static std::string expression(int loops)
+{
+	static const char* ops[] = { " + ", " - ", " * " };
+	std::string s = operand(loops);
+	int terms = 1 + random(3);
+	for (int i = 0; i < terms; ++i)
+	{
+		s += ops[random(3)] + operand(loops);
+	}
+	if (options.arrays > 0)
+	{
+		s += " + " + arrayAccess(random(options.arrays), loops);
+	}
+	return s;
+}
+
+// `pressure` values defined one after another, all used by the last statement
+static int pressureBlock(int indent, int callee)
+{
+	int count = std::min(options.pressure, options.vars);
+	int statements = 0;
+	for (int i = 0; i < count; ++i)
+	{
+		std::string value = i == 0 ? "call InputNum()" : var(i - 1) + " * " + std::to_string(2 + random(7));
+		if (i > 0 && callee >= 0 && random(4) == 0)
+		{
+			value = "call f" + std::to_string(callee) + "(" + var(i - 1) + ", " + operand(0) + ")";
+		}
+		else if (i > 0)
+		{
+			value += " + " + operand(0);
+		}
+		line(indent, "let " + var(i) + " <- " + value + ";");
+		++statements;
+	}
+	std::string sum = "s";
+	for (int i = 0; i < count; ++i)
+	{
+		sum += " + " + var(i);
+	}
+	line(indent, "let s <- " + sum + ";");
+	return statements + 1;
+}
+
+static int nest(int indent, int level, int loops)
+{
+	if (level == options.depth)
+	{
+		int statements = 0;
+		for (int i = 0; i < 2; ++i)
+		{
+			if (options.arrays > 0 && random(2) == 0)
+			{
+				line(indent, "let " + arrayAccess(random(options.arrays), loops) + " <- " + expression(loops) + ";");
+			}
+			else
+			{
+				line(indent, "let s <- s + " + expression(loops) + ";");
+			}
+			++statements;
+		}
+		return statements;
+	}
+	int statements = 1;
+	if (level % 2 == 0)
+	{
+		std::string counter = "i" + std::to_string(loops);
+		// counters index the arrays, so loops stop at the smallest dimension
+		line(indent, "let " + counter + " <- 0;");
+		line(indent, "while " + counter + " < " + std::to_string(dimSize(0)) + " do");
+		statements += nest(indent + 1, level + 1, loops + 1);
+		line(indent + 1, "let " + counter + " <- " + counter + " + 1");
+		line(indent, "od;");
+		return statements + 2;
+	}
+	line(indent, "if " + operand(loops) + " < " + operand(loops) + " then");
+	statements += nest(indent + 1, level + 1, loops);
+	line(indent + 1, "let s <- s + 1");
+	line(indent, "else");
+	statements += nest(indent + 1, level + 1, loops);
+	line(indent + 1, "let s <- s - 1");
+	line(indent, "fi;");
+	return statements;
+}
+
+static void declarations(int indent)
+{
+	std::string vars = "var s";
+	for (int i = 0; i < options.vars; ++i)
+	{
+		vars += ", " + var(i);
+	}
+	for (int i = 0; i < (options.depth + 1) / 2; ++i)
+	{
+		vars += ", i" + std::to_string(i);
+	}
+	line(indent, vars + ";");
+}
+
+// callee is the index of a function this body may call, or -1
+static void body(int indent, int callee)
+{
+	line(indent - 1, "{");
+	line(indent, "let s <- 0;");
+	int statements = 0;
+	while (statements < options.statements)
+	{
+		statements += pressureBlock(indent, callee);
+		if (statements < options.statements)
+		{
+			statements += nest(indent, 0, 0);
+		}
+	}
+}
+
+static bool parseOption(const char* arg, const char* name, int& value)
+{
+	std::size_t length = strlen(name);
+	if (strncmp(arg, name, length) != 0 || arg[length] != '=')
+	{
+		return false;
+	}
+	value = atoi(arg + length + 1);
+	return true;
+}
+
+int main(int argc, char* argv[])
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		int seed;
+		if (parseOption(argv[i], "--functions", options.functions)
+				|| parseOption(argv[i], "--statements", options.statements)
+				|| parseOption(argv[i], "--depth", options.depth)
+				|| parseOption(argv[i], "--vars", options.vars)
+				|| parseOption(argv[i], "--arrays", options.arrays)
+				|| parseOption(argv[i], "--dims", options.dims)
+				|| parseOption(argv[i], "--pressure", options.pressure))
+		{
+			continue;
+		}
+		if (parseOption(argv[i], "--seed", seed))
+		{
+			options.seed = seed;
+			continue;
+		}
+		fprintf(stderr, "usage: %s [--functions=N] [--statements=N] [--depth=N] [--vars=N] [--arrays=N] "
+				"[--dims=N] [--pressure=N] [--seed=N]\n", argv[0]);
+		exit(1);
+	}
+	if (options.vars < 1 || options.dims < 1 || options.depth < 0)
+	{
+		fprintf(stderr, "vars and dims must be at least 1, depth at least 0\n");
+		exit(1);
+	}
+	rng.seed(options.seed);
+
+	line(0, "main");
+	declarations(0);
+	for (int i = 0; i < options.arrays; ++i)
+	{
+		std::string array = "array ";
+		for (int d = 0; d < options.dims; ++d)
+		{
+			array += "[" + std::to_string(dimSize(d)) + "]";
+		}
+		line(0, array + " a" + std::to_string(i) + ";");
+	}
+	for (int f = 0; f < options.functions; ++f)
+	{
+		line(0, "");
+		line(0, "function f" + std::to_string(f) + "(x, y);");
+		declarations(0);
+		body(1, f - 1);
+		line(1, "return s + x * y");
+		line(0, "};");
+	}
+	line(0, "");
+	body(1, options.functions - 1);
+	line(1, "call OutputNum(s);");
+	line(1, "call OutputNewLine()");
+	line(0, "}.");
+	fputs(out.c_str(), stdout);
+	return 0;
+}
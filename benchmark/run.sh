@@ -0,0 +1,99 @@
+#!/bin/bash
+#
+# run.sh
+# Author: Joshua Cao
+#
+# compile time benchmark: sweeps one parameter of the program generator at a
+# time, compiles each program with --time-passes and prints the time of every
+# pass per size. the last column is the growth exponent of the total time
+# against the number of instructions, ie. about 1 for linear passes and 2 for
+# quadratic ones, so a complexity regression shows up as a jump in it
+#
+# usage: benchmark/run.sh [sweep...], where a sweep is one of
+# statements, functions, pressure, depth. all of them by default
+#
+# environment:
+# 	COMPILER	compiler to benchmark (./compiler)
+# 	GENERATOR	program generator (benchmark/generate)
+# 	PASSES		pipeline to time (summarize,unroll,hoist-calls,gvn,canonicalize-cfg,regalloc)
+# 	TIMEOUT		seconds before a size is abandoned (60)
+#
+
+COMPILER=${COMPILER:-./compiler}
+GENERATOR=${GENERATOR:-benchmark/generate}
+PASSES=${PASSES:-summarize,unroll,hoist-calls,gvn,canonicalize-cfg,regalloc}
+TIMEOUT=${TIMEOUT:-60}
+
+for tool in "$COMPILER" "$GENERATOR"; do
+	if [ ! -x "$tool" ]; then
+		echo "$tool not found, run make benchmark" >&2
+		exit 1
+	fi
+done
+
+programs=$(mktemp -d)
+trap 'rm -rf "$programs"' EXIT
+
+# sweep name, the generator option it varies, its values, fixed options
+sweep()
+{
+	local name=$1 option=$2 values=$3 fixed=$4
+	echo "== $name: --$option in $values, $fixed"
+	local header=1 prevIns="" prevTotal=""
+	for value in $values; do
+		local program="$programs/${name}_$value.txt"
+		local args="$fixed --$option=$value"
+		# pressure needs as many variables
+		[ "$option" = pressure ] && args="$args --vars=$value"
+		$GENERATOR $args > "$program" || exit 1
+		local stats
+		stats=$(timeout "$TIMEOUT" $COMPILER --passes="$PASSES" --time-passes "$program" 2>&1 >/dev/null </dev/null)
+		if [ $? -ne 0 ]; then
+			printf "%-8s did not finish within %ss\n" "$value" "$TIMEOUT"
+			break
+		fi
+		local row
+		row=$(echo "$stats" | awk -v value="$value" -v header=$header -v prevIns="$prevIns" -v prevTotal="$prevTotal" '
+			BEGIN { n = 0 }
+			$1 == "pass" { next }
+			$1 == "total" { total = $2; next }
+			{
+				names[n] = $1; times[n] = $3; n++
+				if ($1 == "parse") { ins = $5 }
+			}
+			END {
+				if (header) {
+					printf "%-8s %8s", "size", "ins"
+					for (i = 0; i < n; i++) printf " %17s", names[i]
+					printf " %10s %7s\n", "total ms", "growth"
+				}
+				printf "%-8s %8d", value, ins
+				for (i = 0; i < n; i++) printf " %17.3f", times[i]
+				growth = "-"
+				if (prevIns != "" && ins > prevIns && prevTotal > 0 && total > 0) {
+					growth = sprintf("%.2f", log(total / prevTotal) / log(ins / prevIns))
+				}
+				printf " %10.3f %7s\n", total, growth
+				printf "#%d %f\n", ins, total
+			}')
+		echo "$row" | grep -v '^#'
+		prevIns=$(echo "$row" | grep '^#' | cut -c2- | cut -d' ' -f1)
+		prevTotal=$(echo "$row" | grep '^#' | cut -d' ' -f2)
+		header=0
+	done
+	echo
+}
+
+sweeps=${*:-statements functions pressure depth}
+for s in $sweeps; do
+	case $s in
+	statements) sweep statements statements "25 50 100 200 400" "--functions=1" ;;
+	functions) sweep functions functions "1 2 4 8 16 32" "--statements=25" ;;
+	pressure) sweep pressure pressure "2 4 6 8 12 16" "--functions=1 --statements=50" ;;
+	depth) sweep depth depth "0 2 4 6 8" "--functions=1 --statements=50" ;;
+	*)
+		echo "unknown sweep $s, expected statements, functions, pressure or depth" >&2
+		exit 1
+		;;
+	esac
+done
@@ -0,0 +1,119 @@
+#!/bin/bash
+#
+# runtime.sh
+# Author: Joshua Cao
+#
+# runtime benchmark: runs every test program and the kernels in
+# benchmark/kernels/ on their fixed input, benchmark/inputs/<name>.in or no
+# input, and compares the counters with benchmark/runtime_baseline.txt.
+# from --interpret: dynamic instructions, loads, stores, moves, spill loads
+# and spill stores. from --simulate: DLX cycles
+#
+# usage: benchmark/runtime.sh [--update]
+# --update writes the current counters as the new baseline. otherwise the
+# exit status is 1 if any counter of any program went up
+#
+# environment:
+# 	COMPILER	compiler to benchmark (./compiler)
+# 	TIMEOUT		seconds before a program is abandoned (10)
+#
+
+COMPILER=${COMPILER:-./compiler}
+TIMEOUT=${TIMEOUT:-10}
+BASELINE=benchmark/runtime_baseline.txt
+PROGRAMS="testcases/public/*.txt testcases/custom/*.txt benchmark/kernels/*.txt"
+
+if [ ! -x "$COMPILER" ]; then
+	echo "$COMPILER not found, run make" >&2
+	exit 1
+fi
+
+# prints the counters of one program, or "failed"
+measure()
+{
+	local program=$1 input=/dev/null
+	local name
+	name=$(basename "$program" .txt)
+	[ -f "benchmark/inputs/$name.in" ] && input="benchmark/inputs/$name.in"
+	local interpret simulate
+	interpret=$(timeout "$TIMEOUT" $COMPILER --interpret "$program" 2>&1 >/dev/null <"$input") || { echo failed; return; }
+	simulate=$(timeout "$TIMEOUT" $COMPILER --simulate "$program" 2>&1 >/dev/null <"$input") || { echo failed; return; }
+	printf "%s\n%s\n" "$interpret" "$simulate" | awk '
+		/^dynamic instructions:/ { instructions = $3 }
+		/^\tload:/ { loads = $2 }
+		/^\tstore:/ { stores = $2 }
+		/^\tmove:/ { moves = $2 }
+		/^spill loads:/ { spillLoads = $3 }
+		/^spill stores:/ { spillStores = $3 }
+		/^cycles:/ { cycles = $2 }
+		END { printf "%d %d %d %d %d %d %d\n", instructions, loads, stores, moves, spillLoads, spillStores, cycles }'
+}
+
+results=$(mktemp)
+trap 'rm -f "$results"' EXIT
+for program in $PROGRAMS; do
+	echo "$program $(measure "$program")" >> "$results"
+done
+
+if [ "$1" = "--update" ]; then
+	{
+		echo "# program instructions loads stores moves spill_loads spill_stores cycles"
+		cat "$results"
+	} > $BASELINE
+	echo "wrote $BASELINE"
+	exit 0
+fi
+
+if [ ! -f $BASELINE ]; then
+	echo "$BASELINE not found, run benchmark/runtime.sh --update" >&2
+	exit 1
+fi
+
+# the second file is the baseline, the first the current counters
+awk '
+	BEGIN {
+		split("instructions loads stores moves spill_loads spill_stores cycles", names, " ")
+	}
+	/^#/ { next }
+	FNR == NR {
+		current[$1] = $0
+		order[n++] = $1
+		next
+	}
+	{ baseline[$1] = $0 }
+	END {
+		printf "%-48s %-12s %10s %10s %8s\n", "program", "counter", "baseline", "current", "change"
+		worse = 0
+		for (i = 0; i < n; i++) {
+			p = order[i]
+			split(current[p], c, " ")
+			if (!(p in baseline)) {
+				printf "%-48s new\n", p
+				continue
+			}
+			split(baseline[p], b, " ")
+			if (c[2] == "failed" || b[2] == "failed") {
+				if (c[2] != b[2]) {
+					printf "%-48s %-12s %10s %10s\n", p, "status", b[2] == "failed" ? "failed" : "ok",
+						c[2] == "failed" ? "failed" : "ok"
+					worse += c[2] == "failed"
+				}
+				continue
+			}
+			for (j = 1; j <= 7; j++) {
+				if (c[j + 1] != b[j + 1]) {
+					change = b[j + 1] ? sprintf("%+.1f%%", 100 * (c[j + 1] - b[j + 1]) / b[j + 1]) : "new"
+					printf "%-48s %-12s %10d %10d %8s\n", p, names[j], b[j + 1], c[j + 1], change
+					worse += c[j + 1] > b[j + 1]
+				}
+				total[j] += c[j + 1]
+				baseTotal[j] += b[j + 1]
+			}
+		}
+		printf "\ntotal over programs that ran in both:\n"
+		for (j = 1; j <= 7; j++) {
+			change = baseTotal[j] ? sprintf("%+.1f%%", 100 * (total[j] - baseTotal[j]) / baseTotal[j]) : "-"
+			printf "%-12s %12d %12d %8s\n", names[j], baseTotal[j], total[j], change
+		}
+		exit worse > 0
+	}' "$results" $BASELINE
@@ -0,0 +1,75 @@
+/*
+ * CompilerClient.cpp
+ * Author: Joshua Cao
+ */
+
+#include "ServerProtocol.h"
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/*
+ * drop in replacement for the compiler that has a running compiler --server
+ * do the work. takes the same arguments, and prints and exits like the
+ * compiler would. the server is found at ServerProtocol::defaultSocketPath()
+ */
+int main(int argc, char* argv[])
+{
+	std::string path = ServerProtocol::defaultSocketPath();
+	sockaddr_un address = {};
+	address.sun_family = AF_UNIX;
+	if (path.size() >= sizeof(address.sun_path))
+	{
+		fprintf(stderr, "socket path %s is too long\n", path.c_str());
+		return 1;
+	}
+	strcpy(address.sun_path, path.c_str());
+	int server = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (server < 0 || connect(server, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+	{
+		fprintf(stderr, "cannot connect to a compiler server on %s, start one with compiler --server\n", path.c_str());
+		return 1;
+	}
+
+	char dir[PATH_MAX];
+	if (!getcwd(dir, sizeof(dir)))
+	{
+		perror("getcwd");
+		return 1;
+	}
+	int fds[3] = {STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO};
+	bool sent = ServerProtocol::sendDescriptors(server, fds, 3)
+			&& ServerProtocol::writeFrame(server, ServerProtocol::HELLO)
+			&& ServerProtocol::writeFrame(server, dir)
+			&& ServerProtocol::writeFrame(server, std::to_string(argc - 1));
+	for (int i = 1; sent && i < argc; ++i)
+	{
+		sent = ServerProtocol::writeFrame(server, argv[i]);
+	}
+	std::string response;
+	if (!sent || !ServerProtocol::readFrame(server, response))
+	{
+		fprintf(stderr, "the compiler server on %s closed the connection\n", path.c_str());
+		return 1;
+	}
+	close(server);
+
+	if (response.compare(0, 5, "exit ") == 0)
+	{
+		return atoi(response.c_str() + 5);
+	}
+	if (response.compare(0, 7, "signal ") == 0)
+	{
+		// like a shell reports a process killed by a signal
+		int sig = atoi(response.c_str() + 7);
+		fprintf(stderr, "compiler killed by signal %d (%s)\n", sig, strsignal(sig));
+		return 128 + sig;
+	}
+	fprintf(stderr, "compiler server: %s\n", response.compare(0, 6, "error ") == 0 ? response.c_str() + 6 : response.c_str());
+	return 1;
+}
@@ -0,0 +1,12 @@
+	0: ADDI R25 R0 40
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: LDW R1 R30 -40
+	20: WRD R1
+	24: RDD R2
+	28: STW R2 R30 -16
+	32: LDW R1 R30 -4
+	36: WRD R1
+	40: RET R0
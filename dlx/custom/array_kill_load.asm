@@ -0,0 +1,56 @@
+	0: ADDI R25 R0 12
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R25 R0 4
+	16: SUB R29 R29 R25
+	20: ADDI R1 R0 0
+	24: ADDI R25 R0 -8
+	28: ADD R5 R30 R25
+	32: ADDI R26 R0 10
+	36: STW R26 R5 0
+	40: ADDI R25 R0 -4
+	44: ADD R4 R30 R25
+	48: ADDI R26 R0 20
+	52: STW R26 R4 0
+	56: ADDI R25 R0 -4
+	60: ADD R3 R28 R25
+	64: ADDI R26 R0 30
+	68: STW R26 R3 0
+	72: RDD R2
+	76: LDW R6 R5 0
+	80: STW R6 R28 -4
+	84: LDW R1 R28 -4
+	88: WRD R1
+	92: LDW R1 R4 0
+	96: WRD R1
+	100: LDW R6 R3 0
+	104: WRD R6
+	108: MULI R1 R2 4
+	112: ADDI R1 R1 -12
+	116: ADD R2 R30 R1
+	120: LDW R1 R2 0
+	124: WRD R1
+	128: ADDI R26 R0 40
+	132: STW R26 R4 0
+	136: LDW R1 R28 -4
+	140: WRD R1
+	144: LDW R1 R4 0
+	148: WRD R1
+	152: WRD R6
+	156: LDW R1 R2 0
+	160: WRD R1
+	164: RDD R1
+	168: MULI R1 R1 4
+	172: ADDI R1 R1 -12
+	176: ADDI R26 R0 50
+	180: STX R26 R30 R1
+	184: LDW R1 R5 0
+	188: WRD R1
+	192: LDW R1 R4 0
+	196: WRD R1
+	200: LDW R1 R3 0
+	204: WRD R1
+	208: LDW R1 R2 0
+	212: WRD R1
+	216: RET R0
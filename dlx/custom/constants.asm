@@ -0,0 +1,11 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R2 R0 0
+	16: ADDI R1 R0 14
+	20: ADDI R25 R0 14
+	24: MULI R1 R25 5
+	28: ADDI R1 R1 0
+	32: WRD R1
+	36: RET R0
@@ -0,0 +1,20 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R2 R0 0
+	16: ADD R2 R0 R0
+	20: CMPI R1 R2 100
+	24: BGE R1 11
+	28: ADDI R1 R2 1
+	32: WRD R1
+	36: ADDI R1 R1 1
+	40: WRD R1
+	44: ADDI R1 R1 1
+	48: WRD R1
+	52: ADDI R1 R1 1
+	56: WRD R1
+	60: ADD R2 R0 R1
+	64: BEQ R0 -11
+	68: WRD R2
+	72: RET R0
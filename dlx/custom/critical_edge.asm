@@ -0,0 +1,19 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R2 R0 0
+	16: RDD R3
+	20: ADD R2 R0 R0
+	24: ADD R4 R0 R0
+	28: CMP R1 R4 R3
+	32: BGE R1 8
+	36: CMPI R1 R4 3
+	40: BGE R1 3
+	44: ADD R2 R2 R4
+	48: BEQ R0 1
+	52: ADDI R1 R4 1
+	56: ADD R4 R0 R1
+	60: BEQ R0 -8
+	64: WRD R2
+	68: RET R0
@@ -0,0 +1,9 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: ADDI R1 R0 100
+	20: ADDI R25 R0 100
+	24: WRD R25
+	28: RET R0
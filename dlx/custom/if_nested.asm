@@ -0,0 +1,24 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: RDD R3
+	20: RDD R4
+	24: RDD R2
+	28: CMP R1 R3 R4
+	32: BLE R1 8
+	36: CMP R1 R3 R2
+	40: BLE R1 3
+	44: MULI R1 R3 2
+	48: BEQ R0 3
+	52: MULI R2 R2 3
+	56: ADD R1 R0 R3
+	60: BEQ R0 6
+	64: CMP R1 R4 R2
+	68: BLE R1 3
+	72: MULI R2 R4 4
+	76: BEQ R0 1
+	80: ADD R1 R0 R3
+	84: WRD R1
+	88: RET R0
@@ -0,0 +1,27 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R3 R0 0
+	16: RDD R2
+	20: CMPI R1 R2 0
+	24: BLE R1 17
+	28: ADDI R1 R2 -3
+	32: CMP R1 R0 R1
+	36: BGE R1 7
+	40: SUBI R1 R2 1
+	44: SUBI R1 R1 1
+	48: SUBI R1 R1 1
+	52: SUBI R1 R1 1
+	56: ADD R2 R0 R1
+	60: BEQ R0 -8
+	64: CMP R1 R0 R2
+	68: BGE R1 4
+	72: SUBI R1 R2 1
+	76: ADD R2 R0 R1
+	80: BEQ R0 -4
+	84: ADD R1 R0 R2
+	88: BEQ R0 2
+	92: ADD R1 R0 R2
+	96: WRD R1
+	100: RET R0
@@ -0,0 +1,40 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R25 R0 4
+	16: SUB R29 R29 R25
+	20: ADDI R4 R0 0
+	24: RDD R5
+	28: RDD R2
+	32: STW R2 R28 -4
+	36: ADDI R3 R0 1
+	40: ADDI R2 R0 2
+	44: ADD R4 R0 R0
+	48: ADDI R3 R0 1
+	52: ADDI R2 R0 2
+	56: ADD R1 R0 R0
+	60: CMP R6 R1 R5
+	64: BGE R6 18
+	68: LDW R6 R28 -4
+	72: CMP R6 R1 R6
+	76: BNE R6 12
+	80: MUL R6 R3 R2
+	84: MUL R3 R4 R1
+	88: ADD R6 R6 R3
+	92: LDW R3 R28 -4
+	96: MUL R3 R5 R3
+	100: ADD R3 R6 R3
+	104: MUL R6 R3 R4
+	108: ADD R6 R2 R6
+	112: MUL R2 R1 R5
+	116: ADD R2 R6 R2
+	120: BEQ R0 2
+	124: ADD R4 R4 R1
+	128: ADDI R1 R1 1
+	132: BEQ R0 -18
+	136: WRD R4
+	140: ADD R1 R3 R2
+	144: WRD R1
+	148: WRL
+	152: RET R0
@@ -0,0 +1,30 @@
+	0: ADDI R25 R0 40
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R25 R0 12
+	16: SUB R29 R29 R25
+	20: ADDI R1 R0 0
+	24: RDD R2
+	28: STW R2 R28 -8
+	32: RDD R6
+	36: RDD R2
+	40: STW R2 R28 -12
+	44: RDD R2
+	48: STW R2 R28 -4
+	52: RDD R5
+	56: RDD R4
+	60: RDD R3
+	64: RDD R2
+	68: LDW R1 R28 -8
+	72: ADD R6 R1 R6
+	76: LDW R1 R28 -12
+	80: ADD R6 R6 R1
+	84: LDW R1 R28 -4
+	88: ADD R1 R6 R1
+	92: ADD R1 R1 R5
+	96: ADD R1 R1 R4
+	100: ADD R1 R1 R3
+	104: ADD R1 R1 R2
+	108: WRD R1
+	112: RET R0
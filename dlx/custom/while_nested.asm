@@ -0,0 +1,40 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R2 R0 0
+	16: RDD R3
+	20: ADD R2 R0 R0
+	24: CMPI R1 R3 100
+	28: BGE R1 29
+	32: RDD R2
+	36: ADDI R1 R2 3
+	40: CMPI R1 R1 100
+	44: BGE R1 15
+	48: ADD R1 R3 R2
+	52: WRD R1
+	56: ADDI R2 R2 1
+	60: ADD R1 R3 R2
+	64: WRD R1
+	68: ADDI R2 R2 1
+	72: ADD R1 R3 R2
+	76: WRD R1
+	80: ADDI R2 R2 1
+	84: ADD R1 R3 R2
+	88: WRD R1
+	92: ADDI R1 R2 1
+	96: ADD R2 R0 R1
+	100: BEQ R0 -16
+	104: CMPI R1 R2 100
+	108: BGE R1 6
+	112: ADD R1 R3 R2
+	116: WRD R1
+	120: ADDI R1 R2 1
+	124: ADD R2 R0 R1
+	128: BEQ R0 -6
+	132: ADDI R1 R3 1
+	136: ADD R3 R0 R1
+	140: BEQ R0 -29
+	144: WRD R3
+	148: WRD R2
+	152: RET R0
@@ -0,0 +1,29 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: RDD R3
+	20: ADD R2 R0 R3
+	24: ADDI R1 R2 3
+	28: CMPI R1 R1 100
+	32: BGE R1 11
+	36: ADDI R1 R2 1
+	40: WRD R3
+	44: ADDI R1 R1 1
+	48: WRD R3
+	52: ADDI R1 R1 1
+	56: WRD R3
+	60: ADDI R1 R1 1
+	64: WRD R3
+	68: ADD R2 R0 R1
+	72: BEQ R0 -12
+	76: CMPI R1 R2 100
+	80: BGE R1 5
+	84: ADDI R1 R2 1
+	88: WRD R3
+	92: ADD R2 R0 R1
+	96: BEQ R0 -5
+	100: WRD R2
+	104: WRD R3
+	108: RET R0
@@ -0,0 +1,57 @@
+	0: ADDI R25 R0 96
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: ADDI R25 R0 -52
+	20: ADD R2 R30 R25
+	24: ADDI R26 R0 1
+	28: STW R26 R2 0
+	32: ADDI R25 R0 -56
+	36: ADD R1 R30 R25
+	40: ADDI R26 R0 2
+	44: STW R26 R1 0
+	48: LDW R2 R2 0
+	52: LDW R1 R1 0
+	56: CMP R1 R2 R1
+	60: BLE R1 5
+	64: JSR 104
+	68: ADD R2 R0 R27
+	72: STW R2 R30 -60
+	76: BEQ R0 4
+	80: JSR 104
+	84: ADD R2 R0 R27
+	88: STW R2 R30 -60
+	92: LDW R1 R30 -60
+	96: WRD R1
+	100: RET R0
+foo:
+	104: PSH R31 R29 -4
+	108: PSH R28 R29 -4
+	112: ADD R28 R0 R29
+	116: ADDI R25 R0 55
+	120: WRD R25
+	124: ADDI R2 R0 2
+	128: ADDI R1 R0 3
+	132: ADDI R25 R0 2
+	136: ADDI R1 R25 3
+	140: ADD R27 R0 R1
+	144: ADD R29 R0 R28
+	148: POP R28 R29 4
+	152: POP R31 R29 4
+	156: RET R31
+bar:
+	160: PSH R31 R29 -4
+	164: PSH R28 R29 -4
+	168: ADD R28 R0 R29
+	172: ADDI R25 R0 35
+	176: WRD R25
+	180: ADDI R2 R0 3
+	184: ADDI R1 R0 4
+	188: ADDI R25 R0 3
+	192: ADDI R1 R25 4
+	196: ADD R27 R0 R1
+	200: ADD R29 R0 R28
+	204: POP R28 R29 4
+	208: POP R31 R29 4
+	212: RET R31
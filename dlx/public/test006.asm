@@ -0,0 +1,18 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: JSR 28
+	20: ADD R1 R0 R27
+	24: RET R0
+foo:
+	28: PSH R31 R29 -4
+	32: PSH R28 R29 -4
+	36: ADD R28 R0 R29
+	40: ADDI R1 R0 0
+	44: ADD R27 R0 R0
+	48: ADD R29 R0 R28
+	52: POP R28 R29 4
+	56: POP R31 R29 4
+	60: RET R31
@@ -0,0 +1,40 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: ADDI R2 R0 1
+	20: ADDI R3 R0 2
+	24: ADDI R4 R0 3
+	28: ADDI R25 R0 1
+	32: CMPI R1 R25 2
+	36: BLE R1 16
+	40: ADDI R25 R0 1
+	44: ADDI R2 R25 1
+	48: CMPI R1 R2 2
+	52: BGE R1 9
+	56: MULI R2 R2 4
+	60: ADDI R25 R0 3
+	64: CMP R1 R25 R2
+	68: BEQ R1 3
+	72: ADD R1 R0 R2
+	76: BEQ R0 2
+	80: ADDI R1 R0 3
+	84: BEQ R0 2
+	88: ADDI R1 R0 3
+	92: ADDI R3 R0 2
+	96: BEQ R0 12
+	100: ADDI R25 R0 2
+	104: ADDI R3 R25 5
+	108: ADDI R25 R0 1
+	112: CMP R1 R25 R3
+	116: BGE R1 4
+	120: ADDI R25 R0 1
+	124: SUBI R2 R25 2
+	128: BEQ R0 3
+	132: ADDI R25 R0 1
+	136: ADDI R2 R25 3
+	140: ADDI R1 R0 3
+	144: ADDI R1 R2 1
+	148: WRD R1
+	152: RET R0
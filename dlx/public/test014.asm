@@ -0,0 +1,15 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R2 R0 0
+	16: ADDI R3 R0 1
+	20: ADD R2 R0 R0
+	24: ADDI R3 R0 1
+	28: CMP R1 R3 R2
+	32: BEQ R1 5
+	36: ADDI R2 R3 1
+	40: MULI R1 R3 2
+	44: ADD R3 R0 R1
+	48: BEQ R0 -5
+	52: RET R0
@@ -0,0 +1,72 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: ADDI R25 R0 3
+	20: ADDI R1 R25 0
+	24: ADDI R1 R1 6
+	28: RET R0
+bar:
+	32: PSH R31 R29 -4
+	36: PSH R28 R29 -4
+	40: ADD R28 R0 R29
+	44: LDW R1 R28 8
+	48: ADDI R1 R0 0
+	52: ADDI R2 R0 9
+	56: ADDI R3 R0 3
+	60: ADDI R2 R0 9
+	64: ADDI R3 R0 3
+	68: ADDI R25 R0 3
+	72: CMP R1 R25 R3
+	76: BGE R1 15
+	80: ADDI R25 R0 2
+	84: CMPI R1 R25 3
+	88: BGE R1 3
+	92: ADD R2 R3 R2
+	96: BEQ R0 1
+	100: ADDI R25 R0 4
+	104: CMP R1 R25 R2
+	108: BLT R1 4
+	112: SUB R1 R3 R2
+	116: ADD R2 R0 R1
+	120: BEQ R0 -5
+	124: SUBI R1 R2 3
+	128: ADD R3 R0 R1
+	132: BEQ R0 -16
+	136: ADD R2 R3 R2
+	140: ADDI R1 R0 4
+	144: ADD R27 R0 R2
+	148: ADD R29 R0 R28
+	152: POP R28 R29 4
+	156: POP R31 R29 4
+	160: RET R31
+foo:
+	164: PSH R31 R29 -4
+	168: PSH R28 R29 -4
+	172: ADD R28 R0 R29
+	176: LDW R1 R28 8
+	180: ADDI R1 R0 0
+	184: ADDI R2 R0 9
+	188: ADDI R3 R0 3
+	192: ADDI R2 R0 9
+	196: ADDI R3 R0 3
+	200: ADDI R25 R0 3
+	204: CMP R1 R25 R3
+	208: BGE R1 11
+	212: ADD R2 R3 R2
+	216: ADDI R25 R0 4
+	220: CMP R1 R25 R2
+	224: BLT R1 4
+	228: SUB R1 R3 R2
+	232: ADD R2 R0 R1
+	236: BEQ R0 -5
+	240: SUBI R1 R2 3
+	244: ADD R3 R0 R1
+	248: BEQ R0 -12
+	252: ADD R1 R3 R2
+	256: ADD R27 R0 R1
+	260: ADD R29 R0 R28
+	264: POP R28 R29 4
+	268: POP R31 R29 4
+	272: RET R31
@@ -0,0 +1,17 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R3 R0 0
+	16: ADDI R2 R0 1
+	20: ADDI R25 R0 4
+	24: MULI R1 R25 1
+	28: CMPI R1 R1 1
+	32: BLE R1 4
+	36: ADDI R25 R0 1
+	40: ADDI R1 R25 2
+	44: BEQ R0 2
+	48: ADD R1 R0 R0
+	52: ADDI R25 R0 1
+	56: ADDI R1 R25 1
+	60: RET R0
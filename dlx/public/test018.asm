@@ -0,0 +1,53 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: JSR 20
+	16: RET R0
+foo:
+	20: PSH R31 R29 -4
+	24: PSH R28 R29 -4
+	28: ADD R28 R0 R29
+	32: ADDI R25 R0 16
+	36: SUB R29 R29 R25
+	40: ADDI R6 R0 0
+	44: ADDI R3 R0 0
+	48: MUL R2 R3 R3
+	52: ADDI R4 R3 0
+	56: ADD R5 R2 R3
+	60: STW R5 R28 -4
+	64: LDW R1 R28 -4
+	68: CMP R1 R1 R3
+	72: BGE R1 4
+	76: ADDI R6 R2 1
+	80: ADD R5 R0 R3
+	84: BEQ R0 10
+	88: SUB R4 R3 R2
+	92: LDW R1 R28 -4
+	96: CMP R1 R4 R1
+	100: BLE R1 4
+	104: ADDI R5 R0 2
+	108: ADDI R5 R0 2
+	112: BEQ R0 2
+	116: ADD R5 R0 R3
+	120: ADD R6 R0 R0
+	124: STW R6 R28 -8
+	128: STW R5 R28 -12
+	132: STW R4 R28 -16
+	136: LDW R1 R28 -4
+	140: MUL R4 R2 R1
+	144: LDW R1 R28 -4
+	148: WRD R1
+	152: WRD R4
+	156: LDW R1 R28 -12
+	160: WRD R1
+	164: WRD R3
+	168: LDW R1 R28 -16
+	172: WRD R1
+	176: WRD R2
+	180: LDW R1 R28 -8
+	184: WRD R1
+	188: ADD R29 R0 R28
+	192: POP R28 R29 4
+	196: POP R31 R29 4
+	200: RET R31
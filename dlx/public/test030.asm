@@ -0,0 +1,33 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: ADDI R4 R0 1
+	20: ADDI R6 R0 2
+	24: ADDI R3 R0 3
+	28: ADDI R25 R0 2
+	32: CMPI R1 R25 3
+	36: BGE R1 18
+	40: ADDI R4 R0 1
+	44: ADDI R6 R0 2
+	48: ADDI R5 R2 1
+	52: CMPI R1 R5 3
+	56: BGE R1 10
+	60: ADDI R4 R4 1
+	64: ADD R2 R0 R6
+	68: ADDI R1 R2 2
+	72: CMPI R1 R1 3
+	76: BGE R1 3
+	80: ADD R2 R0 R5
+	84: BEQ R0 -4
+	88: ADD R6 R0 R2
+	92: BEQ R0 -11
+	96: ADD R2 R0 R4
+	100: ADD R1 R0 R6
+	104: BEQ R0 3
+	108: ADDI R2 R0 1
+	112: ADDI R1 R0 2
+	116: ADDI R25 R0 3
+	120: ADDI R1 R25 1
+	124: RET R0
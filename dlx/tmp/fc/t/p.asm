@@ -0,0 +1,1762 @@
+	0: ADDI R25 R0 160
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R25 R0 88
+	16: SUB R29 R29 R25
+	20: ADDI R2 R0 0
+	24: STW R0 R28 -4
+	28: RDD R2
+	32: STW R2 R28 -44
+	36: LDW R1 R28 -44
+	40: MULI R1 R1 8
+	44: ADDI R2 R1 14
+	48: STW R2 R28 -24
+	52: LDW R1 R28 -24
+	56: MULI R2 R1 5
+	60: LDW R1 R28 -4
+	64: ADD R2 R2 R1
+	68: STW R2 R28 -72
+	72: LDW R1 R28 -72
+	76: MULI R2 R1 8
+	80: LDW R1 R28 -4
+	84: ADD R2 R2 R1
+	88: STW R2 R28 -32
+	92: LDW R1 R28 -32
+	96: MULI R2 R1 5
+	100: LDW R1 R28 -4
+	104: ADD R2 R2 R1
+	108: STW R2 R28 -40
+	112: LDW R1 R28 -40
+	116: MULI R2 R1 5
+	120: LDW R1 R28 -32
+	124: ADD R2 R2 R1
+	128: STW R2 R28 -88
+	132: LDW R2 R28 -44
+	136: LDW R1 R28 -4
+	140: ADD R2 R1 R2
+	144: LDW R1 R28 -24
+	148: ADD R2 R2 R1
+	152: LDW R1 R28 -72
+	156: ADD R2 R2 R1
+	160: LDW R1 R28 -32
+	164: ADD R2 R2 R1
+	168: LDW R1 R28 -40
+	172: ADD R2 R2 R1
+	176: LDW R1 R28 -88
+	180: ADD R2 R2 R1
+	184: STW R2 R28 -80
+	188: LDW R2 R28 -80
+	192: LDW R3 R28 -4
+	196: LDW R4 R28 -4
+	200: STW R2 R28 -52
+	204: STW R3 R28 -76
+	208: CMPI R1 R4 4
+	212: BGE R1 119
+	216: ADDI R25 R0 89
+	220: CMP R1 R25 R4
+	224: BGE R1 56
+	228: LDW R5 R28 -16
+	232: LDW R3 R28 -4
+	236: CMPI R1 R3 4
+	240: BGE R1 50
+	244: LDW R1 R28 -24
+	248: CMP R1 R3 R1
+	252: BGE R1 22
+	256: LDW R1 R28 -4
+	260: ADD R1 R5 R1
+	264: ADD R2 R1 R4
+	268: LDW R1 R28 -72
+	272: ADD R2 R2 R1
+	276: MULI R1 R4 5
+	280: ADD R1 R3 R1
+	284: MULI R5 R1 4
+	288: ADDI R1 R5 -160
+	292: LDX R1 R30 R1
+	296: ADD R2 R2 R1
+	300: LDW R1 R28 -40
+	304: ADD R1 R2 R1
+	308: SUB R1 R1 R3
+	312: ADDI R1 R1 12
+	316: SUB R2 R1 R4
+	320: ADDI R1 R5 -80
+	324: LDX R1 R30 R1
+	328: ADD R1 R2 R1
+	332: ADDI R2 R1 1
+	336: BEQ R0 22
+	340: MULI R1 R4 5
+	344: ADD R1 R3 R1
+	348: MULI R2 R1 4
+	352: ADDI R6 R2 -160
+	356: STW R6 R28 -8
+	360: LDW R1 R28 -24
+	364: ADDI R6 R1 3485
+	368: ADDI R1 R2 -80
+	372: ADD R1 R30 R1
+	376: LDW R2 R1 0
+	380: ADD R6 R6 R2
+	384: LDW R2 R28 -8
+	388: ADD R2 R30 R2
+	392: STW R6 R2 0
+	396: ADDI R25 R0 87
+	400: SUB R6 R25 R4
+	404: ADDI R6 R6 27
+	408: LDW R1 R1 0
+	412: ADD R1 R6 R1
+	416: STW R1 R2 0
+	420: SUBI R2 R5 1
+	424: ADDI R1 R3 1
+	428: ADD R5 R0 R2
+	432: ADD R3 R0 R1
+	436: BEQ R0 -50
+	440: ADDI R2 R5 1
+	444: BEQ R0 58
+	448: LDW R2 R28 -52
+	452: LDW R3 R28 -4
+	456: STW R2 R28 -16
+	460: CMPI R1 R3 4
+	464: BGE R1 51
+	468: LDW R1 R28 -40
+	472: CMPI R1 R1 49
+	476: BGE R1 24
+	480: MULI R1 R4 5
+	484: ADD R1 R3 R1
+	488: MULI R5 R1 4
+	492: ADDI R6 R5 -160
+	496: LDW R1 R28 -4
+	500: ADDI R2 R1 58
+	504: LDW R1 R28 -32
+	508: SUB R2 R2 R1
+	512: ADDI R1 R5 -80
+	516: ADD R5 R30 R1
+	520: LDW R1 R5 0
+	524: ADD R2 R2 R1
+	528: STX R2 R30 R6
+	532: LDW R2 R28 -44
+	536: LDW R1 R28 -4
+	540: MUL R1 R1 R2
+	544: ADDI R2 R1 19
+	548: LDW R1 R5 0
+	552: ADD R1 R2 R1
+	556: STW R1 R5 0
+	560: LDW R1 R28 -16
+	564: ADDI R2 R1 1
+	568: BEQ R0 22
+	572: LDW R1 R28 -24
+	576: MUL R2 R4 R1
+	580: LDW R1 R28 -32
+	584: MUL R2 R2 R1
+	588: LDW R1 R28 -16
+	592: ADD R1 R1 R2
+	596: ADDI R2 R1 82
+	600: MULI R1 R4 5
+	604: ADD R1 R3 R1
+	608: MULI R5 R1 4
+	612: ADDI R1 R5 -160
+	616: LDX R1 R30 R1
+	620: ADD R2 R2 R1
+	624: LDW R1 R28 -44
+	628: MUL R1 R1 R4
+	632: ADD R1 R2 R1
+	636: SUB R2 R1 R3
+	640: ADDI R1 R5 -80
+	644: LDX R1 R30 R1
+	648: ADD R1 R2 R1
+	652: SUBI R2 R1 1
+	656: ADDI R1 R3 1
+	660: ADD R3 R0 R1
+	664: BEQ R0 -52
+	668: LDW R1 R28 -16
+	672: SUBI R2 R1 1
+	676: ADDI R1 R4 1
+	680: ADD R4 R0 R1
+	684: BEQ R0 -121
+	688: RDD R2
+	692: STW R2 R28 -56
+	696: LDW R1 R28 -56
+	700: MULI R2 R1 7
+	704: LDW R1 R28 -52
+	708: ADD R2 R2 R1
+	712: STW R2 R28 -36
+	716: LDW R1 R28 -36
+	720: MULI R2 R1 5
+	724: LDW R1 R28 -36
+	728: ADD R2 R2 R1
+	732: STW R2 R28 -64
+	736: LDW R1 R28 -64
+	740: ADDI R25 R0 75
+	744: PSH R25 R29 -4
+	748: PSH R1 R29 -4
+	752: JSR 5620
+	756: ADDI R29 R29 8
+	760: ADD R2 R0 R27
+	764: STW R2 R28 -60
+	768: LDW R1 R28 -60
+	772: MULI R2 R1 4
+	776: LDW R1 R28 -4
+	780: ADD R2 R2 R1
+	784: STW R2 R28 -20
+	788: LDW R2 R28 -52
+	792: LDW R1 R28 -20
+	796: PSH R2 R29 -4
+	800: PSH R1 R29 -4
+	804: JSR 5620
+	808: ADDI R29 R29 8
+	812: ADD R2 R0 R27
+	816: STW R2 R28 -28
+	820: LDW R2 R28 -56
+	824: LDW R1 R28 -52
+	828: ADD R2 R1 R2
+	832: LDW R1 R28 -36
+	836: ADD R2 R2 R1
+	840: LDW R1 R28 -64
+	844: ADD R2 R2 R1
+	848: LDW R1 R28 -60
+	852: ADD R2 R2 R1
+	856: LDW R1 R28 -20
+	860: ADD R2 R2 R1
+	864: LDW R1 R28 -28
+	868: ADD R2 R2 R1
+	872: STW R2 R28 -84
+	876: LDW R2 R28 -84
+	880: LDW R3 R28 -76
+	884: LDW R4 R28 -4
+	888: STW R3 R28 -68
+	892: CMPI R1 R4 4
+	896: BGE R1 118
+	900: LDW R1 R28 -56
+	904: CMP R1 R1 R4
+	908: BGE R1 62
+	912: LDW R2 R28 -48
+	916: LDW R3 R28 -4
+	920: STW R2 R28 -12
+	924: CMPI R1 R3 4
+	928: BGE R1 54
+	932: LDW R1 R28 -64
+	936: CMP R1 R3 R1
+	940: BGE R1 20
+	944: MULI R1 R4 5
+	948: ADD R1 R3 R1
+	952: MULI R2 R1 4
+	956: ADDI R6 R2 -160
+	960: LDW R1 R28 -28
+	964: MULI R5 R1 31
+	968: ADD R6 R30 R6
+	972: LDW R1 R6 0
+	976: ADD R1 R5 R1
+	980: STW R1 R6 0
+	984: ADDI R5 R2 -80
+	988: LDW R1 R28 -20
+	992: MULI R2 R1 39
+	996: LDW R1 R6 0
+	1000: ADD R2 R2 R1
+	1004: STX R2 R30 R5
+	1008: LDW R1 R28 -12
+	1012: ADDI R2 R1 1
+	1016: BEQ R0 29
+	1020: MULI R1 R4 5
+	1024: ADD R1 R3 R1
+	1028: MULI R5 R1 4
+	1032: ADDI R2 R5 -80
+	1036: LDW R6 R28 -28
+	1040: LDW R1 R28 -4
+	1044: SUB R6 R6 R1
+	1048: LDW R1 R28 -4
+	1052: ADD R6 R6 R1
+	1056: LDW R1 R28 -4
+	1060: ADD R6 R6 R1
+	1064: ADD R2 R30 R2
+	1068: LDW R1 R2 0
+	1072: ADD R1 R6 R1
+	1076: STW R1 R2 0
+	1080: ADDI R2 R5 -160
+	1084: LDW R5 R28 -28
+	1088: LDW R1 R28 -20
+	1092: SUB R5 R1 R5
+	1096: LDW R1 R28 -4
+	1100: SUB R1 R5 R1
+	1104: SUBI R5 R1 27
+	1108: ADD R2 R30 R2
+	1112: LDW R1 R2 0
+	1116: ADD R1 R5 R1
+	1120: STW R1 R2 0
+	1124: LDW R1 R28 -12
+	1128: SUBI R2 R1 1
+	1132: ADDI R1 R3 1
+	1136: ADD R3 R0 R1
+	1140: BEQ R0 -55
+	1144: LDW R1 R28 -12
+	1148: ADDI R2 R1 1
+	1152: BEQ R0 51
+	1156: LDW R3 R28 -4
+	1160: STW R2 R28 -48
+	1164: CMPI R1 R3 4
+	1168: BGE R1 45
+	1172: LDW R1 R28 -20
+	1176: CMP R1 R4 R1
+	1180: BGE R1 18
+	1184: LDW R1 R28 -48
+	1188: ADDI R2 R1 19
+	1192: LDW R1 R28 -36
+	1196: ADD R5 R2 R1
+	1200: MULI R1 R4 5
+	1204: ADD R1 R3 R1
+	1208: MULI R1 R1 4
+	1212: ADDI R1 R1 -160
+	1216: LDX R2 R30 R1
+	1220: ADD R1 R5 R2
+	1224: ADD R5 R1 R4
+	1228: LDW R1 R28 -60
+	1232: MULI R1 R1 21
+	1236: SUB R1 R5 R1
+	1240: ADD R1 R1 R2
+	1244: ADDI R2 R1 1
+	1248: BEQ R0 22
+	1252: MULI R1 R4 5
+	1256: ADD R1 R3 R1
+	1260: MULI R5 R1 4
+	1264: ADDI R2 R5 -80
+	1268: ADDI R1 R3 74
+	1272: ADDI R6 R1 18
+	1276: LDW R1 R28 -36
+	1280: ADD R6 R6 R1
+	1284: ADD R2 R30 R2
+	1288: LDW R1 R2 0
+	1292: ADD R1 R6 R1
+	1296: STW R1 R2 0
+	1300: ADDI R2 R5 -160
+	1304: LDW R1 R28 -56
+	1308: MULI R5 R1 92
+	1312: ADD R2 R30 R2
+	1316: LDW R1 R2 0
+	1320: ADD R1 R5 R1
+	1324: STW R1 R2 0
+	1328: LDW R1 R28 -48
+	1332: SUBI R2 R1 1
+	1336: ADDI R1 R3 1
+	1340: ADD R3 R0 R1
+	1344: BEQ R0 -46
+	1348: LDW R1 R28 -48
+	1352: SUBI R2 R1 1
+	1356: ADDI R1 R4 1
+	1360: ADD R4 R0 R1
+	1364: BEQ R0 -119
+	1368: WRD R2
+	1372: WRL
+	1376: RET R0
+f0:
+	1380: PSH R31 R29 -4
+	1384: PSH R28 R29 -4
+	1388: ADD R28 R0 R29
+	1392: ADDI R25 R0 108
+	1396: SUB R29 R29 R25
+	1400: LDW R2 R28 8
+	1404: STW R2 R28 -108
+	1408: LDW R2 R28 12
+	1412: STW R2 R28 -104
+	1416: ADDI R2 R0 0
+	1420: STW R0 R28 -28
+	1424: RDD R2
+	1428: STW R2 R28 -52
+	1432: LDW R1 R28 -52
+	1436: MULI R2 R1 4
+	1440: LDW R1 R28 -28
+	1444: ADD R2 R2 R1
+	1448: STW R2 R28 -20
+	1452: LDW R1 R28 -20
+	1456: MULI R1 R1 8
+	1460: ADDI R2 R1 12
+	1464: STW R2 R28 -40
+	1468: LDW R1 R28 -40
+	1472: MULI R2 R1 4
+	1476: LDW R1 R28 -20
+	1480: ADD R2 R2 R1
+	1484: STW R2 R28 -44
+	1488: LDW R1 R28 -44
+	1492: MULI R1 R1 3
+	1496: ADDI R2 R1 39
+	1500: STW R2 R28 -76
+	1504: LDW R1 R28 -76
+	1508: MULI R2 R1 3
+	1512: LDW R1 R28 -28
+	1516: ADD R2 R2 R1
+	1520: STW R2 R28 -48
+	1524: LDW R2 R28 -52
+	1528: LDW R1 R28 -28
+	1532: ADD R2 R1 R2
+	1536: LDW R1 R28 -20
+	1540: ADD R2 R2 R1
+	1544: LDW R1 R28 -40
+	1548: ADD R2 R2 R1
+	1552: LDW R1 R28 -44
+	1556: ADD R2 R2 R1
+	1560: LDW R1 R28 -76
+	1564: ADD R2 R2 R1
+	1568: LDW R1 R28 -48
+	1572: ADD R2 R2 R1
+	1576: STW R2 R28 -100
+	1580: LDW R3 R28 -100
+	1584: LDW R2 R28 -28
+	1588: LDW R4 R28 -28
+	1592: STW R3 R28 -64
+	1596: STW R2 R28 -92
+	1600: CMPI R1 R4 4
+	1604: BGE R1 117
+	1608: CMP R1 R4 R4
+	1612: BGE R1 52
+	1616: LDW R2 R28 -32
+	1620: LDW R5 R28 -28
+	1624: CMPI R1 R5 4
+	1628: BGE R1 45
+	1632: LDW R1 R28 -28
+	1636: CMP R1 R4 R1
+	1640: BGE R1 23
+	1644: LDW R1 R28 -20
+	1648: ADD R2 R2 R1
+	1652: LDW R3 R28 -48
+	1656: LDW R1 R28 -20
+	1660: MUL R1 R1 R3
+	1664: ADD R3 R2 R1
+	1668: MULI R1 R4 5
+	1672: ADD R1 R5 R1
+	1676: MULI R2 R1 4
+	1680: ADDI R1 R2 -80
+	1684: LDX R1 R30 R1
+	1688: ADD R3 R3 R1
+	1692: ADDI R2 R2 -160
+	1696: LDW R6 R28 -44
+	1700: LDW R1 R28 -20
+	1704: MUL R6 R6 R1
+	1708: ADD R2 R30 R2
+	1712: LDW R1 R2 0
+	1716: ADD R1 R6 R1
+	1720: STW R1 R2 0
+	1724: ADDI R2 R3 1
+	1728: BEQ R0 17
+	1732: LDW R3 R28 -76
+	1736: LDW R1 R28 -40
+	1740: MUL R1 R1 R3
+	1744: ADD R3 R2 R1
+	1748: MULI R1 R4 5
+	1752: ADD R1 R5 R1
+	1756: MULI R1 R1 4
+	1760: ADDI R1 R1 -160
+	1764: LDX R2 R30 R1
+	1768: ADD R3 R3 R2
+	1772: LDW R1 R28 -52
+	1776: ADD R1 R3 R1
+	1780: ADDI R1 R1 2349
+	1784: SUBI R1 R1 59
+	1788: ADD R1 R1 R2
+	1792: SUBI R2 R1 1
+	1796: ADDI R1 R5 1
+	1800: ADD R5 R0 R1
+	1804: BEQ R0 -45
+	1808: ADDI R3 R2 1
+	1812: ADD R2 R0 R5
+	1816: BEQ R0 58
+	1820: LDW R2 R28 -64
+	1824: LDW R5 R28 -28
+	1828: STW R2 R28 -32
+	1832: CMPI R1 R5 4
+	1836: BGE R1 50
+	1840: LDW R2 R28 -44
+	1844: LDW R1 R28 -20
+	1848: CMP R1 R1 R2
+	1852: BGE R1 21
+	1856: LDW R1 R28 -28
+	1860: MUL R2 R4 R1
+	1864: LDW R1 R28 -32
+	1868: ADD R6 R1 R2
+	1872: MULI R1 R4 5
+	1876: ADD R1 R5 R1
+	1880: MULI R1 R1 4
+	1884: ADDI R2 R1 -80
+	1888: ADD R3 R30 R2
+	1892: LDW R2 R3 0
+	1896: ADD R2 R6 R2
+	1900: LDW R6 R28 -48
+	1904: MULI R6 R6 75
+	1908: SUB R6 R6 R4
+	1912: ADDI R1 R1 -160
+	1916: LDX R1 R30 R1
+	1920: ADD R1 R6 R1
+	1924: STW R1 R3 0
+	1928: ADDI R2 R2 1
+	1932: BEQ R0 23
+	1936: MULI R1 R4 5
+	1940: ADD R1 R5 R1
+	1944: MULI R3 R1 4
+	1948: ADDI R2 R3 -160
+	1952: LDW R1 R28 -52
+	1956: ADDI R6 R1 44
+	1960: LDW R1 R28 -40
+	1964: ADD R6 R6 R1
+	1968: ADDI R1 R3 -80
+	1972: ADD R3 R30 R1
+	1976: LDW R1 R3 0
+	1980: ADD R1 R6 R1
+	1984: ADD R6 R30 R2
+	1988: STW R1 R6 0
+	1992: ADDI R25 R0 158
+	1996: SUB R1 R25 R4
+	2000: SUBI R2 R1 56
+	2004: LDW R1 R6 0
+	2008: ADD R1 R2 R1
+	2012: STW R1 R3 0
+	2016: LDW R1 R28 -32
+	2020: SUBI R2 R1 1
+	2024: ADDI R1 R5 1
+	2028: ADD R5 R0 R1
+	2032: BEQ R0 -51
+	2036: LDW R1 R28 -32
+	2040: SUBI R3 R1 1
+	2044: ADD R2 R0 R5
+	2048: STW R2 R28 -60
+	2052: ADDI R2 R4 1
+	2056: LDW R1 R28 -60
+	2060: ADD R4 R0 R2
+	2064: ADD R2 R0 R1
+	2068: BEQ R0 -119
+	2072: RDD R2
+	2076: STW R2 R28 -84
+	2080: LDW R1 R28 -84
+	2084: MULI R2 R1 8
+	2088: LDW R1 R28 -40
+	2092: ADD R2 R2 R1
+	2096: STW R2 R28 -88
+	2100: LDW R1 R28 -88
+	2104: MULI R1 R1 6
+	2108: ADDI R2 R1 10
+	2112: STW R2 R28 -36
+	2116: LDW R1 R28 -36
+	2120: MULI R2 R1 5
+	2124: LDW R1 R28 -64
+	2128: ADD R2 R2 R1
+	2132: STW R2 R28 -72
+	2136: LDW R1 R28 -72
+	2140: MULI R2 R1 8
+	2144: LDW R1 R28 -72
+	2148: ADD R2 R2 R1
+	2152: STW R2 R28 -4
+	2156: LDW R1 R28 -4
+	2160: MULI R2 R1 4
+	2164: LDW R1 R28 -84
+	2168: ADD R2 R2 R1
+	2172: STW R2 R28 -80
+	2176: LDW R2 R28 -84
+	2180: LDW R1 R28 -64
+	2184: ADD R2 R1 R2
+	2188: LDW R1 R28 -88
+	2192: ADD R2 R2 R1
+	2196: LDW R1 R28 -36
+	2200: ADD R2 R2 R1
+	2204: LDW R1 R28 -72
+	2208: ADD R2 R2 R1
+	2212: LDW R1 R28 -4
+	2216: ADD R2 R2 R1
+	2220: LDW R1 R28 -80
+	2224: ADD R2 R2 R1
+	2228: STW R2 R28 -96
+	2232: LDW R3 R28 -96
+	2236: LDW R2 R28 -92
+	2240: LDW R4 R28 -28
+	2244: STW R2 R28 -68
+	2248: CMPI R1 R4 4
+	2252: BGE R1 131
+	2256: LDW R1 R28 -4
+	2260: ADDI R25 R0 66
+	2264: CMP R1 R25 R1
+	2268: BGE R1 60
+	2272: LDW R2 R28 -56
+	2276: LDW R3 R28 -28
+	2280: CMPI R1 R3 4
+	2284: BGE R1 54
+	2288: LDW R1 R28 -28
+	2292: CMPI R1 R1 51
+	2296: BGE R1 27
+	2300: MULI R1 R4 5
+	2304: ADD R1 R3 R1
+	2308: MULI R6 R1 4
+	2312: ADDI R5 R6 -160
+	2316: STW R5 R28 -24
+	2320: LDW R1 R28 -88
+	2324: MULI R5 R1 89
+	2328: STW R5 R28 -8
+	2332: LDW R5 R28 -28
+	2336: LDW R1 R28 -8
+	2340: SUB R1 R5 R1
+	2344: SUB R5 R1 R4
+	2348: ADDI R1 R6 -80
+	2352: LDX R1 R30 R1
+	2356: ADD R6 R5 R1
+	2360: LDW R1 R28 -24
+	2364: ADD R5 R30 R1
+	2368: STW R6 R5 0
+	2372: LDW R1 R28 -80
+	2376: MUL R1 R4 R1
+	2380: MULI R1 R1 88
+	2384: ADD R2 R2 R1
+	2388: LDW R1 R5 0
+	2392: ADD R1 R2 R1
+	2396: ADDI R2 R1 1
+	2400: BEQ R0 22
+	2404: LDW R1 R28 -36
+	2408: ADD R2 R2 R1
+	2412: LDW R1 R28 -36
+	2416: SUB R2 R2 R1
+	2420: LDW R1 R28 -28
+	2424: SUB R2 R2 R1
+	2428: MULI R1 R4 5
+	2432: ADD R1 R3 R1
+	2436: MULI R5 R1 4
+	2440: ADDI R1 R5 -160
+	2444: LDX R1 R30 R1
+	2448: ADD R1 R2 R1
+	2452: ADDI R2 R1 66
+	2456: LDW R1 R28 -84
+	2460: ADD R2 R2 R1
+	2464: LDW R1 R28 -28
+	2468: ADD R2 R2 R1
+	2472: ADDI R1 R5 -80
+	2476: LDX R1 R30 R1
+	2480: ADD R1 R2 R1
+	2484: SUBI R2 R1 1
+	2488: ADDI R1 R3 1
+	2492: ADD R3 R0 R1
+	2496: BEQ R0 -54
+	2500: ADDI R2 R2 1
+	2504: BEQ R0 62
+	2508: LDW R1 R28 -28
+	2512: ADD R2 R0 R3
+	2516: ADD R3 R0 R1
+	2520: STW R2 R28 -56
+	2524: CMPI R1 R3 4
+	2528: BGE R1 54
+	2532: LDW R1 R28 -72
+	2536: CMP R1 R1 R3
+	2540: BGE R1 26
+	2544: MULI R1 R4 5
+	2548: ADD R1 R3 R1
+	2552: MULI R5 R1 4
+	2556: ADDI R2 R5 -80
+	2560: STW R2 R28 -12
+	2564: LDW R1 R28 -4
+	2568: ADDI R1 R1 76
+	2572: SUBI R1 R1 77
+	2576: SUBI R2 R1 32
+	2580: ADDI R1 R5 -160
+	2584: ADD R5 R30 R1
+	2588: LDW R1 R5 0
+	2592: ADD R2 R2 R1
+	2596: LDW R1 R28 -12
+	2600: STX R2 R30 R1
+	2604: LDW R2 R28 -56
+	2608: LDW R1 R28 -36
+	2612: ADD R2 R2 R1
+	2616: LDW R1 R28 -28
+	2620: SUB R1 R2 R1
+	2624: ADD R2 R1 R4
+	2628: LDW R1 R5 0
+	2632: ADD R1 R2 R1
+	2636: ADDI R2 R1 1
+	2640: BEQ R0 23
+	2644: LDW R2 R28 -56
+	2648: LDW R1 R28 -4
+	2652: ADD R1 R2 R1
+	2656: SUBI R1 R1 1258
+	2660: SUBI R6 R1 69
+	2664: MULI R1 R4 5
+	2668: ADD R1 R3 R1
+	2672: MULI R1 R1 4
+	2676: ADDI R1 R1 -80
+	2680: ADD R2 R30 R1
+	2684: LDW R5 R2 0
+	2688: ADD R6 R6 R5
+	2692: STW R6 R28 -16
+	2696: LDW R1 R28 -4
+	2700: ADDI R6 R1 92
+	2704: LDW R1 R28 -4
+	2708: ADD R1 R6 R1
+	2712: SUBI R1 R1 1
+	2716: ADD R1 R1 R5
+	2720: STW R1 R2 0
+	2724: LDW R1 R28 -16
+	2728: SUBI R2 R1 1
+	2732: ADDI R1 R3 1
+	2736: ADD R3 R0 R1
+	2740: BEQ R0 -55
+	2744: LDW R1 R28 -56
+	2748: SUBI R2 R1 1
+	2752: ADDI R1 R4 1
+	2756: ADD R4 R0 R1
+	2760: ADD R24 R0 R2
+	2764: ADD R2 R0 R3
+	2768: ADD R3 R0 R24
+	2772: BEQ R0 -132
+	2776: LDW R2 R28 -108
+	2780: LDW R1 R28 -104
+	2784: MUL R1 R2 R1
+	2788: ADD R1 R3 R1
+	2792: ADD R27 R0 R1
+	2796: ADD R29 R0 R28
+	2800: POP R28 R29 4
+	2804: POP R31 R29 4
+	2808: RET R31
+f1:
+	2812: PSH R31 R29 -4
+	2816: PSH R28 R29 -4
+	2820: ADD R28 R0 R29
+	2824: ADDI R25 R0 88
+	2828: SUB R29 R29 R25
+	2832: LDW R2 R28 8
+	2836: STW R2 R28 -88
+	2840: LDW R2 R28 12
+	2844: STW R2 R28 -84
+	2848: ADDI R2 R0 0
+	2852: STW R0 R28 -8
+	2856: RDD R2
+	2860: STW R2 R28 -52
+	2864: LDW R1 R28 -52
+	2868: MULI R1 R1 2
+	2872: ADDI R2 R1 10
+	2876: STW R2 R28 -20
+	2880: LDW R1 R28 -20
+	2884: MULI R2 R1 8
+	2888: LDW R1 R28 -20
+	2892: ADD R2 R2 R1
+	2896: STW R2 R28 -40
+	2900: LDW R1 R28 -40
+	2904: MULI R2 R1 5
+	2908: LDW R1 R28 -40
+	2912: ADD R2 R2 R1
+	2916: STW R2 R28 -48
+	2920: LDW R2 R28 -48
+	2924: LDW R1 R28 -8
+	2928: PSH R1 R29 -4
+	2932: PSH R2 R29 -4
+	2936: JSR 1380
+	2940: ADDI R29 R29 8
+	2944: ADD R2 R0 R27
+	2948: STW R2 R28 -60
+	2952: LDW R1 R28 -60
+	2956: MULI R2 R1 2
+	2960: LDW R1 R28 -8
+	2964: ADD R2 R2 R1
+	2968: STW R2 R28 -80
+	2972: LDW R2 R28 -52
+	2976: LDW R1 R28 -8
+	2980: ADD R2 R1 R2
+	2984: LDW R1 R28 -20
+	2988: ADD R2 R2 R1
+	2992: LDW R1 R28 -40
+	2996: ADD R2 R2 R1
+	3000: LDW R1 R28 -48
+	3004: ADD R2 R2 R1
+	3008: LDW R1 R28 -60
+	3012: ADD R2 R2 R1
+	3016: LDW R1 R28 -80
+	3020: ADD R2 R2 R1
+	3024: STW R2 R28 -72
+	3028: LDW R3 R28 -72
+	3032: LDW R2 R28 -8
+	3036: LDW R4 R28 -8
+	3040: STW R2 R28 -68
+	3044: CMPI R1 R4 4
+	3048: BGE R1 111
+	3052: CMP R1 R4 R4
+	3056: BGE R1 49
+	3060: LDW R2 R28 -12
+	3064: LDW R5 R28 -8
+	3068: CMPI R1 R5 4
+	3072: BGE R1 42
+	3076: LDW R1 R28 -8
+	3080: CMP R1 R4 R1
+	3084: BGE R1 20
+	3088: LDW R1 R28 -60
+	3092: MUL R1 R1 R5
+	3096: ADD R2 R2 R1
+	3100: LDW R1 R28 -48
+	3104: SUB R6 R2 R1
+	3108: MULI R1 R4 5
+	3112: ADD R1 R5 R1
+	3116: MULI R1 R1 4
+	3120: ADDI R2 R1 -80
+	3124: ADD R3 R30 R2
+	3128: LDW R2 R3 0
+	3132: ADD R2 R6 R2
+	3136: ADDI R6 R4 93
+	3140: ADDI R1 R1 -160
+	3144: LDX R1 R30 R1
+	3148: ADD R1 R6 R1
+	3152: STW R1 R3 0
+	3156: ADDI R2 R2 1
+	3160: BEQ R0 17
+	3164: ADDI R1 R2 61
+	3168: SUBI R1 R1 55
+	3172: ADDI R1 R1 12
+	3176: SUB R2 R1 R5
+	3180: MULI R1 R4 5
+	3184: ADD R1 R5 R1
+	3188: MULI R6 R1 4
+	3192: ADDI R1 R6 -160
+	3196: ADD R3 R30 R1
+	3200: LDW R1 R3 0
+	3204: ADD R2 R2 R1
+	3208: ADDI R1 R6 -80
+	3212: LDX R1 R30 R1
+	3216: ADDI R1 R1 81
+	3220: STW R1 R3 0
+	3224: SUBI R2 R2 1
+	3228: ADDI R1 R5 1
+	3232: ADD R5 R0 R1
+	3236: BEQ R0 -42
+	3240: ADDI R3 R2 1
+	3244: ADD R2 R0 R5
+	3248: BEQ R0 58
+	3252: LDW R5 R28 -8
+	3256: STW R3 R28 -12
+	3260: CMPI R1 R5 4
+	3264: BGE R1 51
+	3268: LDW R2 R28 -52
+	3272: LDW R1 R28 -40
+	3276: CMP R1 R2 R1
+	3280: BGE R1 21
+	3284: LDW R2 R28 -20
+	3288: LDW R1 R28 -12
+	3292: ADD R1 R1 R2
+	3296: SUB R2 R1 R4
+	3300: MULI R1 R4 5
+	3304: ADD R1 R5 R1
+	3308: MULI R3 R1 4
+	3312: ADDI R1 R3 -160
+	3316: LDX R1 R30 R1
+	3320: ADD R2 R2 R1
+	3324: LDW R1 R28 -20
+	3328: ADD R1 R2 R1
+	3332: ADDI R2 R1 3120
+	3336: LDW R1 R28 -8
+	3340: SUB R2 R2 R1
+	3344: ADDI R1 R3 -80
+	3348: LDX R1 R30 R1
+	3352: ADD R1 R2 R1
+	3356: ADDI R2 R1 1
+	3360: BEQ R0 23
+	3364: MULI R1 R4 5
+	3368: ADD R1 R5 R1
+	3372: MULI R3 R1 4
+	3376: ADDI R2 R3 -160
+	3380: LDW R6 R28 -20
+	3384: LDW R1 R28 -8
+	3388: SUB R6 R1 R6
+	3392: ADD R2 R30 R2
+	3396: LDW R1 R2 0
+	3400: ADD R1 R6 R1
+	3404: STW R1 R2 0
+	3408: ADDI R2 R3 -80
+	3412: LDW R1 R28 -8
+	3416: ADD R1 R1 R4
+	3420: SUBI R1 R1 76
+	3424: ADDI R3 R1 62
+	3428: ADD R2 R30 R2
+	3432: LDW R1 R2 0
+	3436: ADD R1 R3 R1
+	3440: STW R1 R2 0
+	3444: LDW R1 R28 -12
+	3448: SUBI R2 R1 1
+	3452: ADDI R1 R5 1
+	3456: ADD R3 R0 R2
+	3460: ADD R5 R0 R1
+	3464: BEQ R0 -52
+	3468: LDW R1 R28 -12
+	3472: SUBI R3 R1 1
+	3476: ADD R2 R0 R5
+	3480: ADDI R1 R4 1
+	3484: ADD R4 R0 R1
+	3488: BEQ R0 -112
+	3492: RDD R2
+	3496: STW R2 R28 -24
+	3500: LDW R1 R28 -24
+	3504: PSH R3 R29 -4
+	3508: ADDI R25 R0 35
+	3512: PSH R25 R29 -4
+	3516: PSH R1 R29 -4
+	3520: JSR 1380
+	3524: ADDI R29 R29 8
+	3528: POP R3 R29 4
+	3532: ADD R2 R0 R27
+	3536: STW R2 R28 -16
+	3540: LDW R1 R28 -16
+	3544: PSH R3 R29 -4
+	3548: PSH R1 R29 -4
+	3552: PSH R1 R29 -4
+	3556: JSR 1380
+	3560: ADDI R29 R29 8
+	3564: POP R3 R29 4
+	3568: ADD R2 R0 R27
+	3572: STW R2 R28 -64
+	3576: LDW R1 R28 -64
+	3580: MULI R2 R1 3
+	3584: LDW R1 R28 -60
+	3588: ADD R2 R2 R1
+	3592: STW R2 R28 -56
+	3596: LDW R1 R28 -56
+	3600: MULI R2 R1 5
+	3604: LDW R1 R28 -60
+	3608: ADD R2 R2 R1
+	3612: STW R2 R28 -44
+	3616: LDW R1 R28 -44
+	3620: MULI R1 R1 3
+	3624: ADDI R2 R1 72
+	3628: STW R2 R28 -36
+	3632: LDW R1 R28 -24
+	3636: ADD R2 R3 R1
+	3640: LDW R1 R28 -16
+	3644: ADD R2 R2 R1
+	3648: LDW R1 R28 -64
+	3652: ADD R2 R2 R1
+	3656: LDW R1 R28 -56
+	3660: ADD R2 R2 R1
+	3664: LDW R1 R28 -44
+	3668: ADD R2 R2 R1
+	3672: LDW R1 R28 -36
+	3676: ADD R2 R2 R1
+	3680: STW R2 R28 -76
+	3684: LDW R3 R28 -76
+	3688: LDW R2 R28 -68
+	3692: LDW R4 R28 -8
+	3696: STW R2 R28 -32
+	3700: CMPI R1 R4 4
+	3704: BGE R1 117
+	3708: LDW R2 R28 -44
+	3712: LDW R1 R28 -36
+	3716: CMP R1 R1 R2
+	3720: BGE R1 56
+	3724: LDW R6 R28 -28
+	3728: LDW R3 R28 -8
+	3732: CMPI R1 R3 4
+	3736: BGE R1 50
+	3740: LDW R2 R28 -36
+	3744: LDW R1 R28 -16
+	3748: CMP R1 R2 R1
+	3752: BGE R1 25
+	3756: MULI R1 R4 5
+	3760: ADD R1 R3 R1
+	3764: MULI R5 R1 4
+	3768: ADDI R2 R5 -160
+	3772: STW R2 R28 -4
+	3776: LDW R1 R28 -8
+	3780: MUL R1 R4 R1
+	3784: MUL R2 R1 R3
+	3788: LDW R1 R28 -16
+	3792: MUL R2 R2 R1
+	3796: ADDI R1 R5 -80
+	3800: LDX R1 R30 R1
+	3804: ADD R2 R2 R1
+	3808: LDW R1 R28 -4
+	3812: ADD R5 R30 R1
+	3816: STW R2 R5 0
+	3820: ADD R2 R6 R4
+	3824: LDW R1 R28 -56
+	3828: MULI R1 R1 60
+	3832: ADD R2 R2 R1
+	3836: LDW R1 R5 0
+	3840: ADD R1 R2 R1
+	3844: ADDI R2 R1 1
+	3848: BEQ R0 18
+	3852: ADD R2 R6 R4
+	3856: LDW R1 R28 -24
+	3860: ADD R1 R2 R1
+	3864: ADD R2 R1 R4
+	3868: MULI R1 R4 5
+	3872: ADD R1 R3 R1
+	3876: MULI R5 R1 4
+	3880: ADDI R1 R5 -80
+	3884: LDX R1 R30 R1
+	3888: ADD R2 R2 R1
+	3892: LDW R1 R28 -24
+	3896: MUL R1 R1 R3
+	3900: ADD R2 R2 R1
+	3904: ADDI R1 R5 -160
+	3908: LDX R1 R30 R1
+	3912: ADD R1 R2 R1
+	3916: SUBI R2 R1 1
+	3920: ADDI R1 R3 1
+	3924: ADD R6 R0 R2
+	3928: ADD R3 R0 R1
+	3932: BEQ R0 -50
+	3936: ADDI R2 R6 1
+	3940: BEQ R0 52
+	3944: LDW R1 R28 -8
+	3948: ADD R2 R0 R3
+	3952: ADD R3 R0 R1
+	3956: STW R2 R28 -28
+	3960: CMPI R1 R3 4
+	3964: BGE R1 44
+	3968: CMP R1 R4 R4
+	3972: BGE R1 21
+	3976: MULI R1 R4 5
+	3980: ADD R1 R3 R1
+	3984: MULI R1 R1 4
+	3988: ADDI R5 R1 -80
+	3992: LDW R1 R28 -8
+	3996: SUB R2 R3 R1
+	4000: ADD R5 R30 R5
+	4004: LDW R1 R5 0
+	4008: ADD R1 R2 R1
+	4012: STW R1 R5 0
+	4016: LDW R1 R28 -16
+	4020: MUL R1 R3 R1
+	4024: MULI R2 R1 90
+	4028: LDW R1 R28 -28
+	4032: ADD R1 R1 R2
+	4036: SUB R2 R1 R4
+	4040: LDW R1 R5 0
+	4044: ADD R1 R2 R1
+	4048: ADDI R2 R1 1
+	4052: BEQ R0 19
+	4056: LDW R2 R28 -64
+	4060: LDW R1 R28 -28
+	4064: ADD R1 R1 R2
+	4068: SUB R6 R1 R3
+	4072: MULI R1 R4 5
+	4076: ADD R1 R3 R1
+	4080: MULI R1 R1 4
+	4084: ADDI R2 R1 -80
+	4088: ADD R5 R30 R2
+	4092: LDW R2 R5 0
+	4096: ADD R2 R6 R2
+	4100: LDW R6 R28 -44
+	4104: MUL R6 R6 R4
+	4108: ADDI R1 R1 -160
+	4112: LDX R1 R30 R1
+	4116: ADD R1 R6 R1
+	4120: STW R1 R5 0
+	4124: SUBI R2 R2 1
+	4128: ADDI R1 R3 1
+	4132: ADD R3 R0 R1
+	4136: BEQ R0 -45
+	4140: LDW R1 R28 -28
+	4144: SUBI R2 R1 1
+	4148: ADDI R1 R4 1
+	4152: ADD R4 R0 R1
+	4156: ADD R24 R0 R2
+	4160: ADD R2 R0 R3
+	4164: ADD R3 R0 R24
+	4168: BEQ R0 -118
+	4172: LDW R2 R28 -88
+	4176: LDW R1 R28 -84
+	4180: MUL R1 R2 R1
+	4184: ADD R1 R3 R1
+	4188: ADD R27 R0 R1
+	4192: ADD R29 R0 R28
+	4196: POP R28 R29 4
+	4200: POP R31 R29 4
+	4204: RET R31
+f2:
+	4208: PSH R31 R29 -4
+	4212: PSH R28 R29 -4
+	4216: ADD R28 R0 R29
+	4220: ADDI R25 R0 108
+	4224: SUB R29 R29 R25
+	4228: LDW R2 R28 8
+	4232: STW R2 R28 -108
+	4236: LDW R2 R28 12
+	4240: STW R2 R28 -104
+	4244: ADDI R2 R0 0
+	4248: STW R0 R28 -40
+	4252: RDD R2
+	4256: STW R2 R28 -8
+	4260: LDW R1 R28 -8
+	4264: MULI R2 R1 3
+	4268: LDW R1 R28 -40
+	4272: ADD R2 R2 R1
+	4276: STW R2 R28 -68
+	4280: LDW R1 R28 -68
+	4284: ADDI R25 R0 78
+	4288: PSH R25 R29 -4
+	4292: PSH R1 R29 -4
+	4296: JSR 2812
+	4300: ADDI R29 R29 8
+	4304: ADD R2 R0 R27
+	4308: STW R2 R28 -92
+	4312: LDW R1 R28 -92
+	4316: MULI R1 R1 6
+	4320: ADDI R2 R1 5
+	4324: STW R2 R28 -100
+	4328: LDW R1 R28 -100
+	4332: MULI R1 R1 2
+	4336: ADDI R2 R1 67
+	4340: STW R2 R28 -64
+	4344: LDW R1 R28 -64
+	4348: MULI R2 R1 4
+	4352: LDW R1 R28 -8
+	4356: ADD R2 R2 R1
+	4360: STW R2 R28 -44
+	4364: LDW R2 R28 -40
+	4368: LDW R1 R28 -8
+	4372: ADD R2 R2 R1
+	4376: LDW R1 R28 -68
+	4380: ADD R2 R2 R1
+	4384: LDW R1 R28 -92
+	4388: ADD R2 R2 R1
+	4392: LDW R1 R28 -100
+	4396: ADD R2 R2 R1
+	4400: LDW R1 R28 -64
+	4404: ADD R2 R2 R1
+	4408: LDW R1 R28 -44
+	4412: ADD R2 R2 R1
+	4416: STW R2 R28 -80
+	4420: LDW R2 R28 -80
+	4424: LDW R3 R28 -40
+	4428: LDW R4 R28 -40
+	4432: STW R2 R28 -56
+	4436: STW R3 R28 -72
+	4440: CMPI R1 R4 4
+	4444: BGE R1 124
+	4448: LDW R2 R28 -100
+	4452: LDW R1 R28 -40
+	4456: CMP R1 R2 R1
+	4460: BGE R1 60
+	4464: LDW R3 R28 -40
+	4468: LDW R2 R28 -36
+	4472: STW R2 R28 -28
+	4476: CMPI R1 R3 4
+	4480: BGE R1 52
+	4484: ADDI R25 R0 60
+	4488: CMP R1 R25 R3
+	4492: BGE R1 28
+	4496: MULI R1 R4 5
+	4500: ADD R1 R3 R1
+	4504: MULI R5 R1 4
+	4508: ADDI R6 R5 -160
+	4512: LDW R1 R28 -68
+	4516: SUB R1 R1 R3
+	4520: SUB R2 R1 R3
+	4524: STW R2 R28 -20
+	4528: ADD R2 R30 R6
+	4532: LDW R6 R2 0
+	4536: LDW R1 R28 -20
+	4540: ADD R1 R1 R6
+	4544: STW R1 R2 0
+	4548: ADDI R2 R5 -80
+	4552: LDW R5 R28 -44
+	4556: LDW R1 R28 -8
+	4560: MUL R5 R1 R5
+	4564: LDW R1 R28 -8
+	4568: ADD R1 R5 R1
+	4572: SUB R5 R1 R3
+	4576: ADD R2 R30 R2
+	4580: LDW R1 R2 0
+	4584: ADD R1 R5 R1
+	4588: STW R1 R2 0
+	4592: LDW R1 R28 -28
+	4596: ADDI R2 R1 1
+	4600: BEQ R0 19
+	4604: MULI R1 R4 5
+	4608: ADD R1 R3 R1
+	4612: MULI R1 R1 4
+	4616: ADDI R2 R1 -160
+	4620: ADDI R5 R3 41
+	4624: ADDI R1 R1 -80
+	4628: LDX R1 R30 R1
+	4632: ADD R1 R5 R1
+	4636: ADD R5 R30 R2
+	4640: STW R1 R5 0
+	4644: MUL R2 R4 R3
+	4648: LDW R1 R28 -28
+	4652: ADD R1 R1 R2
+	4656: SUBI R1 R1 27
+	4660: ADDI R2 R1 34
+	4664: LDW R1 R5 0
+	4668: ADD R1 R2 R1
+	4672: SUBI R2 R1 1
+	4676: ADDI R1 R3 1
+	4680: ADD R3 R0 R1
+	4684: BEQ R0 -53
+	4688: LDW R1 R28 -28
+	4692: ADDI R2 R1 1
+	4696: BEQ R0 58
+	4700: LDW R2 R28 -56
+	4704: LDW R3 R28 -40
+	4708: STW R2 R28 -36
+	4712: CMPI R1 R3 4
+	4716: BGE R1 51
+	4720: LDW R1 R28 -40
+	4724: CMPI R1 R1 87
+	4728: BGE R1 20
+	4732: LDW R2 R28 -64
+	4736: LDW R1 R28 -36
+	4740: ADD R1 R1 R2
+	4744: ADDI R5 R1 25
+	4748: MULI R1 R4 5
+	4752: ADD R1 R3 R1
+	4756: MULI R1 R1 4
+	4760: ADDI R1 R1 -160
+	4764: LDX R2 R30 R1
+	4768: ADD R5 R5 R2
+	4772: LDW R1 R28 -40
+	4776: ADD R1 R5 R1
+	4780: ADDI R5 R1 57
+	4784: LDW R1 R28 -8
+	4788: SUB R1 R5 R1
+	4792: ADD R1 R1 R3
+	4796: ADD R1 R1 R2
+	4800: ADDI R2 R1 1
+	4804: BEQ R0 26
+	4808: MULI R1 R4 5
+	4812: ADD R1 R3 R1
+	4816: MULI R5 R1 4
+	4820: ADDI R2 R5 -160
+	4824: STW R2 R28 -16
+	4828: LDW R1 R28 -8
+	4832: MUL R1 R3 R1
+	4836: ADD R2 R1 R3
+	4840: ADDI R1 R5 -80
+	4844: ADD R6 R30 R1
+	4848: LDW R1 R6 0
+	4852: ADD R2 R2 R1
+	4856: LDW R1 R28 -16
+	4860: ADD R5 R30 R1
+	4864: STW R2 R5 0
+	4868: LDW R1 R28 -40
+	4872: ADDI R2 R1 28
+	4876: LDW R1 R28 -44
+	4880: SUB R1 R2 R1
+	4884: SUBI R2 R1 16
+	4888: LDW R1 R6 0
+	4892: ADD R1 R2 R1
+	4896: STW R1 R5 0
+	4900: LDW R1 R28 -36
+	4904: SUBI R2 R1 1
+	4908: ADDI R1 R3 1
+	4912: ADD R3 R0 R1
+	4916: BEQ R0 -52
+	4920: LDW R1 R28 -36
+	4924: SUBI R2 R1 1
+	4928: ADDI R1 R4 1
+	4932: ADD R4 R0 R1
+	4936: BEQ R0 -126
+	4940: RDD R2
+	4944: STW R2 R28 -96
+	4948: LDW R1 R28 -96
+	4952: MULI R1 R1 4
+	4956: ADDI R2 R1 84
+	4960: STW R2 R28 -24
+	4964: LDW R1 R28 -24
+	4968: MULI R2 R1 6
+	4972: LDW R1 R28 -56
+	4976: ADD R2 R2 R1
+	4980: STW R2 R28 -88
+	4984: LDW R1 R28 -88
+	4988: MULI R2 R1 2
+	4992: LDW R1 R28 -40
+	4996: ADD R2 R2 R1
+	5000: STW R2 R28 -84
+	5004: LDW R1 R28 -84
+	5008: MULI R1 R1 5
+	5012: ADDI R2 R1 11
+	5016: STW R2 R28 -48
+	5020: LDW R2 R28 -56
+	5024: LDW R1 R28 -48
+	5028: PSH R2 R29 -4
+	5032: PSH R1 R29 -4
+	5036: JSR 2812
+	5040: ADDI R29 R29 8
+	5044: ADD R2 R0 R27
+	5048: STW R2 R28 -32
+	5052: LDW R2 R28 -96
+	5056: LDW R1 R28 -56
+	5060: ADD R2 R1 R2
+	5064: LDW R1 R28 -24
+	5068: ADD R2 R2 R1
+	5072: LDW R1 R28 -88
+	5076: ADD R2 R2 R1
+	5080: LDW R1 R28 -84
+	5084: ADD R2 R2 R1
+	5088: LDW R1 R28 -48
+	5092: ADD R2 R2 R1
+	5096: LDW R1 R28 -32
+	5100: ADD R2 R2 R1
+	5104: STW R2 R28 -76
+	5108: LDW R3 R28 -76
+	5112: LDW R2 R28 -72
+	5116: LDW R4 R28 -40
+	5120: STW R2 R28 -60
+	5124: CMPI R1 R4 4
+	5128: BGE R1 114
+	5132: LDW R1 R28 -96
+	5136: CMP R1 R1 R4
+	5140: BGE R1 49
+	5144: LDW R2 R28 -52
+	5148: LDW R3 R28 -40
+	5152: CMPI R1 R3 4
+	5156: BGE R1 43
+	5160: ADDI R25 R0 67
+	5164: CMPI R1 R25 50
+	5168: BGE R1 24
+	5172: ADDI R2 R2 41
+	5176: LDW R1 R28 -48
+	5180: ADD R5 R2 R1
+	5184: MULI R1 R4 5
+	5188: ADD R1 R3 R1
+	5192: MULI R6 R1 4
+	5196: ADDI R1 R6 -80
+	5200: ADD R2 R30 R1
+	5204: LDW R1 R2 0
+	5208: ADD R5 R5 R1
+	5212: STW R5 R28 -12
+	5216: MULI R5 R4 62
+	5220: LDW R1 R28 -48
+	5224: ADD R5 R1 R5
+	5228: LDW R1 R28 -24
+	5232: SUB R5 R5 R1
+	5236: ADDI R1 R6 -160
+	5240: LDX R1 R30 R1
+	5244: ADD R1 R5 R1
+	5248: STW R1 R2 0
+	5252: LDW R1 R28 -12
+	5256: ADDI R2 R1 1
+	5260: BEQ R0 14
+	5264: LDW R1 R28 -24
+	5268: MULI R1 R1 51
+	5272: ADD R5 R2 R1
+	5276: MULI R1 R4 5
+	5280: ADD R1 R3 R1
+	5284: MULI R1 R1 4
+	5288: ADDI R1 R1 -160
+	5292: LDX R2 R30 R1
+	5296: ADD R1 R5 R2
+	5300: ADDI R1 R1 31
+	5304: ADD R1 R1 R3
+	5308: ADD R1 R1 R2
+	5312: SUBI R2 R1 1
+	5316: ADDI R1 R3 1
+	5320: ADD R3 R0 R1
+	5324: BEQ R0 -43
+	5328: ADDI R2 R2 1
+	5332: BEQ R0 57
+	5336: LDW R1 R28 -40
+	5340: ADD R2 R0 R3
+	5344: ADD R3 R0 R1
+	5348: STW R2 R28 -52
+	5352: CMPI R1 R3 4
+	5356: BGE R1 49
+	5360: ADDI R25 R0 86
+	5364: CMP R1 R25 R3
+	5368: BGE R1 25
+	5372: LDW R2 R28 -52
+	5376: LDW R1 R28 -24
+	5380: ADD R2 R2 R1
+	5384: LDW R1 R28 -40
+	5388: ADD R2 R2 R1
+	5392: LDW R1 R28 -32
+	5396: MULI R1 R1 4
+	5400: SUB R5 R2 R1
+	5404: MULI R1 R4 5
+	5408: ADD R1 R3 R1
+	5412: MULI R6 R1 4
+	5416: ADDI R1 R6 -160
+	5420: LDX R2 R30 R1
+	5424: ADD R5 R5 R2
+	5428: STW R5 R28 -4
+	5432: ADDI R5 R6 -80
+	5436: LDW R6 R28 -40
+	5440: LDW R1 R28 -32
+	5444: MUL R1 R1 R6
+	5448: ADD R2 R1 R2
+	5452: STX R2 R30 R5
+	5456: LDW R1 R28 -4
+	5460: ADDI R2 R1 1
+	5464: BEQ R0 19
+	5468: MULI R1 R4 5
+	5472: ADD R1 R3 R1
+	5476: MULI R1 R1 4
+	5480: ADDI R5 R1 -160
+	5484: LDW R1 R28 -32
+	5488: SUB R2 R4 R1
+	5492: ADD R5 R30 R5
+	5496: LDW R1 R5 0
+	5500: ADD R1 R2 R1
+	5504: STW R1 R5 0
+	5508: LDW R1 R28 -52
+	5512: ADD R1 R1 R3
+	5516: SUBI R1 R1 99
+	5520: ADD R1 R1 R3
+	5524: SUB R2 R1 R3
+	5528: LDW R1 R5 0
+	5532: ADD R1 R2 R1
+	5536: SUBI R2 R1 1
+	5540: ADDI R1 R3 1
+	5544: ADD R3 R0 R1
+	5548: BEQ R0 -50
+	5552: LDW R1 R28 -52
+	5556: SUBI R2 R1 1
+	5560: ADDI R1 R4 1
+	5564: ADD R4 R0 R1
+	5568: ADD R24 R0 R2
+	5572: ADD R2 R0 R3
+	5576: ADD R3 R0 R24
+	5580: BEQ R0 -115
+	5584: LDW R2 R28 -108
+	5588: LDW R1 R28 -104
+	5592: MUL R1 R2 R1
+	5596: ADD R1 R3 R1
+	5600: ADD R27 R0 R1
+	5604: ADD R29 R0 R28
+	5608: POP R28 R29 4
+	5612: POP R31 R29 4
+	5616: RET R31
+f3:
+	5620: PSH R31 R29 -4
+	5624: PSH R28 R29 -4
+	5628: ADD R28 R0 R29
+	5632: ADDI R25 R0 104
+	5636: SUB R29 R29 R25
+	5640: LDW R2 R28 8
+	5644: STW R2 R28 -104
+	5648: LDW R2 R28 12
+	5652: STW R2 R28 -100
+	5656: ADDI R2 R0 0
+	5660: STW R0 R28 -4
+	5664: RDD R2
+	5668: STW R2 R28 -52
+	5672: LDW R1 R28 -52
+	5676: MULI R1 R1 4
+	5680: ADDI R2 R1 1
+	5684: LDW R1 R28 -4
+	5688: ADD R2 R2 R1
+	5692: STW R2 R28 -84
+	5696: LDW R1 R28 -84
+	5700: MULI R2 R1 3
+	5704: LDW R1 R28 -4
+	5708: ADD R2 R2 R1
+	5712: STW R2 R28 -92
+	5716: LDW R1 R28 -92
+	5720: MULI R2 R1 6
+	5724: LDW R1 R28 -84
+	5728: ADD R2 R2 R1
+	5732: STW R2 R28 -28
+	5736: LDW R1 R28 -28
+	5740: MULI R2 R1 5
+	5744: LDW R1 R28 -52
+	5748: ADD R2 R2 R1
+	5752: STW R2 R28 -56
+	5756: LDW R2 R28 -56
+	5760: LDW R1 R28 -4
+	5764: PSH R1 R29 -4
+	5768: PSH R2 R29 -4
+	5772: JSR 4208
+	5776: ADDI R29 R29 8
+	5780: ADD R2 R0 R27
+	5784: STW R2 R28 -12
+	5788: LDW R2 R28 -52
+	5792: LDW R1 R28 -4
+	5796: ADD R2 R1 R2
+	5800: LDW R1 R28 -84
+	5804: ADD R2 R2 R1
+	5808: LDW R1 R28 -92
+	5812: ADD R2 R2 R1
+	5816: LDW R1 R28 -28
+	5820: ADD R2 R2 R1
+	5824: LDW R1 R28 -56
+	5828: ADD R2 R2 R1
+	5832: LDW R1 R28 -12
+	5836: ADD R2 R2 R1
+	5840: STW R2 R28 -88
+	5844: LDW R3 R28 -88
+	5848: LDW R2 R28 -4
+	5852: LDW R4 R28 -4
+	5856: STW R3 R28 -48
+	5860: STW R2 R28 -80
+	5864: CMPI R1 R4 4
+	5868: BGE R1 114
+	5872: LDW R1 R28 -52
+	5876: CMP R1 R4 R1
+	5880: BGE R1 51
+	5884: LDW R2 R28 -16
+	5888: LDW R5 R28 -4
+	5892: CMPI R1 R5 4
+	5896: BGE R1 42
+	5900: LDW R3 R28 -12
+	5904: LDW R1 R28 -4
+	5908: CMP R1 R3 R1
+	5912: BGE R1 20
+	5916: MULI R1 R4 5
+	5920: ADD R1 R5 R1
+	5924: MULI R3 R1 4
+	5928: ADDI R6 R3 -80
+	5932: STW R6 R28 -8
+	5936: LDW R1 R28 -28
+	5940: SUB R6 R1 R1
+	5944: ADDI R1 R3 -160
+	5948: ADD R3 R30 R1
+	5952: LDW R1 R3 0
+	5956: ADD R6 R6 R1
+	5960: LDW R1 R28 -8
+	5964: STX R6 R30 R1
+	5968: ADD R1 R2 R4
+	5972: ADDI R2 R1 22
+	5976: LDW R1 R3 0
+	5980: ADD R1 R2 R1
+	5984: ADDI R2 R1 1
+	5988: BEQ R0 16
+	5992: LDW R1 R28 -28
+	5996: ADD R1 R2 R1
+	6000: SUBI R3 R1 87
+	6004: MULI R1 R4 5
+	6008: ADD R1 R5 R1
+	6012: MULI R6 R1 4
+	6016: ADDI R1 R6 -80
+	6020: LDX R2 R30 R1
+	6024: ADD R3 R3 R2
+	6028: ADDI R6 R6 -160
+	6032: LDW R1 R28 -4
+	6036: ADD R1 R1 R4
+	6040: ADD R2 R1 R2
+	6044: STX R2 R30 R6
+	6048: SUBI R2 R3 1
+	6052: ADDI R1 R5 1
+	6056: ADD R5 R0 R1
+	6060: BEQ R0 -42
+	6064: ADDI R2 R2 1
+	6068: STW R2 R28 -36
+	6072: LDW R3 R28 -36
+	6076: ADD R2 R0 R5
+	6080: BEQ R0 55
+	6084: LDW R2 R28 -48
+	6088: LDW R5 R28 -4
+	6092: STW R2 R28 -16
+	6096: CMPI R1 R5 4
+	6100: BGE R1 45
+	6104: ADDI R25 R0 38
+	6108: CMPI R1 R25 84
+	6112: BGE R1 21
+	6116: LDW R2 R28 -16
+	6120: LDW R1 R28 -4
+	6124: ADD R2 R2 R1
+	6128: LDW R3 R28 -56
+	6132: LDW R1 R28 -12
+	6136: MUL R1 R3 R1
+	6140: ADD R2 R2 R1
+	6144: MULI R1 R4 5
+	6148: ADD R1 R5 R1
+	6152: MULI R1 R1 4
+	6156: ADDI R1 R1 -80
+	6160: ADD R3 R30 R1
+	6164: LDW R6 R3 0
+	6168: ADD R2 R2 R6
+	6172: LDW R1 R28 -12
+	6176: MUL R1 R1 R4
+	6180: ADD R1 R1 R6
+	6184: STW R1 R3 0
+	6188: ADDI R1 R2 1
+	6192: BEQ R0 19
+	6196: LDW R1 R28 -16
+	6200: ADD R1 R1 R5
+	6204: SUB R3 R1 R4
+	6208: MULI R1 R4 5
+	6212: ADD R1 R5 R1
+	6216: MULI R1 R1 4
+	6220: ADDI R1 R1 -80
+	6224: LDX R2 R30 R1
+	6228: ADD R3 R3 R2
+	6232: LDW R1 R28 -52
+	6236: ADD R1 R3 R1
+	6240: SUB R3 R1 R5
+	6244: LDW R1 R28 -12
+	6248: SUB R3 R3 R1
+	6252: LDW R1 R28 -4
+	6256: ADD R1 R3 R1
+	6260: ADD R1 R1 R2
+	6264: SUBI R1 R1 1
+	6268: ADDI R5 R5 1
+	6272: ADD R2 R0 R1
+	6276: BEQ R0 -46
+	6280: LDW R1 R28 -16
+	6284: SUBI R2 R1 1
+	6288: STW R2 R28 -32
+	6292: LDW R3 R28 -32
+	6296: ADD R2 R0 R5
+	6300: STW R2 R28 -40
+	6304: ADDI R2 R4 1
+	6308: LDW R1 R28 -40
+	6312: ADD R4 R0 R2
+	6316: ADD R2 R0 R1
+	6320: BEQ R0 -116
+	6324: RDD R2
+	6328: STW R2 R28 -60
+	6332: LDW R1 R28 -60
+	6336: MULI R2 R1 7
+	6340: LDW R1 R28 -12
+	6344: ADD R2 R2 R1
+	6348: STW R2 R28 -72
+	6352: LDW R2 R28 -72
+	6356: LDW R1 R28 -60
+	6360: PSH R1 R29 -4
+	6364: PSH R2 R29 -4
+	6368: JSR 4208
+	6372: ADDI R29 R29 8
+	6376: ADD R2 R0 R27
+	6380: STW R2 R28 -68
+	6384: LDW R2 R28 -68
+	6388: LDW R1 R28 -60
+	6392: PSH R1 R29 -4
+	6396: PSH R2 R29 -4
+	6400: JSR 4208
+	6404: ADDI R29 R29 8
+	6408: ADD R2 R0 R27
+	6412: STW R2 R28 -20
+	6416: LDW R1 R28 -20
+	6420: MULI R2 R1 6
+	6424: LDW R1 R28 -60
+	6428: ADD R2 R2 R1
+	6432: STW R2 R28 -24
+	6436: LDW R2 R28 -24
+	6440: LDW R1 R28 -4
+	6444: PSH R1 R29 -4
+	6448: PSH R2 R29 -4
+	6452: JSR 4208
+	6456: ADDI R29 R29 8
+	6460: ADD R2 R0 R27
+	6464: STW R2 R28 -64
+	6468: LDW R2 R28 -60
+	6472: LDW R1 R28 -48
+	6476: ADD R2 R1 R2
+	6480: LDW R1 R28 -72
+	6484: ADD R2 R2 R1
+	6488: LDW R1 R28 -68
+	6492: ADD R2 R2 R1
+	6496: LDW R1 R28 -20
+	6500: ADD R2 R2 R1
+	6504: LDW R1 R28 -24
+	6508: ADD R2 R2 R1
+	6512: LDW R1 R28 -64
+	6516: ADD R2 R2 R1
+	6520: STW R2 R28 -96
+	6524: LDW R3 R28 -96
+	6528: LDW R2 R28 -80
+	6532: LDW R4 R28 -4
+	6536: STW R2 R28 -76
+	6540: CMPI R1 R4 4
+	6544: BGE R1 112
+	6548: LDW R1 R28 -20
+	6552: CMP R1 R4 R1
+	6556: BGE R1 47
+	6560: LDW R2 R28 -44
+	6564: LDW R3 R28 -4
+	6568: CMPI R1 R3 4
+	6572: BGE R1 41
+	6576: LDW R1 R28 -20
+	6580: CMP R1 R1 R1
+	6584: BGE R1 17
+	6588: MULI R1 R3 80
+	6592: MUL R1 R1 R3
+	6596: ADD R5 R2 R1
+	6600: MULI R1 R4 5
+	6604: ADD R1 R3 R1
+	6608: MULI R6 R1 4
+	6612: ADDI R1 R6 -160
+	6616: LDX R2 R30 R1
+	6620: ADD R5 R5 R2
+	6624: ADDI R6 R6 -80
+	6628: LDW R1 R28 -4
+	6632: SUBI R1 R1 71
+	6636: ADD R2 R1 R2
+	6640: STX R2 R30 R6
+	6644: ADDI R2 R5 1
+	6648: BEQ R0 19
+	6652: LDW R1 R28 -60
+	6656: MUL R1 R1 R3
+	6660: ADD R5 R2 R1
+	6664: MULI R1 R4 5
+	6668: ADD R1 R3 R1
+	6672: MULI R1 R1 4
+	6676: ADDI R1 R1 -160
+	6680: LDX R2 R30 R1
+	6684: ADD R5 R5 R2
+	6688: LDW R1 R28 -24
+	6692: ADD R5 R5 R1
+	6696: LDW R1 R28 -72
+	6700: ADD R5 R5 R1
+	6704: LDW R1 R28 -24
+	6708: MULI R1 R1 61
+	6712: ADD R1 R5 R1
+	6716: ADD R1 R1 R2
+	6720: SUBI R2 R1 1
+	6724: ADDI R1 R3 1
+	6728: ADD R3 R0 R1
+	6732: BEQ R0 -41
+	6736: ADDI R2 R2 1
+	6740: BEQ R0 57
+	6744: LDW R1 R28 -4
+	6748: ADD R2 R0 R3
+	6752: ADD R3 R0 R1
+	6756: STW R2 R28 -44
+	6760: CMPI R1 R3 4
+	6764: BGE R1 49
+	6768: LDW R2 R28 -64
+	6772: LDW R1 R28 -4
+	6776: CMP R1 R2 R1
+	6780: BGE R1 22
+	6784: LDW R2 R28 -68
+	6788: LDW R1 R28 -44
+	6792: ADD R2 R1 R2
+	6796: LDW R1 R28 -20
+	6800: SUB R2 R2 R1
+	6804: MULI R1 R4 63
+	6808: ADD R2 R2 R1
+	6812: MULI R1 R4 5
+	6816: ADD R1 R3 R1
+	6820: MULI R5 R1 4
+	6824: ADDI R1 R5 -160
+	6828: LDX R1 R30 R1
+	6832: ADD R1 R2 R1
+	6836: ADDI R2 R1 84
+	6840: LDW R1 R28 -4
+	6844: SUB R2 R2 R1
+	6848: ADDI R1 R5 -80
+	6852: LDX R1 R30 R1
+	6856: ADD R1 R2 R1
+	6860: ADDI R2 R1 1
+	6864: BEQ R0 21
+	6868: MULI R1 R4 5
+	6872: ADD R1 R3 R1
+	6876: MULI R5 R1 4
+	6880: ADDI R6 R5 -160
+	6884: LDW R2 R28 -24
+	6888: LDW R1 R28 -4
+	6892: SUB R2 R1 R2
+	6896: ADDI R1 R5 -80
+	6900: ADD R5 R30 R1
+	6904: LDW R1 R5 0
+	6908: ADD R2 R2 R1
+	6912: STX R2 R30 R6
+	6916: LDW R1 R28 -44
+	6920: ADDI R2 R1 36
+	6924: MULI R1 R4 93
+	6928: MULI R1 R1 30
+	6932: SUB R2 R2 R1
+	6936: LDW R1 R5 0
+	6940: ADD R1 R2 R1
+	6944: SUBI R2 R1 1
+	6948: ADDI R1 R3 1
+	6952: ADD R3 R0 R1
+	6956: BEQ R0 -50
+	6960: LDW R1 R28 -44
+	6964: SUBI R2 R1 1
+	6968: ADDI R1 R4 1
+	6972: ADD R4 R0 R1
+	6976: ADD R24 R0 R2
+	6980: ADD R2 R0 R3
+	6984: ADD R3 R0 R24
+	6988: BEQ R0 -113
+	6992: LDW R2 R28 -104
+	6996: LDW R1 R28 -100
+	7000: MUL R1 R2 R1
+	7004: ADD R1 R3 R1
+	7008: ADD R27 R0 R1
+	7012: ADD R29 R0 R28
+	7016: POP R28 R29 4
+	7020: POP R31 R29 4
+	7024: RET R31
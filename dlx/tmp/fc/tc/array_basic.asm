@@ -0,0 +1,22 @@
+	0: ADDI R25 R0 40
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: RDD R1
+	20: RDD R2
+	24: RDD R4
+	28: MULI R1 R1 4
+	32: ADDI R1 R1 -40
+	36: ADD R2 R2 R4
+	40: ADD R1 R30 R1
+	44: STW R2 R1 0
+	48: LDW R3 R1 0
+	52: ADD R2 R3 R4
+	56: CMP R1 R2 R4
+	60: BGE R1 3
+	64: ADD R1 R0 R3
+	68: BEQ R0 2
+	72: ADD R1 R0 R4
+	76: ADD R1 R2 R3
+	80: RET R0
@@ -0,0 +1,13 @@
+	0: ADDI R25 R0 128
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: LDW R1 R30 -128
+	20: WRD R1
+	24: LDW R2 R30 -44
+	28: RDD R1
+	32: ADD R1 R2 R1
+	36: LDW R1 R30 -4
+	40: WRD R1
+	44: RET R0
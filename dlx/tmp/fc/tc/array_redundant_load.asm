@@ -0,0 +1,12 @@
+	0: ADDI R25 R0 40
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: RDD R1
+	20: MULI R1 R1 4
+	24: ADDI R1 R1 -40
+	28: LDX R1 R30 R1
+	32: WRD R1
+	36: WRD R1
+	40: RET R0
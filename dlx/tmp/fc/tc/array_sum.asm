@@ -0,0 +1,43 @@
+	0: ADDI R25 R0 40
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R2 R0 0
+	16: RDD R3
+	20: ADD R2 R0 R0
+	24: ADDI R1 R3 3
+	28: CMPI R1 R1 10
+	32: BGE R1 23
+	36: MULI R1 R3 4
+	40: ADDI R1 R1 -40
+	44: LDX R1 R30 R1
+	48: ADD R2 R2 R1
+	52: ADDI R3 R3 1
+	56: MULI R1 R3 4
+	60: ADDI R1 R1 -40
+	64: LDX R1 R30 R1
+	68: ADD R2 R2 R1
+	72: ADDI R3 R3 1
+	76: MULI R1 R3 4
+	80: ADDI R1 R1 -40
+	84: LDX R1 R30 R1
+	88: ADD R2 R2 R1
+	92: ADDI R3 R3 1
+	96: MULI R1 R3 4
+	100: ADDI R1 R1 -40
+	104: LDX R1 R30 R1
+	108: ADD R2 R2 R1
+	112: ADDI R1 R3 1
+	116: ADD R3 R0 R1
+	120: BEQ R0 -24
+	124: CMPI R1 R3 10
+	128: BGE R1 8
+	132: MULI R1 R3 4
+	136: ADDI R1 R1 -40
+	140: LDX R1 R30 R1
+	144: ADD R2 R2 R1
+	148: ADDI R1 R3 1
+	152: ADD R3 R0 R1
+	156: BEQ R0 -8
+	160: WRD R2
+	164: RET R0
@@ -0,0 +1,1345 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: JSR 20
+	16: RET R0
+foo:
+	20: PSH R31 R29 -4
+	24: PSH R28 R29 -4
+	28: ADD R28 R0 R29
+	32: ADDI R2 R0 0
+	36: ADDI R4 R0 1
+	40: ADD R2 R0 R0
+	44: ADDI R3 R0 1
+	48: CMPI R1 R3 4
+	52: BGE R1 6
+	56: RDD R2
+	60: WRD R2
+	64: ADDI R1 R3 1
+	68: ADD R3 R0 R1
+	72: BEQ R0 -6
+	76: ADDI R3 R0 1
+	80: CMPI R1 R3 4
+	84: BGE R1 6
+	88: RDD R2
+	92: WRD R2
+	96: ADDI R1 R3 1
+	100: ADD R3 R0 R1
+	104: BEQ R0 -6
+	108: ADDI R3 R0 1
+	112: CMPI R1 R3 4
+	116: BGE R1 6
+	120: RDD R2
+	124: WRD R2
+	128: ADDI R1 R3 1
+	132: ADD R3 R0 R1
+	136: BEQ R0 -6
+	140: ADDI R3 R0 1
+	144: CMPI R1 R3 4
+	148: BGE R1 6
+	152: RDD R2
+	156: WRD R2
+	160: ADDI R1 R3 1
+	164: ADD R3 R0 R1
+	168: BEQ R0 -6
+	172: ADDI R3 R0 1
+	176: CMPI R1 R3 4
+	180: BGE R1 6
+	184: RDD R2
+	188: WRD R2
+	192: ADDI R1 R3 1
+	196: ADD R3 R0 R1
+	200: BEQ R0 -6
+	204: ADDI R3 R0 1
+	208: CMPI R1 R3 4
+	212: BGE R1 6
+	216: RDD R2
+	220: WRD R2
+	224: ADDI R1 R3 1
+	228: ADD R3 R0 R1
+	232: BEQ R0 -6
+	236: ADDI R3 R0 1
+	240: CMPI R1 R3 4
+	244: BGE R1 6
+	248: RDD R2
+	252: WRD R2
+	256: ADDI R1 R3 1
+	260: ADD R3 R0 R1
+	264: BEQ R0 -6
+	268: ADDI R3 R0 1
+	272: CMPI R1 R3 4
+	276: BGE R1 6
+	280: RDD R2
+	284: WRD R2
+	288: ADDI R1 R3 1
+	292: ADD R3 R0 R1
+	296: BEQ R0 -6
+	300: ADDI R3 R0 1
+	304: CMPI R1 R3 4
+	308: BGE R1 6
+	312: RDD R2
+	316: WRD R2
+	320: ADDI R1 R3 1
+	324: ADD R3 R0 R1
+	328: BEQ R0 -6
+	332: ADDI R3 R0 1
+	336: CMPI R1 R3 4
+	340: BGE R1 6
+	344: RDD R2
+	348: WRD R2
+	352: ADDI R1 R3 1
+	356: ADD R3 R0 R1
+	360: BEQ R0 -6
+	364: ADDI R3 R0 1
+	368: CMPI R1 R3 4
+	372: BGE R1 6
+	376: RDD R2
+	380: WRD R2
+	384: ADDI R1 R3 1
+	388: ADD R3 R0 R1
+	392: BEQ R0 -6
+	396: ADDI R3 R0 1
+	400: CMPI R1 R3 4
+	404: BGE R1 6
+	408: RDD R2
+	412: WRD R2
+	416: ADDI R1 R3 1
+	420: ADD R3 R0 R1
+	424: BEQ R0 -6
+	428: ADDI R3 R0 1
+	432: CMPI R1 R3 4
+	436: BGE R1 6
+	440: RDD R2
+	444: WRD R2
+	448: ADDI R1 R3 1
+	452: ADD R3 R0 R1
+	456: BEQ R0 -6
+	460: ADDI R3 R0 1
+	464: CMPI R1 R3 4
+	468: BGE R1 6
+	472: RDD R2
+	476: WRD R2
+	480: ADDI R1 R3 1
+	484: ADD R3 R0 R1
+	488: BEQ R0 -6
+	492: ADDI R3 R0 1
+	496: CMPI R1 R3 4
+	500: BGE R1 6
+	504: RDD R2
+	508: WRD R2
+	512: ADDI R1 R3 1
+	516: ADD R3 R0 R1
+	520: BEQ R0 -6
+	524: ADDI R3 R0 1
+	528: CMPI R1 R3 4
+	532: BGE R1 6
+	536: RDD R2
+	540: WRD R2
+	544: ADDI R1 R3 1
+	548: ADD R3 R0 R1
+	552: BEQ R0 -6
+	556: ADDI R3 R0 1
+	560: CMPI R1 R3 4
+	564: BGE R1 6
+	568: RDD R2
+	572: WRD R2
+	576: ADDI R1 R3 1
+	580: ADD R3 R0 R1
+	584: BEQ R0 -6
+	588: ADDI R3 R0 1
+	592: CMPI R1 R3 4
+	596: BGE R1 6
+	600: RDD R2
+	604: WRD R2
+	608: ADDI R1 R3 1
+	612: ADD R3 R0 R1
+	616: BEQ R0 -6
+	620: ADDI R3 R0 1
+	624: CMPI R1 R3 4
+	628: BGE R1 6
+	632: RDD R2
+	636: WRD R2
+	640: ADDI R1 R3 1
+	644: ADD R3 R0 R1
+	648: BEQ R0 -6
+	652: ADDI R3 R0 1
+	656: CMPI R1 R3 4
+	660: BGE R1 6
+	664: RDD R2
+	668: WRD R2
+	672: ADDI R1 R3 1
+	676: ADD R3 R0 R1
+	680: BEQ R0 -6
+	684: ADDI R3 R0 1
+	688: CMPI R1 R3 4
+	692: BGE R1 6
+	696: RDD R2
+	700: WRD R2
+	704: ADDI R1 R3 1
+	708: ADD R3 R0 R1
+	712: BEQ R0 -6
+	716: ADDI R3 R0 1
+	720: CMPI R1 R3 4
+	724: BGE R1 6
+	728: RDD R2
+	732: WRD R2
+	736: ADDI R1 R3 1
+	740: ADD R3 R0 R1
+	744: BEQ R0 -6
+	748: ADDI R3 R0 1
+	752: CMPI R1 R3 4
+	756: BGE R1 6
+	760: RDD R2
+	764: WRD R2
+	768: ADDI R1 R3 1
+	772: ADD R3 R0 R1
+	776: BEQ R0 -6
+	780: ADDI R3 R0 1
+	784: CMPI R1 R3 4
+	788: BGE R1 6
+	792: RDD R2
+	796: WRD R2
+	800: ADDI R1 R3 1
+	804: ADD R3 R0 R1
+	808: BEQ R0 -6
+	812: ADDI R3 R0 1
+	816: CMPI R1 R3 4
+	820: BGE R1 6
+	824: RDD R2
+	828: WRD R2
+	832: ADDI R1 R3 1
+	836: ADD R3 R0 R1
+	840: BEQ R0 -6
+	844: ADDI R3 R0 1
+	848: CMPI R1 R3 4
+	852: BGE R1 6
+	856: RDD R2
+	860: WRD R2
+	864: ADDI R1 R3 1
+	868: ADD R3 R0 R1
+	872: BEQ R0 -6
+	876: ADDI R3 R0 1
+	880: CMPI R1 R3 4
+	884: BGE R1 6
+	888: RDD R2
+	892: WRD R2
+	896: ADDI R1 R3 1
+	900: ADD R3 R0 R1
+	904: BEQ R0 -6
+	908: ADDI R3 R0 1
+	912: CMPI R1 R3 4
+	916: BGE R1 6
+	920: RDD R2
+	924: WRD R2
+	928: ADDI R1 R3 1
+	932: ADD R3 R0 R1
+	936: BEQ R0 -6
+	940: ADDI R3 R0 1
+	944: CMPI R1 R3 4
+	948: BGE R1 6
+	952: RDD R2
+	956: WRD R2
+	960: ADDI R1 R3 1
+	964: ADD R3 R0 R1
+	968: BEQ R0 -6
+	972: ADDI R3 R0 1
+	976: CMPI R1 R3 4
+	980: BGE R1 6
+	984: RDD R2
+	988: WRD R2
+	992: ADDI R1 R3 1
+	996: ADD R3 R0 R1
+	1000: BEQ R0 -6
+	1004: ADDI R3 R0 1
+	1008: CMPI R1 R3 4
+	1012: BGE R1 6
+	1016: RDD R2
+	1020: WRD R2
+	1024: ADDI R1 R3 1
+	1028: ADD R3 R0 R1
+	1032: BEQ R0 -6
+	1036: ADDI R3 R0 1
+	1040: CMPI R1 R3 4
+	1044: BGE R1 6
+	1048: RDD R2
+	1052: WRD R2
+	1056: ADDI R1 R3 1
+	1060: ADD R3 R0 R1
+	1064: BEQ R0 -6
+	1068: ADDI R3 R0 1
+	1072: CMPI R1 R3 4
+	1076: BGE R1 6
+	1080: RDD R2
+	1084: WRD R2
+	1088: ADDI R1 R3 1
+	1092: ADD R3 R0 R1
+	1096: BEQ R0 -6
+	1100: ADDI R3 R0 1
+	1104: CMPI R1 R3 4
+	1108: BGE R1 6
+	1112: RDD R2
+	1116: WRD R2
+	1120: ADDI R1 R3 1
+	1124: ADD R3 R0 R1
+	1128: BEQ R0 -6
+	1132: ADDI R3 R0 1
+	1136: CMPI R1 R3 4
+	1140: BGE R1 6
+	1144: RDD R2
+	1148: WRD R2
+	1152: ADDI R1 R3 1
+	1156: ADD R3 R0 R1
+	1160: BEQ R0 -6
+	1164: ADDI R3 R0 1
+	1168: CMPI R1 R3 4
+	1172: BGE R1 6
+	1176: RDD R2
+	1180: WRD R2
+	1184: ADDI R1 R3 1
+	1188: ADD R3 R0 R1
+	1192: BEQ R0 -6
+	1196: ADDI R3 R0 1
+	1200: CMPI R1 R3 4
+	1204: BGE R1 6
+	1208: RDD R2
+	1212: WRD R2
+	1216: ADDI R1 R3 1
+	1220: ADD R3 R0 R1
+	1224: BEQ R0 -6
+	1228: ADDI R3 R0 1
+	1232: CMPI R1 R3 4
+	1236: BGE R1 6
+	1240: RDD R2
+	1244: WRD R2
+	1248: ADDI R1 R3 1
+	1252: ADD R3 R0 R1
+	1256: BEQ R0 -6
+	1260: ADDI R3 R0 1
+	1264: CMPI R1 R3 4
+	1268: BGE R1 6
+	1272: RDD R2
+	1276: WRD R2
+	1280: ADDI R1 R3 1
+	1284: ADD R3 R0 R1
+	1288: BEQ R0 -6
+	1292: ADDI R3 R0 1
+	1296: CMPI R1 R3 4
+	1300: BGE R1 6
+	1304: RDD R2
+	1308: WRD R2
+	1312: ADDI R1 R3 1
+	1316: ADD R3 R0 R1
+	1320: BEQ R0 -6
+	1324: ADDI R3 R0 1
+	1328: CMPI R1 R3 4
+	1332: BGE R1 6
+	1336: RDD R2
+	1340: WRD R2
+	1344: ADDI R1 R3 1
+	1348: ADD R3 R0 R1
+	1352: BEQ R0 -6
+	1356: ADDI R3 R0 1
+	1360: CMPI R1 R3 4
+	1364: BGE R1 6
+	1368: RDD R2
+	1372: WRD R2
+	1376: ADDI R1 R3 1
+	1380: ADD R3 R0 R1
+	1384: BEQ R0 -6
+	1388: ADDI R3 R0 1
+	1392: CMPI R1 R3 4
+	1396: BGE R1 6
+	1400: RDD R2
+	1404: WRD R2
+	1408: ADDI R1 R3 1
+	1412: ADD R3 R0 R1
+	1416: BEQ R0 -6
+	1420: ADDI R3 R0 1
+	1424: CMPI R1 R3 4
+	1428: BGE R1 6
+	1432: RDD R2
+	1436: WRD R2
+	1440: ADDI R1 R3 1
+	1444: ADD R3 R0 R1
+	1448: BEQ R0 -6
+	1452: ADDI R3 R0 1
+	1456: CMPI R1 R3 4
+	1460: BGE R1 6
+	1464: RDD R2
+	1468: WRD R2
+	1472: ADDI R1 R3 1
+	1476: ADD R3 R0 R1
+	1480: BEQ R0 -6
+	1484: ADDI R3 R0 1
+	1488: CMPI R1 R3 4
+	1492: BGE R1 6
+	1496: RDD R2
+	1500: WRD R2
+	1504: ADDI R1 R3 1
+	1508: ADD R3 R0 R1
+	1512: BEQ R0 -6
+	1516: ADDI R3 R0 1
+	1520: CMPI R1 R3 4
+	1524: BGE R1 6
+	1528: RDD R2
+	1532: WRD R2
+	1536: ADDI R1 R3 1
+	1540: ADD R3 R0 R1
+	1544: BEQ R0 -6
+	1548: ADDI R3 R0 1
+	1552: CMPI R1 R3 4
+	1556: BGE R1 6
+	1560: RDD R2
+	1564: WRD R2
+	1568: ADDI R1 R3 1
+	1572: ADD R3 R0 R1
+	1576: BEQ R0 -6
+	1580: ADDI R3 R0 1
+	1584: CMPI R1 R3 4
+	1588: BGE R1 6
+	1592: RDD R2
+	1596: WRD R2
+	1600: ADDI R1 R3 1
+	1604: ADD R3 R0 R1
+	1608: BEQ R0 -6
+	1612: ADDI R3 R0 1
+	1616: CMPI R1 R3 4
+	1620: BGE R1 6
+	1624: RDD R2
+	1628: WRD R2
+	1632: ADDI R1 R3 1
+	1636: ADD R3 R0 R1
+	1640: BEQ R0 -6
+	1644: ADDI R3 R0 1
+	1648: CMPI R1 R3 4
+	1652: BGE R1 6
+	1656: RDD R2
+	1660: WRD R2
+	1664: ADDI R1 R3 1
+	1668: ADD R3 R0 R1
+	1672: BEQ R0 -6
+	1676: ADDI R3 R0 1
+	1680: CMPI R1 R3 4
+	1684: BGE R1 6
+	1688: RDD R2
+	1692: WRD R2
+	1696: ADDI R1 R3 1
+	1700: ADD R3 R0 R1
+	1704: BEQ R0 -6
+	1708: ADDI R3 R0 1
+	1712: CMPI R1 R3 4
+	1716: BGE R1 6
+	1720: RDD R2
+	1724: WRD R2
+	1728: ADDI R1 R3 1
+	1732: ADD R3 R0 R1
+	1736: BEQ R0 -6
+	1740: ADDI R3 R0 1
+	1744: CMPI R1 R3 4
+	1748: BGE R1 6
+	1752: RDD R2
+	1756: WRD R2
+	1760: ADDI R1 R3 1
+	1764: ADD R3 R0 R1
+	1768: BEQ R0 -6
+	1772: ADDI R3 R0 1
+	1776: CMPI R1 R3 4
+	1780: BGE R1 6
+	1784: RDD R2
+	1788: WRD R2
+	1792: ADDI R1 R3 1
+	1796: ADD R3 R0 R1
+	1800: BEQ R0 -6
+	1804: ADDI R3 R0 1
+	1808: CMPI R1 R3 4
+	1812: BGE R1 6
+	1816: RDD R2
+	1820: WRD R2
+	1824: ADDI R1 R3 1
+	1828: ADD R3 R0 R1
+	1832: BEQ R0 -6
+	1836: ADDI R3 R0 1
+	1840: CMPI R1 R3 4
+	1844: BGE R1 6
+	1848: RDD R2
+	1852: WRD R2
+	1856: ADDI R1 R3 1
+	1860: ADD R3 R0 R1
+	1864: BEQ R0 -6
+	1868: ADDI R3 R0 1
+	1872: CMPI R1 R3 4
+	1876: BGE R1 6
+	1880: RDD R2
+	1884: WRD R2
+	1888: ADDI R1 R3 1
+	1892: ADD R3 R0 R1
+	1896: BEQ R0 -6
+	1900: ADDI R3 R0 1
+	1904: CMPI R1 R3 4
+	1908: BGE R1 6
+	1912: RDD R2
+	1916: WRD R2
+	1920: ADDI R1 R3 1
+	1924: ADD R3 R0 R1
+	1928: BEQ R0 -6
+	1932: ADDI R3 R0 1
+	1936: CMPI R1 R3 4
+	1940: BGE R1 6
+	1944: RDD R2
+	1948: WRD R2
+	1952: ADDI R1 R3 1
+	1956: ADD R3 R0 R1
+	1960: BEQ R0 -6
+	1964: ADDI R3 R0 1
+	1968: CMPI R1 R3 4
+	1972: BGE R1 6
+	1976: RDD R2
+	1980: WRD R2
+	1984: ADDI R1 R3 1
+	1988: ADD R3 R0 R1
+	1992: BEQ R0 -6
+	1996: ADDI R3 R0 1
+	2000: CMPI R1 R3 4
+	2004: BGE R1 6
+	2008: RDD R2
+	2012: WRD R2
+	2016: ADDI R1 R3 1
+	2020: ADD R3 R0 R1
+	2024: BEQ R0 -6
+	2028: ADDI R3 R0 1
+	2032: CMPI R1 R3 4
+	2036: BGE R1 6
+	2040: RDD R2
+	2044: WRD R2
+	2048: ADDI R1 R3 1
+	2052: ADD R3 R0 R1
+	2056: BEQ R0 -6
+	2060: ADDI R3 R0 1
+	2064: CMPI R1 R3 4
+	2068: BGE R1 6
+	2072: RDD R2
+	2076: WRD R2
+	2080: ADDI R1 R3 1
+	2084: ADD R3 R0 R1
+	2088: BEQ R0 -6
+	2092: ADDI R3 R0 1
+	2096: CMPI R1 R3 4
+	2100: BGE R1 6
+	2104: RDD R2
+	2108: WRD R2
+	2112: ADDI R1 R3 1
+	2116: ADD R3 R0 R1
+	2120: BEQ R0 -6
+	2124: ADDI R3 R0 1
+	2128: CMPI R1 R3 4
+	2132: BGE R1 6
+	2136: RDD R2
+	2140: WRD R2
+	2144: ADDI R1 R3 1
+	2148: ADD R3 R0 R1
+	2152: BEQ R0 -6
+	2156: ADDI R3 R0 1
+	2160: CMPI R1 R3 4
+	2164: BGE R1 6
+	2168: RDD R2
+	2172: WRD R2
+	2176: ADDI R1 R3 1
+	2180: ADD R3 R0 R1
+	2184: BEQ R0 -6
+	2188: ADDI R3 R0 1
+	2192: CMPI R1 R3 4
+	2196: BGE R1 6
+	2200: RDD R2
+	2204: WRD R2
+	2208: ADDI R1 R3 1
+	2212: ADD R3 R0 R1
+	2216: BEQ R0 -6
+	2220: ADDI R3 R0 1
+	2224: CMPI R1 R3 4
+	2228: BGE R1 6
+	2232: RDD R2
+	2236: WRD R2
+	2240: ADDI R1 R3 1
+	2244: ADD R3 R0 R1
+	2248: BEQ R0 -6
+	2252: ADDI R3 R0 1
+	2256: CMPI R1 R3 4
+	2260: BGE R1 6
+	2264: RDD R2
+	2268: WRD R2
+	2272: ADDI R1 R3 1
+	2276: ADD R3 R0 R1
+	2280: BEQ R0 -6
+	2284: ADDI R3 R0 1
+	2288: CMPI R1 R3 4
+	2292: BGE R1 6
+	2296: RDD R2
+	2300: WRD R2
+	2304: ADDI R1 R3 1
+	2308: ADD R3 R0 R1
+	2312: BEQ R0 -6
+	2316: ADDI R3 R0 1
+	2320: CMPI R1 R3 4
+	2324: BGE R1 6
+	2328: RDD R2
+	2332: WRD R2
+	2336: ADDI R1 R3 1
+	2340: ADD R3 R0 R1
+	2344: BEQ R0 -6
+	2348: ADDI R3 R0 1
+	2352: CMPI R1 R3 4
+	2356: BGE R1 6
+	2360: RDD R2
+	2364: WRD R2
+	2368: ADDI R1 R3 1
+	2372: ADD R3 R0 R1
+	2376: BEQ R0 -6
+	2380: ADDI R3 R0 1
+	2384: CMPI R1 R3 4
+	2388: BGE R1 6
+	2392: RDD R2
+	2396: WRD R2
+	2400: ADDI R1 R3 1
+	2404: ADD R3 R0 R1
+	2408: BEQ R0 -6
+	2412: ADDI R3 R0 1
+	2416: CMPI R1 R3 4
+	2420: BGE R1 6
+	2424: RDD R2
+	2428: WRD R2
+	2432: ADDI R1 R3 1
+	2436: ADD R3 R0 R1
+	2440: BEQ R0 -6
+	2444: ADDI R3 R0 1
+	2448: CMPI R1 R3 4
+	2452: BGE R1 6
+	2456: RDD R2
+	2460: WRD R2
+	2464: ADDI R1 R3 1
+	2468: ADD R3 R0 R1
+	2472: BEQ R0 -6
+	2476: ADDI R3 R0 1
+	2480: CMPI R1 R3 4
+	2484: BGE R1 6
+	2488: RDD R2
+	2492: WRD R2
+	2496: ADDI R1 R3 1
+	2500: ADD R3 R0 R1
+	2504: BEQ R0 -6
+	2508: ADDI R3 R0 1
+	2512: CMPI R1 R3 4
+	2516: BGE R1 6
+	2520: RDD R2
+	2524: WRD R2
+	2528: ADDI R1 R3 1
+	2532: ADD R3 R0 R1
+	2536: BEQ R0 -6
+	2540: ADDI R3 R0 1
+	2544: CMPI R1 R3 4
+	2548: BGE R1 6
+	2552: RDD R2
+	2556: WRD R2
+	2560: ADDI R1 R3 1
+	2564: ADD R3 R0 R1
+	2568: BEQ R0 -6
+	2572: ADDI R3 R0 1
+	2576: CMPI R1 R3 4
+	2580: BGE R1 6
+	2584: RDD R2
+	2588: WRD R2
+	2592: ADDI R1 R3 1
+	2596: ADD R3 R0 R1
+	2600: BEQ R0 -6
+	2604: ADDI R3 R0 1
+	2608: CMPI R1 R3 4
+	2612: BGE R1 6
+	2616: RDD R2
+	2620: WRD R2
+	2624: ADDI R1 R3 1
+	2628: ADD R3 R0 R1
+	2632: BEQ R0 -6
+	2636: ADDI R3 R0 1
+	2640: CMPI R1 R3 4
+	2644: BGE R1 6
+	2648: RDD R2
+	2652: WRD R2
+	2656: ADDI R1 R3 1
+	2660: ADD R3 R0 R1
+	2664: BEQ R0 -6
+	2668: ADDI R3 R0 1
+	2672: CMPI R1 R3 4
+	2676: BGE R1 6
+	2680: RDD R2
+	2684: WRD R2
+	2688: ADDI R1 R3 1
+	2692: ADD R3 R0 R1
+	2696: BEQ R0 -6
+	2700: ADDI R3 R0 1
+	2704: CMPI R1 R3 4
+	2708: BGE R1 6
+	2712: RDD R2
+	2716: WRD R2
+	2720: ADDI R1 R3 1
+	2724: ADD R3 R0 R1
+	2728: BEQ R0 -6
+	2732: ADDI R3 R0 1
+	2736: CMPI R1 R3 4
+	2740: BGE R1 6
+	2744: RDD R2
+	2748: WRD R2
+	2752: ADDI R1 R3 1
+	2756: ADD R3 R0 R1
+	2760: BEQ R0 -6
+	2764: ADDI R3 R0 1
+	2768: CMPI R1 R3 4
+	2772: BGE R1 6
+	2776: RDD R2
+	2780: WRD R2
+	2784: ADDI R1 R3 1
+	2788: ADD R3 R0 R1
+	2792: BEQ R0 -6
+	2796: ADDI R3 R0 1
+	2800: CMPI R1 R3 4
+	2804: BGE R1 6
+	2808: RDD R2
+	2812: WRD R2
+	2816: ADDI R1 R3 1
+	2820: ADD R3 R0 R1
+	2824: BEQ R0 -6
+	2828: ADDI R3 R0 1
+	2832: CMPI R1 R3 4
+	2836: BGE R1 6
+	2840: RDD R2
+	2844: WRD R2
+	2848: ADDI R1 R3 1
+	2852: ADD R3 R0 R1
+	2856: BEQ R0 -6
+	2860: ADDI R3 R0 1
+	2864: CMPI R1 R3 4
+	2868: BGE R1 6
+	2872: RDD R2
+	2876: WRD R2
+	2880: ADDI R1 R3 1
+	2884: ADD R3 R0 R1
+	2888: BEQ R0 -6
+	2892: ADDI R3 R0 1
+	2896: CMPI R1 R3 4
+	2900: BGE R1 6
+	2904: RDD R2
+	2908: WRD R2
+	2912: ADDI R1 R3 1
+	2916: ADD R3 R0 R1
+	2920: BEQ R0 -6
+	2924: ADDI R3 R0 1
+	2928: CMPI R1 R3 4
+	2932: BGE R1 6
+	2936: RDD R2
+	2940: WRD R2
+	2944: ADDI R1 R3 1
+	2948: ADD R3 R0 R1
+	2952: BEQ R0 -6
+	2956: ADDI R3 R0 1
+	2960: CMPI R1 R3 4
+	2964: BGE R1 6
+	2968: RDD R2
+	2972: WRD R2
+	2976: ADDI R1 R3 1
+	2980: ADD R3 R0 R1
+	2984: BEQ R0 -6
+	2988: ADDI R3 R0 1
+	2992: CMPI R1 R3 4
+	2996: BGE R1 6
+	3000: RDD R2
+	3004: WRD R2
+	3008: ADDI R1 R3 1
+	3012: ADD R3 R0 R1
+	3016: BEQ R0 -6
+	3020: ADDI R3 R0 1
+	3024: CMPI R1 R3 4
+	3028: BGE R1 6
+	3032: RDD R2
+	3036: WRD R2
+	3040: ADDI R1 R3 1
+	3044: ADD R3 R0 R1
+	3048: BEQ R0 -6
+	3052: ADDI R3 R0 1
+	3056: CMPI R1 R3 4
+	3060: BGE R1 6
+	3064: RDD R2
+	3068: WRD R2
+	3072: ADDI R1 R3 1
+	3076: ADD R3 R0 R1
+	3080: BEQ R0 -6
+	3084: ADDI R3 R0 1
+	3088: CMPI R1 R3 4
+	3092: BGE R1 6
+	3096: RDD R2
+	3100: WRD R2
+	3104: ADDI R1 R3 1
+	3108: ADD R3 R0 R1
+	3112: BEQ R0 -6
+	3116: ADDI R3 R0 1
+	3120: CMPI R1 R3 4
+	3124: BGE R1 6
+	3128: RDD R2
+	3132: WRD R2
+	3136: ADDI R1 R3 1
+	3140: ADD R3 R0 R1
+	3144: BEQ R0 -6
+	3148: ADDI R3 R0 1
+	3152: CMPI R1 R3 4
+	3156: BGE R1 6
+	3160: RDD R2
+	3164: WRD R2
+	3168: ADDI R1 R3 1
+	3172: ADD R3 R0 R1
+	3176: BEQ R0 -6
+	3180: ADDI R3 R0 1
+	3184: CMPI R1 R3 4
+	3188: BGE R1 6
+	3192: RDD R2
+	3196: WRD R2
+	3200: ADDI R1 R3 1
+	3204: ADD R3 R0 R1
+	3208: BEQ R0 -6
+	3212: ADDI R3 R0 1
+	3216: CMPI R1 R3 4
+	3220: BGE R1 6
+	3224: RDD R2
+	3228: WRD R2
+	3232: ADDI R1 R3 1
+	3236: ADD R3 R0 R1
+	3240: BEQ R0 -6
+	3244: ADDI R3 R0 1
+	3248: CMPI R1 R3 4
+	3252: BGE R1 6
+	3256: RDD R2
+	3260: WRD R2
+	3264: ADDI R1 R3 1
+	3268: ADD R3 R0 R1
+	3272: BEQ R0 -6
+	3276: ADDI R3 R0 1
+	3280: CMPI R1 R3 4
+	3284: BGE R1 6
+	3288: RDD R2
+	3292: WRD R2
+	3296: ADDI R1 R3 1
+	3300: ADD R3 R0 R1
+	3304: BEQ R0 -6
+	3308: ADDI R3 R0 1
+	3312: CMPI R1 R3 4
+	3316: BGE R1 6
+	3320: RDD R2
+	3324: WRD R2
+	3328: ADDI R1 R3 1
+	3332: ADD R3 R0 R1
+	3336: BEQ R0 -6
+	3340: ADDI R3 R0 1
+	3344: CMPI R1 R3 4
+	3348: BGE R1 6
+	3352: RDD R2
+	3356: WRD R2
+	3360: ADDI R1 R3 1
+	3364: ADD R3 R0 R1
+	3368: BEQ R0 -6
+	3372: ADDI R3 R0 1
+	3376: CMPI R1 R3 4
+	3380: BGE R1 6
+	3384: RDD R2
+	3388: WRD R2
+	3392: ADDI R1 R3 1
+	3396: ADD R3 R0 R1
+	3400: BEQ R0 -6
+	3404: ADDI R3 R0 1
+	3408: CMPI R1 R3 4
+	3412: BGE R1 6
+	3416: RDD R2
+	3420: WRD R2
+	3424: ADDI R1 R3 1
+	3428: ADD R3 R0 R1
+	3432: BEQ R0 -6
+	3436: ADDI R3 R0 1
+	3440: CMPI R1 R3 4
+	3444: BGE R1 6
+	3448: RDD R2
+	3452: WRD R2
+	3456: ADDI R1 R3 1
+	3460: ADD R3 R0 R1
+	3464: BEQ R0 -6
+	3468: ADDI R3 R0 1
+	3472: CMPI R1 R3 4
+	3476: BGE R1 6
+	3480: RDD R2
+	3484: WRD R2
+	3488: ADDI R1 R3 1
+	3492: ADD R3 R0 R1
+	3496: BEQ R0 -6
+	3500: ADDI R3 R0 1
+	3504: CMPI R1 R3 4
+	3508: BGE R1 6
+	3512: RDD R2
+	3516: WRD R2
+	3520: ADDI R1 R3 1
+	3524: ADD R3 R0 R1
+	3528: BEQ R0 -6
+	3532: ADDI R3 R0 1
+	3536: CMPI R1 R3 4
+	3540: BGE R1 6
+	3544: RDD R2
+	3548: WRD R2
+	3552: ADDI R1 R3 1
+	3556: ADD R3 R0 R1
+	3560: BEQ R0 -6
+	3564: ADDI R3 R0 1
+	3568: CMPI R1 R3 4
+	3572: BGE R1 6
+	3576: RDD R2
+	3580: WRD R2
+	3584: ADDI R1 R3 1
+	3588: ADD R3 R0 R1
+	3592: BEQ R0 -6
+	3596: ADDI R3 R0 1
+	3600: CMPI R1 R3 4
+	3604: BGE R1 6
+	3608: RDD R2
+	3612: WRD R2
+	3616: ADDI R1 R3 1
+	3620: ADD R3 R0 R1
+	3624: BEQ R0 -6
+	3628: ADDI R3 R0 1
+	3632: CMPI R1 R3 4
+	3636: BGE R1 6
+	3640: RDD R2
+	3644: WRD R2
+	3648: ADDI R1 R3 1
+	3652: ADD R3 R0 R1
+	3656: BEQ R0 -6
+	3660: ADDI R3 R0 1
+	3664: CMPI R1 R3 4
+	3668: BGE R1 6
+	3672: RDD R2
+	3676: WRD R2
+	3680: ADDI R1 R3 1
+	3684: ADD R3 R0 R1
+	3688: BEQ R0 -6
+	3692: ADDI R3 R0 1
+	3696: CMPI R1 R3 4
+	3700: BGE R1 6
+	3704: RDD R2
+	3708: WRD R2
+	3712: ADDI R1 R3 1
+	3716: ADD R3 R0 R1
+	3720: BEQ R0 -6
+	3724: ADDI R3 R0 1
+	3728: CMPI R1 R3 4
+	3732: BGE R1 6
+	3736: RDD R2
+	3740: WRD R2
+	3744: ADDI R1 R3 1
+	3748: ADD R3 R0 R1
+	3752: BEQ R0 -6
+	3756: ADDI R3 R0 1
+	3760: CMPI R1 R3 4
+	3764: BGE R1 6
+	3768: RDD R2
+	3772: WRD R2
+	3776: ADDI R1 R3 1
+	3780: ADD R3 R0 R1
+	3784: BEQ R0 -6
+	3788: ADDI R3 R0 1
+	3792: CMPI R1 R3 4
+	3796: BGE R1 6
+	3800: RDD R2
+	3804: WRD R2
+	3808: ADDI R1 R3 1
+	3812: ADD R3 R0 R1
+	3816: BEQ R0 -6
+	3820: ADDI R3 R0 1
+	3824: CMPI R1 R3 4
+	3828: BGE R1 6
+	3832: RDD R2
+	3836: WRD R2
+	3840: ADDI R1 R3 1
+	3844: ADD R3 R0 R1
+	3848: BEQ R0 -6
+	3852: ADDI R3 R0 1
+	3856: CMPI R1 R3 4
+	3860: BGE R1 6
+	3864: RDD R2
+	3868: WRD R2
+	3872: ADDI R1 R3 1
+	3876: ADD R3 R0 R1
+	3880: BEQ R0 -6
+	3884: ADDI R3 R0 1
+	3888: CMPI R1 R3 4
+	3892: BGE R1 6
+	3896: RDD R2
+	3900: WRD R2
+	3904: ADDI R1 R3 1
+	3908: ADD R3 R0 R1
+	3912: BEQ R0 -6
+	3916: ADDI R3 R0 1
+	3920: CMPI R1 R3 4
+	3924: BGE R1 6
+	3928: RDD R2
+	3932: WRD R2
+	3936: ADDI R1 R3 1
+	3940: ADD R3 R0 R1
+	3944: BEQ R0 -6
+	3948: ADDI R3 R0 1
+	3952: CMPI R1 R3 4
+	3956: BGE R1 6
+	3960: RDD R2
+	3964: WRD R2
+	3968: ADDI R1 R3 1
+	3972: ADD R3 R0 R1
+	3976: BEQ R0 -6
+	3980: ADDI R3 R0 1
+	3984: CMPI R1 R3 4
+	3988: BGE R1 6
+	3992: RDD R2
+	3996: WRD R2
+	4000: ADDI R1 R3 1
+	4004: ADD R3 R0 R1
+	4008: BEQ R0 -6
+	4012: ADDI R3 R0 1
+	4016: CMPI R1 R3 4
+	4020: BGE R1 6
+	4024: RDD R2
+	4028: WRD R2
+	4032: ADDI R1 R3 1
+	4036: ADD R3 R0 R1
+	4040: BEQ R0 -6
+	4044: ADDI R3 R0 1
+	4048: CMPI R1 R3 4
+	4052: BGE R1 6
+	4056: RDD R2
+	4060: WRD R2
+	4064: ADDI R1 R3 1
+	4068: ADD R3 R0 R1
+	4072: BEQ R0 -6
+	4076: ADDI R3 R0 1
+	4080: CMPI R1 R3 4
+	4084: BGE R1 6
+	4088: RDD R2
+	4092: WRD R2
+	4096: ADDI R1 R3 1
+	4100: ADD R3 R0 R1
+	4104: BEQ R0 -6
+	4108: ADDI R3 R0 1
+	4112: CMPI R1 R3 4
+	4116: BGE R1 6
+	4120: RDD R2
+	4124: WRD R2
+	4128: ADDI R1 R3 1
+	4132: ADD R3 R0 R1
+	4136: BEQ R0 -6
+	4140: ADDI R3 R0 1
+	4144: CMPI R1 R3 4
+	4148: BGE R1 6
+	4152: RDD R2
+	4156: WRD R2
+	4160: ADDI R1 R3 1
+	4164: ADD R3 R0 R1
+	4168: BEQ R0 -6
+	4172: ADDI R3 R0 1
+	4176: CMPI R1 R3 4
+	4180: BGE R1 6
+	4184: RDD R2
+	4188: WRD R2
+	4192: ADDI R1 R3 1
+	4196: ADD R3 R0 R1
+	4200: BEQ R0 -6
+	4204: ADDI R3 R0 1
+	4208: CMPI R1 R3 4
+	4212: BGE R1 6
+	4216: RDD R2
+	4220: WRD R2
+	4224: ADDI R1 R3 1
+	4228: ADD R3 R0 R1
+	4232: BEQ R0 -6
+	4236: ADDI R3 R0 1
+	4240: CMPI R1 R3 4
+	4244: BGE R1 6
+	4248: RDD R2
+	4252: WRD R2
+	4256: ADDI R1 R3 1
+	4260: ADD R3 R0 R1
+	4264: BEQ R0 -6
+	4268: ADDI R3 R0 1
+	4272: CMPI R1 R3 4
+	4276: BGE R1 6
+	4280: RDD R2
+	4284: WRD R2
+	4288: ADDI R1 R3 1
+	4292: ADD R3 R0 R1
+	4296: BEQ R0 -6
+	4300: ADDI R3 R0 1
+	4304: CMPI R1 R3 4
+	4308: BGE R1 6
+	4312: RDD R2
+	4316: WRD R2
+	4320: ADDI R1 R3 1
+	4324: ADD R3 R0 R1
+	4328: BEQ R0 -6
+	4332: ADDI R3 R0 1
+	4336: CMPI R1 R3 4
+	4340: BGE R1 6
+	4344: RDD R2
+	4348: WRD R2
+	4352: ADDI R1 R3 1
+	4356: ADD R3 R0 R1
+	4360: BEQ R0 -6
+	4364: ADDI R3 R0 1
+	4368: CMPI R1 R3 4
+	4372: BGE R1 6
+	4376: RDD R2
+	4380: WRD R2
+	4384: ADDI R1 R3 1
+	4388: ADD R3 R0 R1
+	4392: BEQ R0 -6
+	4396: ADDI R3 R0 1
+	4400: CMPI R1 R3 4
+	4404: BGE R1 6
+	4408: RDD R2
+	4412: WRD R2
+	4416: ADDI R1 R3 1
+	4420: ADD R3 R0 R1
+	4424: BEQ R0 -6
+	4428: ADDI R3 R0 1
+	4432: CMPI R1 R3 4
+	4436: BGE R1 6
+	4440: RDD R2
+	4444: WRD R2
+	4448: ADDI R1 R3 1
+	4452: ADD R3 R0 R1
+	4456: BEQ R0 -6
+	4460: ADDI R3 R0 1
+	4464: CMPI R1 R3 4
+	4468: BGE R1 6
+	4472: RDD R2
+	4476: WRD R2
+	4480: ADDI R1 R3 1
+	4484: ADD R3 R0 R1
+	4488: BEQ R0 -6
+	4492: ADDI R3 R0 1
+	4496: CMPI R1 R3 4
+	4500: BGE R1 6
+	4504: RDD R2
+	4508: WRD R2
+	4512: ADDI R1 R3 1
+	4516: ADD R3 R0 R1
+	4520: BEQ R0 -6
+	4524: ADDI R3 R0 1
+	4528: CMPI R1 R3 4
+	4532: BGE R1 6
+	4536: RDD R2
+	4540: WRD R2
+	4544: ADDI R1 R3 1
+	4548: ADD R3 R0 R1
+	4552: BEQ R0 -6
+	4556: ADDI R3 R0 1
+	4560: CMPI R1 R3 4
+	4564: BGE R1 6
+	4568: RDD R2
+	4572: WRD R2
+	4576: ADDI R1 R3 1
+	4580: ADD R3 R0 R1
+	4584: BEQ R0 -6
+	4588: ADDI R3 R0 1
+	4592: CMPI R1 R3 4
+	4596: BGE R1 6
+	4600: RDD R2
+	4604: WRD R2
+	4608: ADDI R1 R3 1
+	4612: ADD R3 R0 R1
+	4616: BEQ R0 -6
+	4620: ADDI R3 R0 1
+	4624: CMPI R1 R3 4
+	4628: BGE R1 6
+	4632: RDD R2
+	4636: WRD R2
+	4640: ADDI R1 R3 1
+	4644: ADD R3 R0 R1
+	4648: BEQ R0 -6
+	4652: ADDI R3 R0 1
+	4656: CMPI R1 R3 4
+	4660: BGE R1 6
+	4664: RDD R2
+	4668: WRD R2
+	4672: ADDI R1 R3 1
+	4676: ADD R3 R0 R1
+	4680: BEQ R0 -6
+	4684: ADDI R3 R0 1
+	4688: CMPI R1 R3 4
+	4692: BGE R1 6
+	4696: RDD R2
+	4700: WRD R2
+	4704: ADDI R1 R3 1
+	4708: ADD R3 R0 R1
+	4712: BEQ R0 -6
+	4716: ADDI R3 R0 1
+	4720: CMPI R1 R3 4
+	4724: BGE R1 6
+	4728: RDD R2
+	4732: WRD R2
+	4736: ADDI R1 R3 1
+	4740: ADD R3 R0 R1
+	4744: BEQ R0 -6
+	4748: ADDI R3 R0 1
+	4752: CMPI R1 R3 4
+	4756: BGE R1 6
+	4760: RDD R2
+	4764: WRD R2
+	4768: ADDI R1 R3 1
+	4772: ADD R3 R0 R1
+	4776: BEQ R0 -6
+	4780: ADDI R3 R0 1
+	4784: CMPI R1 R3 4
+	4788: BGE R1 6
+	4792: RDD R2
+	4796: WRD R2
+	4800: ADDI R1 R3 1
+	4804: ADD R3 R0 R1
+	4808: BEQ R0 -6
+	4812: ADDI R3 R0 1
+	4816: CMPI R1 R3 4
+	4820: BGE R1 6
+	4824: RDD R2
+	4828: WRD R2
+	4832: ADDI R1 R3 1
+	4836: ADD R3 R0 R1
+	4840: BEQ R0 -6
+	4844: ADDI R3 R0 1
+	4848: CMPI R1 R3 4
+	4852: BGE R1 6
+	4856: RDD R2
+	4860: WRD R2
+	4864: ADDI R1 R3 1
+	4868: ADD R3 R0 R1
+	4872: BEQ R0 -6
+	4876: ADDI R3 R0 1
+	4880: CMPI R1 R3 4
+	4884: BGE R1 6
+	4888: RDD R2
+	4892: WRD R2
+	4896: ADDI R1 R3 1
+	4900: ADD R3 R0 R1
+	4904: BEQ R0 -6
+	4908: ADDI R3 R0 1
+	4912: CMPI R1 R3 4
+	4916: BGE R1 6
+	4920: RDD R2
+	4924: WRD R2
+	4928: ADDI R1 R3 1
+	4932: ADD R3 R0 R1
+	4936: BEQ R0 -6
+	4940: ADDI R3 R0 1
+	4944: CMPI R1 R3 4
+	4948: BGE R1 6
+	4952: RDD R2
+	4956: WRD R2
+	4960: ADDI R1 R3 1
+	4964: ADD R3 R0 R1
+	4968: BEQ R0 -6
+	4972: ADDI R3 R0 1
+	4976: CMPI R1 R3 4
+	4980: BGE R1 6
+	4984: RDD R2
+	4988: WRD R2
+	4992: ADDI R1 R3 1
+	4996: ADD R3 R0 R1
+	5000: BEQ R0 -6
+	5004: ADDI R3 R0 1
+	5008: CMPI R1 R3 4
+	5012: BGE R1 6
+	5016: RDD R2
+	5020: WRD R2
+	5024: ADDI R1 R3 1
+	5028: ADD R3 R0 R1
+	5032: BEQ R0 -6
+	5036: ADDI R3 R0 1
+	5040: CMPI R1 R3 4
+	5044: BGE R1 6
+	5048: RDD R2
+	5052: WRD R2
+	5056: ADDI R1 R3 1
+	5060: ADD R3 R0 R1
+	5064: BEQ R0 -6
+	5068: ADDI R3 R0 1
+	5072: CMPI R1 R3 4
+	5076: BGE R1 6
+	5080: RDD R2
+	5084: WRD R2
+	5088: ADDI R1 R3 1
+	5092: ADD R3 R0 R1
+	5096: BEQ R0 -6
+	5100: ADDI R3 R0 1
+	5104: CMPI R1 R3 4
+	5108: BGE R1 6
+	5112: RDD R2
+	5116: WRD R2
+	5120: ADDI R1 R3 1
+	5124: ADD R3 R0 R1
+	5128: BEQ R0 -6
+	5132: ADDI R3 R0 1
+	5136: CMPI R1 R3 4
+	5140: BGE R1 6
+	5144: RDD R2
+	5148: WRD R2
+	5152: ADDI R1 R3 1
+	5156: ADD R3 R0 R1
+	5160: BEQ R0 -6
+	5164: ADDI R3 R0 1
+	5168: CMPI R1 R3 4
+	5172: BGE R1 6
+	5176: RDD R2
+	5180: WRD R2
+	5184: ADDI R1 R3 1
+	5188: ADD R3 R0 R1
+	5192: BEQ R0 -6
+	5196: ADDI R3 R0 1
+	5200: CMPI R1 R3 4
+	5204: BGE R1 6
+	5208: RDD R2
+	5212: WRD R2
+	5216: ADDI R1 R3 1
+	5220: ADD R3 R0 R1
+	5224: BEQ R0 -6
+	5228: ADDI R3 R0 1
+	5232: CMPI R1 R3 4
+	5236: BGE R1 6
+	5240: RDD R2
+	5244: WRD R2
+	5248: ADDI R1 R3 1
+	5252: ADD R3 R0 R1
+	5256: BEQ R0 -6
+	5260: ADDI R3 R0 1
+	5264: CMPI R1 R3 4
+	5268: BGE R1 6
+	5272: RDD R2
+	5276: WRD R2
+	5280: ADDI R1 R3 1
+	5284: ADD R3 R0 R1
+	5288: BEQ R0 -6
+	5292: ADDI R3 R0 1
+	5296: CMPI R1 R3 4
+	5300: BGE R1 6
+	5304: RDD R2
+	5308: WRD R2
+	5312: ADDI R1 R3 1
+	5316: ADD R3 R0 R1
+	5320: BEQ R0 -6
+	5324: ADDI R3 R0 1
+	5328: CMPI R1 R3 4
+	5332: BGE R1 6
+	5336: RDD R2
+	5340: WRD R2
+	5344: ADDI R1 R3 1
+	5348: ADD R3 R0 R1
+	5352: BEQ R0 -6
+	5356: ADD R29 R0 R28
+	5360: POP R28 R29 4
+	5364: POP R31 R29 4
+	5368: RET R31
@@ -0,0 +1,216 @@
+	0: ADDI R25 R0 16
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R6 R0 0
+	16: RDD R2
+	20: ADDI R5 R2 1
+	24: MULI R4 R5 2
+	28: SUB R3 R4 R2
+	32: ADD R6 R0 R0
+	36: CMPI R1 R6 4
+	40: BGE R1 135
+	44: PSH R2 R29 -4
+	48: PSH R3 R29 -4
+	52: PSH R4 R29 -4
+	56: PSH R5 R29 -4
+	60: PSH R6 R29 -4
+	64: PSH R3 R29 -4
+	68: PSH R6 R29 -4
+	72: JSR 768
+	76: ADDI R29 R29 8
+	80: POP R6 R29 4
+	84: POP R5 R29 4
+	88: POP R4 R29 4
+	92: POP R3 R29 4
+	96: POP R2 R29 4
+	100: ADD R1 R0 R27
+	104: ADD R2 R2 R1
+	108: ADDI R1 R6 5
+	112: PSH R2 R29 -4
+	116: PSH R3 R29 -4
+	120: PSH R4 R29 -4
+	124: PSH R5 R29 -4
+	128: PSH R6 R29 -4
+	132: PSH R1 R29 -4
+	136: JSR 636
+	140: ADDI R29 R29 4
+	144: POP R6 R29 4
+	148: POP R5 R29 4
+	152: POP R4 R29 4
+	156: POP R3 R29 4
+	160: POP R2 R29 4
+	164: ADD R1 R0 R27
+	168: ADD R2 R2 R1
+	172: ADDI R6 R6 1
+	176: PSH R2 R29 -4
+	180: PSH R3 R29 -4
+	184: PSH R4 R29 -4
+	188: PSH R5 R29 -4
+	192: PSH R6 R29 -4
+	196: PSH R3 R29 -4
+	200: PSH R6 R29 -4
+	204: JSR 768
+	208: ADDI R29 R29 8
+	212: POP R6 R29 4
+	216: POP R5 R29 4
+	220: POP R4 R29 4
+	224: POP R3 R29 4
+	228: POP R2 R29 4
+	232: ADD R1 R0 R27
+	236: ADD R2 R2 R1
+	240: ADDI R1 R6 5
+	244: PSH R2 R29 -4
+	248: PSH R3 R29 -4
+	252: PSH R4 R29 -4
+	256: PSH R5 R29 -4
+	260: PSH R6 R29 -4
+	264: PSH R1 R29 -4
+	268: JSR 636
+	272: ADDI R29 R29 4
+	276: POP R6 R29 4
+	280: POP R5 R29 4
+	284: POP R4 R29 4
+	288: POP R3 R29 4
+	292: POP R2 R29 4
+	296: ADD R1 R0 R27
+	300: ADD R2 R2 R1
+	304: ADDI R6 R6 1
+	308: PSH R2 R29 -4
+	312: PSH R3 R29 -4
+	316: PSH R4 R29 -4
+	320: PSH R5 R29 -4
+	324: PSH R6 R29 -4
+	328: PSH R3 R29 -4
+	332: PSH R6 R29 -4
+	336: JSR 768
+	340: ADDI R29 R29 8
+	344: POP R6 R29 4
+	348: POP R5 R29 4
+	352: POP R4 R29 4
+	356: POP R3 R29 4
+	360: POP R2 R29 4
+	364: ADD R1 R0 R27
+	368: ADD R2 R2 R1
+	372: ADDI R1 R6 5
+	376: PSH R2 R29 -4
+	380: PSH R3 R29 -4
+	384: PSH R4 R29 -4
+	388: PSH R5 R29 -4
+	392: PSH R6 R29 -4
+	396: PSH R1 R29 -4
+	400: JSR 636
+	404: ADDI R29 R29 4
+	408: POP R6 R29 4
+	412: POP R5 R29 4
+	416: POP R4 R29 4
+	420: POP R3 R29 4
+	424: POP R2 R29 4
+	428: ADD R1 R0 R27
+	432: ADD R2 R2 R1
+	436: ADDI R6 R6 1
+	440: PSH R2 R29 -4
+	444: PSH R3 R29 -4
+	448: PSH R4 R29 -4
+	452: PSH R5 R29 -4
+	456: PSH R6 R29 -4
+	460: PSH R3 R29 -4
+	464: PSH R6 R29 -4
+	468: JSR 768
+	472: ADDI R29 R29 8
+	476: POP R6 R29 4
+	480: POP R5 R29 4
+	484: POP R4 R29 4
+	488: POP R3 R29 4
+	492: POP R2 R29 4
+	496: ADD R1 R0 R27
+	500: ADD R2 R2 R1
+	504: ADDI R1 R6 5
+	508: PSH R2 R29 -4
+	512: PSH R3 R29 -4
+	516: PSH R4 R29 -4
+	520: PSH R5 R29 -4
+	524: PSH R6 R29 -4
+	528: PSH R1 R29 -4
+	532: JSR 636
+	536: ADDI R29 R29 4
+	540: POP R6 R29 4
+	544: POP R5 R29 4
+	548: POP R4 R29 4
+	552: POP R3 R29 4
+	556: POP R2 R29 4
+	560: ADD R1 R0 R27
+	564: ADD R2 R2 R1
+	568: ADDI R1 R6 1
+	572: ADD R6 R0 R1
+	576: BEQ R0 -135
+	580: WRD R2
+	584: WRD R5
+	588: WRD R4
+	592: WRD R3
+	596: LDW R2 R30 -16
+	600: LDW R1 R30 -12
+	604: ADD R2 R2 R1
+	608: LDW R1 R30 -8
+	612: ADD R2 R2 R1
+	616: LDW R1 R30 -4
+	620: ADD R1 R2 R1
+	624: WRD R1
+	628: WRL
+	632: RET R0
+fib:
+	636: PSH R31 R29 -4
+	640: PSH R28 R29 -4
+	644: ADD R28 R0 R29
+	648: LDW R3 R28 8
+	652: ADDI R1 R0 0
+	656: CMPI R1 R3 2
+	660: BGE R1 7
+	664: ADD R27 R0 R3
+	668: ADD R29 R0 R28
+	672: POP R28 R29 4
+	676: POP R31 R29 4
+	680: RET R31
+	684: BEQ R0 1
+	688: SUBI R1 R3 1
+	692: PSH R3 R29 -4
+	696: PSH R1 R29 -4
+	700: JSR 636
+	704: ADDI R29 R29 4
+	708: POP R3 R29 4
+	712: ADD R2 R0 R27
+	716: SUBI R1 R3 2
+	720: PSH R2 R29 -4
+	724: PSH R1 R29 -4
+	728: JSR 636
+	732: ADDI R29 R29 4
+	736: POP R2 R29 4
+	740: ADD R1 R0 R27
+	744: ADD R1 R2 R1
+	748: ADD R27 R0 R1
+	752: ADD R29 R0 R28
+	756: POP R28 R29 4
+	760: POP R31 R29 4
+	764: RET R31
+scale:
+	768: PSH R31 R29 -4
+	772: PSH R28 R29 -4
+	776: ADD R28 R0 R29
+	780: LDW R4 R28 8
+	784: LDW R3 R28 12
+	788: MULI R1 R4 4
+	792: ADDI R1 R1 -16
+	796: ADD R2 R30 R1
+	800: LDW R1 R2 0
+	804: ADD R1 R1 R3
+	808: STW R1 R2 0
+	812: MUL R1 R4 R3
+	816: ADDI R26 R0 1
+	820: LSHI R26 R26 16
+	824: ADDI R26 R26 -25536
+	828: ADD R1 R1 R26
+	832: ADD R27 R0 R1
+	836: ADD R29 R0 R28
+	840: POP R28 R29 4
+	844: POP R31 R29 4
+	848: RET R31
@@ -0,0 +1,262 @@
+	0: ADDI R25 R0 840
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: ADDI R1 R0 200
+	20: ADDI R1 R0 150
+	24: JSR 476
+	28: ADDI R26 R0 1
+	32: STW R26 R30 -804
+	36: ADDI R26 R0 1
+	40: STW R26 R30 -488
+	44: ADDI R26 R0 1
+	48: STW R26 R30 -408
+	52: ADDI R26 R0 1
+	56: STW R26 R30 -328
+	60: ADDI R26 R0 1
+	64: STW R26 R30 -8
+	68: ADDI R1 R0 110
+	72: JSR 172
+	76: JSR 940
+	80: RET R0
+SetNextBit:
+	84: PSH R31 R29 -4
+	88: PSH R28 R29 -4
+	92: ADD R28 R0 R29
+	96: LDW R4 R28 8
+	100: LDW R1 R28 12
+	104: LDW R3 R28 16
+	108: LDW R2 R28 20
+	112: MULI R1 R1 2
+	116: ADD R3 R3 R1
+	120: MULI R1 R4 4
+	124: ADD R1 R3 R1
+	128: MULI R1 R1 4
+	132: ADDI R4 R1 -840
+	136: DIVI R3 R2 2
+	140: MULI R1 R3 2
+	144: SUB R2 R2 R1
+	148: STX R2 R30 R4
+	152: ADD R27 R0 R3
+	156: ADD R29 R0 R28
+	160: POP R28 R29 4
+	164: POP R31 R29 4
+	168: RET R31
+InitRuleBin:
+	172: PSH R31 R29 -4
+	176: PSH R28 R29 -4
+	180: ADD R28 R0 R29
+	184: ADDI R1 R0 0
+	188: PSH R0 R29 -4
+	192: PSH R0 R29 -4
+	196: PSH R0 R29 -4
+	200: PSH R0 R29 -4
+	204: JSR 84
+	208: ADDI R29 R29 16
+	212: ADD R1 R0 R27
+	216: PSH R1 R29 -4
+	220: ADDI R25 R0 1
+	224: PSH R25 R29 -4
+	228: PSH R0 R29 -4
+	232: PSH R0 R29 -4
+	236: JSR 84
+	240: ADDI R29 R29 16
+	244: ADD R1 R0 R27
+	248: PSH R1 R29 -4
+	252: PSH R0 R29 -4
+	256: ADDI R25 R0 1
+	260: PSH R25 R29 -4
+	264: PSH R0 R29 -4
+	268: JSR 84
+	272: ADDI R29 R29 16
+	276: ADD R1 R0 R27
+	280: PSH R1 R29 -4
+	284: ADDI R25 R0 1
+	288: PSH R25 R29 -4
+	292: ADDI R25 R0 1
+	296: PSH R25 R29 -4
+	300: PSH R0 R29 -4
+	304: JSR 84
+	308: ADDI R29 R29 16
+	312: ADD R1 R0 R27
+	316: PSH R1 R29 -4
+	320: PSH R0 R29 -4
+	324: PSH R0 R29 -4
+	328: ADDI R25 R0 1
+	332: PSH R25 R29 -4
+	336: JSR 84
+	340: ADDI R29 R29 16
+	344: ADD R1 R0 R27
+	348: PSH R1 R29 -4
+	352: ADDI R25 R0 1
+	356: PSH R25 R29 -4
+	360: PSH R0 R29 -4
+	364: ADDI R25 R0 1
+	368: PSH R25 R29 -4
+	372: JSR 84
+	376: ADDI R29 R29 16
+	380: ADD R1 R0 R27
+	384: PSH R1 R29 -4
+	388: PSH R0 R29 -4
+	392: ADDI R25 R0 1
+	396: PSH R25 R29 -4
+	400: ADDI R25 R0 1
+	404: PSH R25 R29 -4
+	408: JSR 84
+	412: ADDI R29 R29 16
+	416: ADD R1 R0 R27
+	420: PSH R1 R29 -4
+	424: ADDI R25 R0 1
+	428: PSH R25 R29 -4
+	432: ADDI R25 R0 1
+	436: PSH R25 R29 -4
+	440: ADDI R25 R0 1
+	444: PSH R25 R29 -4
+	448: JSR 84
+	452: ADDI R29 R29 16
+	456: ADD R1 R0 R27
+	460: ADD R29 R0 R28
+	464: POP R28 R29 4
+	468: POP R31 R29 4
+	472: RET R31
+ClearData:
+	476: PSH R31 R29 -4
+	480: PSH R28 R29 -4
+	484: ADD R28 R0 R29
+	488: ADDI R3 R0 0
+	492: ADD R3 R0 R0
+	496: ADDI R2 R0 2
+	500: ADDI R1 R3 3
+	504: CMP R1 R1 R2
+	508: BGE R1 19
+	512: MULI R1 R3 4
+	516: ADDI R1 R1 -808
+	520: STX R0 R30 R1
+	524: ADDI R2 R3 1
+	528: MULI R1 R2 4
+	532: ADDI R1 R1 -808
+	536: STX R0 R30 R1
+	540: ADDI R2 R2 1
+	544: MULI R1 R2 4
+	548: ADDI R1 R1 -808
+	552: STX R0 R30 R1
+	556: ADDI R2 R2 1
+	560: MULI R1 R2 4
+	564: ADDI R1 R1 -808
+	568: STX R0 R30 R1
+	572: ADDI R1 R2 1
+	576: ADD R3 R0 R1
+	580: BEQ R0 -21
+	584: CMP R1 R3 R2
+	588: BGE R1 7
+	592: MULI R1 R3 4
+	596: ADDI R1 R1 -808
+	600: STX R0 R30 R1
+	604: ADDI R1 R3 1
+	608: ADD R3 R0 R1
+	612: BEQ R0 -7
+	616: ADD R29 R0 R28
+	620: POP R28 R29 4
+	624: POP R31 R29 4
+	628: RET R31
+Output:
+	632: PSH R31 R29 -4
+	636: PSH R28 R29 -4
+	640: ADD R28 R0 R29
+	644: ADDI R1 R0 0
+	648: ADDI R3 R0 1
+	652: ADDI R3 R0 1
+	656: CMPI R1 R3 0
+	660: BGT R1 18
+	664: MULI R1 R3 4
+	668: ADDI R1 R1 -808
+	672: LDX R2 R30 R1
+	676: CMPI R1 R2 0
+	680: BNE R1 4
+	684: ADDI R25 R0 1
+	688: WRD R25
+	692: BEQ R0 7
+	696: CMPI R1 R2 1
+	700: BNE R1 4
+	704: ADDI R25 R0 8
+	708: WRD R25
+	712: BEQ R0 2
+	716: WRD R0
+	720: ADDI R1 R3 1
+	724: ADD R3 R0 R1
+	728: BEQ R0 -18
+	732: WRL
+	736: ADD R29 R0 R28
+	740: POP R28 R29 4
+	744: POP R31 R29 4
+	748: RET R31
+CalcNext:
+	752: PSH R31 R29 -4
+	756: PSH R28 R29 -4
+	760: ADD R28 R0 R29
+	764: ADDI R3 R0 0
+	768: ADDI R25 R0 -804
+	772: ADD R4 R30 R25
+	776: LDW R1 R4 0
+	780: ADDI R25 R0 -808
+	784: ADD R5 R30 R25
+	788: STW R1 R5 0
+	792: ADDI R1 R0 1
+	796: MULI R1 R1 4
+	800: ADDI R6 R1 -808
+	804: MULI R1 R0 4
+	808: ADDI R1 R1 -808
+	812: LDX R2 R30 R1
+	816: STX R2 R30 R6
+	820: LDW R1 R5 0
+	824: LDW R5 R4 0
+	828: ADDI R6 R0 1
+	832: ADD R2 R0 R5
+	836: ADD R3 R0 R0
+	840: ADDI R6 R0 1
+	844: CMPI R3 R6 0
+	848: BGT R3 19
+	852: ADDI R4 R6 1
+	856: MULI R3 R4 4
+	860: ADDI R3 R3 -808
+	864: LDX R3 R30 R3
+	868: MULI R6 R6 4
+	872: ADDI R6 R6 -808
+	876: MULI R2 R2 2
+	880: ADD R2 R3 R2
+	884: MULI R1 R1 4
+	888: ADD R1 R2 R1
+	892: MULI R1 R1 4
+	896: ADDI R1 R1 -840
+	900: LDX R2 R30 R1
+	904: STX R2 R30 R6
+	908: ADD R1 R0 R5
+	912: ADD R2 R0 R3
+	916: ADD R6 R0 R4
+	920: BEQ R0 -19
+	924: ADD R29 R0 R28
+	928: POP R28 R29 4
+	932: POP R31 R29 4
+	936: RET R31
+Run:
+	940: PSH R31 R29 -4
+	944: PSH R28 R29 -4
+	948: ADD R28 R0 R29
+	952: ADDI R2 R0 0
+	956: ADD R2 R0 R0
+	960: CMPI R1 R2 0
+	964: BGE R1 10
+	968: PSH R2 R29 -4
+	972: JSR 632
+	976: POP R2 R29 4
+	980: PSH R2 R29 -4
+	984: JSR 752
+	988: POP R2 R29 4
+	992: ADDI R1 R2 1
+	996: ADD R2 R0 R1
+	1000: BEQ R0 -10
+	1004: ADD R29 R0 R28
+	1008: POP R28 R29 4
+	1012: POP R31 R29 4
+	1016: RET R31
@@ -0,0 +1,11 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: RDD R2
+	20: RDD R1
+	24: ADD R1 R2 R1
+	28: MUL R1 R1 R1
+	32: WRD R1
+	36: RET R0
@@ -0,0 +1,17 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R4 R0 0
+	16: RDD R3
+	20: RDD R2
+	24: CMPI R1 R3 0
+	28: BNE R1 4
+	32: ADD R1 R3 R2
+	36: MUL R1 R1 R1
+	40: BEQ R0 4
+	44: ADD R1 R3 R2
+	48: WRD R1
+	52: ADD R1 R0 R0
+	56: WRD R1
+	60: RET R0
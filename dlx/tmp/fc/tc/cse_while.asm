@@ -0,0 +1,15 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R3 R0 0
+	16: RDD R2
+	20: CMP R1 R0 R2
+	24: BGE R1 5
+	28: ADDI R1 R2 1
+	32: MUL R1 R1 R1
+	36: ADD R2 R0 R1
+	40: BEQ R0 -5
+	44: ADDI R1 R2 1
+	48: WRD R1
+	52: RET R0
@@ -0,0 +1,80 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: RDD R2
+	20: PSH R2 R29 -4
+	24: PSH R2 R29 -4
+	28: JSR 80
+	32: ADDI R29 R29 4
+	36: POP R2 R29 4
+	40: ADD R1 R0 R27
+	44: WRD R1
+	48: WRL
+	52: PSH R2 R29 -4
+	56: JSR 208
+	60: ADDI R29 R29 4
+	64: ADD R1 R0 R27
+	68: WRD R1
+	72: WRL
+	76: RET R0
+factIter:
+	80: PSH R31 R29 -4
+	84: PSH R28 R29 -4
+	88: ADD R28 R0 R29
+	92: LDW R4 R28 8
+	96: ADDI R1 R0 0
+	100: ADDI R2 R0 1
+	104: ADDI R2 R0 1
+	108: ADDI R3 R0 1
+	112: ADDI R1 R3 3
+	116: CMP R1 R1 R4
+	120: BGT R1 11
+	124: MUL R2 R2 R3
+	128: ADDI R1 R3 1
+	132: MUL R2 R2 R1
+	136: ADDI R1 R1 1
+	140: MUL R2 R2 R1
+	144: ADDI R1 R1 1
+	148: MUL R2 R2 R1
+	152: ADDI R1 R1 1
+	156: ADD R3 R0 R1
+	160: BEQ R0 -12
+	164: CMP R1 R3 R4
+	168: BGT R1 5
+	172: MUL R2 R2 R3
+	176: ADDI R1 R3 1
+	180: ADD R3 R0 R1
+	184: BEQ R0 -5
+	188: ADD R27 R0 R2
+	192: ADD R29 R0 R28
+	196: POP R28 R29 4
+	200: POP R31 R29 4
+	204: RET R31
+factRec:
+	208: PSH R31 R29 -4
+	212: PSH R28 R29 -4
+	216: ADD R28 R0 R29
+	220: LDW R2 R28 8
+	224: CMPI R1 R2 1
+	228: BGT R1 7
+	232: ADDI R27 R0 1
+	236: ADD R29 R0 R28
+	240: POP R28 R29 4
+	244: POP R31 R29 4
+	248: RET R31
+	252: BEQ R0 1
+	256: SUBI R1 R2 1
+	260: PSH R2 R29 -4
+	264: PSH R1 R29 -4
+	268: JSR 208
+	272: ADDI R29 R29 4
+	276: POP R2 R29 4
+	280: ADD R1 R0 R27
+	284: MUL R1 R1 R2
+	288: ADD R27 R0 R1
+	292: ADD R29 R0 R28
+	296: POP R28 R29 4
+	300: POP R31 R29 4
+	304: RET R31
@@ -0,0 +1,37 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: ADDI R25 R0 10
+	20: PSH R25 R29 -4
+	24: PSH R0 R29 -4
+	28: JSR 92
+	32: ADDI R29 R29 8
+	36: ADD R1 R0 R27
+	40: PSH R1 R29 -4
+	44: JSR 56
+	48: ADDI R29 R29 4
+	52: RET R0
+foo:
+	56: PSH R31 R29 -4
+	60: PSH R28 R29 -4
+	64: ADD R28 R0 R29
+	68: LDW R1 R28 8
+	72: WRD R1
+	76: ADD R29 R0 R28
+	80: POP R28 R29 4
+	84: POP R31 R29 4
+	88: RET R31
+bar:
+	92: PSH R31 R29 -4
+	96: PSH R28 R29 -4
+	100: ADD R28 R0 R29
+	104: LDW R2 R28 8
+	108: LDW R1 R28 12
+	112: MUL R1 R2 R1
+	116: ADD R27 R0 R1
+	120: ADD R29 R0 R28
+	124: POP R28 R29 4
+	128: POP R31 R29 4
+	132: RET R31
@@ -0,0 +1,56 @@
+	0: ADDI R25 R0 40
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R2 R0 0
+	16: RDD R5
+	20: RDD R1
+	24: MUL R6 R5 R1
+	28: CMP R1 R5 R1
+	32: BGE R1 3
+	36: ADD R4 R0 R6
+	40: BEQ R0 4
+	44: MULI R1 R5 4
+	48: ADDI R1 R1 -40
+	52: LDX R4 R30 R1
+	56: ADD R1 R0 R0
+	60: CMPI R2 R1 8
+	64: BGE R2 32
+	68: ADDI R3 R1 1
+	72: MULI R2 R3 4
+	76: ADDI R2 R2 -40
+	80: MULI R1 R1 4
+	84: ADDI R1 R1 -40
+	88: LDX R1 R30 R1
+	92: ADD R1 R1 R6
+	96: ADD R2 R30 R2
+	100: STW R1 R2 0
+	104: ADDI R3 R3 1
+	108: MULI R1 R3 4
+	112: ADDI R1 R1 -40
+	116: LDW R2 R2 0
+	120: ADD R2 R2 R6
+	124: ADD R1 R30 R1
+	128: STW R2 R1 0
+	132: ADDI R3 R3 1
+	136: MULI R2 R3 4
+	140: ADDI R2 R2 -40
+	144: LDW R1 R1 0
+	148: ADD R1 R1 R6
+	152: ADD R2 R30 R2
+	156: STW R1 R2 0
+	160: ADDI R3 R3 1
+	164: MULI R1 R3 4
+	168: ADDI R1 R1 -40
+	172: LDW R2 R2 0
+	176: ADD R2 R2 R6
+	180: STX R2 R30 R1
+	184: ADD R1 R0 R3
+	188: BEQ R0 -32
+	192: ADD R2 R6 R4
+	196: MULI R1 R5 4
+	200: ADDI R1 R1 -40
+	204: LDX R1 R30 R1
+	208: ADD R1 R2 R1
+	212: WRD R1
+	216: RET R0
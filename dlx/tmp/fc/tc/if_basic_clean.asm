@@ -0,0 +1,22 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R3 R0 0
+	16: RDD R2
+	20: CMPI R1 R2 0
+	24: BLE R1 3
+	28: RDD R1
+	32: BEQ R0 4
+	36: ADDI R1 R2 10
+	40: MULI R2 R1 20
+	44: ADD R1 R0 R0
+	48: WRD R2
+	52: RDD R2
+	56: CMPI R1 R2 0
+	60: BGE R1 3
+	64: MULI R1 R2 20
+	68: BEQ R0 2
+	72: ADD R1 R0 R2
+	76: WRD R1
+	80: RET R0
@@ -0,0 +1,13 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: RDD R3
+	20: RDD R2
+	24: CMP R1 R3 R2
+	28: BLE R1 3
+	32: WRD R3
+	36: BEQ R0 2
+	40: WRD R2
+	44: RET R0
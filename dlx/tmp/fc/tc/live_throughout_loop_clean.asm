@@ -0,0 +1,15 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: RDD R3
+	20: RDD R2
+	24: CMP R1 R2 R3
+	28: BGE R1 4
+	32: ADDI R25 R0 1
+	36: WRD R25
+	40: BEQ R0 -4
+	44: RDD R1
+	48: WRD R1
+	52: RET R0
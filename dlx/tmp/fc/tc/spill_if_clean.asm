@@ -0,0 +1,34 @@
+	0: ADDI R25 R0 40
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R25 R0 12
+	16: SUB R29 R29 R25
+	20: ADDI R1 R0 0
+	24: RDD R2
+	28: STW R2 R28 -4
+	32: RDD R6
+	36: RDD R5
+	40: RDD R2
+	44: STW R2 R28 -8
+	48: RDD R3
+	52: RDD R2
+	56: RDD R4
+	60: STW R4 R28 -12
+	64: LDW R1 R28 -4
+	68: CMP R1 R1 R6
+	72: BGE R1 4
+	76: ADD R1 R6 R5
+	80: LDW R4 R28 -8
+	84: BEQ R0 3
+	88: ADD R4 R3 R2
+	92: LDW R1 R28 -4
+	96: ADD R1 R1 R6
+	100: ADD R1 R1 R5
+	104: ADD R1 R1 R4
+	108: ADD R1 R1 R3
+	112: ADD R2 R1 R2
+	116: LDW R1 R28 -12
+	120: ADD R1 R2 R1
+	124: WRD R1
+	128: RET R0
@@ -0,0 +1,10 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: ADDI R1 R0 51
+	20: ADDI R25 R0 2
+	24: MULI R1 R25 51
+	28: WRD R1
+	32: RET R0
@@ -0,0 +1,109 @@
+	0: ADDI R25 R0 80
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: PSH R0 R29 -4
+	20: PSH R0 R29 -4
+	24: JSR 204
+	28: ADDI R29 R29 8
+	32: JSR 48
+	36: ADD R1 R0 R27
+	40: WRD R1
+	44: RET R0
+foo:
+	48: PSH R31 R29 -4
+	52: PSH R28 R29 -4
+	56: ADD R28 R0 R29
+	60: ADDI R2 R0 0
+	64: ADD R5 R0 R0
+	68: ADD R3 R0 R0
+	72: ADD R2 R0 R0
+	76: ADD R4 R0 R0
+	80: ADDI R1 R4 3
+	84: CMPI R1 R1 10
+	88: BGE R1 16
+	92: ADDI R2 R5 2
+	96: ADD R1 R2 R2
+	100: ADDI R3 R4 1
+	104: ADDI R2 R2 2
+	108: ADD R1 R2 R2
+	112: ADDI R3 R3 1
+	116: ADDI R2 R2 2
+	120: ADD R1 R2 R2
+	124: ADDI R1 R3 1
+	128: ADDI R3 R2 2
+	132: ADD R2 R3 R3
+	136: ADDI R1 R1 1
+	140: ADD R5 R0 R3
+	144: ADD R4 R0 R1
+	148: BEQ R0 -17
+	152: CMPI R1 R4 10
+	156: BGE R1 7
+	160: ADDI R3 R5 2
+	164: ADD R2 R3 R3
+	168: ADDI R1 R4 1
+	172: ADD R5 R0 R3
+	176: ADD R4 R0 R1
+	180: BEQ R0 -7
+	184: ADD R27 R0 R2
+	188: ADD R29 R0 R28
+	192: POP R28 R29 4
+	196: POP R31 R29 4
+	200: RET R31
+bar:
+	204: PSH R31 R29 -4
+	208: PSH R28 R29 -4
+	212: ADD R28 R0 R29
+	216: LDW R1 R28 8
+	220: LDW R1 R28 12
+	224: ADDI R3 R0 0
+	228: ADD R2 R0 R0
+	232: ADD R4 R0 R0
+	236: CMPI R1 R4 4
+	240: BGE R1 42
+	244: ADDI R1 R2 3
+	248: CMPI R1 R1 4
+	252: BGE R1 24
+	256: MULI R5 R4 4
+	260: ADD R1 R2 R5
+	264: MULI R1 R1 4
+	268: ADDI R1 R1 -80
+	272: STX R0 R30 R1
+	276: ADDI R2 R2 1
+	280: ADD R1 R2 R5
+	284: MULI R1 R1 4
+	288: ADDI R1 R1 -80
+	292: STX R0 R30 R1
+	296: ADDI R2 R2 1
+	300: ADD R1 R2 R5
+	304: MULI R1 R1 4
+	308: ADDI R1 R1 -80
+	312: STX R0 R30 R1
+	316: ADDI R2 R2 1
+	320: ADD R1 R2 R5
+	324: MULI R1 R1 4
+	328: ADDI R1 R1 -80
+	332: STX R0 R30 R1
+	336: ADDI R1 R2 1
+	340: ADD R2 R0 R1
+	344: BEQ R0 -25
+	348: CMPI R1 R2 4
+	352: BGE R1 8
+	356: MULI R1 R4 4
+	360: ADD R1 R2 R1
+	364: MULI R1 R1 4
+	368: ADDI R1 R1 -80
+	372: STX R0 R30 R1
+	376: ADDI R2 R2 1
+	380: BEQ R0 -8
+	384: MULI R1 R4 4
+	388: ADDI R1 R1 -16
+	392: STX R0 R30 R1
+	396: ADDI R1 R4 1
+	400: ADD R4 R0 R1
+	404: BEQ R0 -42
+	408: ADD R29 R0 R28
+	412: POP R28 R29 4
+	416: POP R31 R29 4
+	420: RET R31
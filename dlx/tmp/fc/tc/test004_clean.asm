@@ -0,0 +1,74 @@
+	0: ADDI R25 R0 40
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: ADDI R25 R0 -16
+	20: ADD R4 R30 R25
+	24: ADDI R26 R0 22
+	28: STW R26 R4 0
+	32: ADDI R25 R0 -12
+	36: ADD R3 R30 R25
+	40: ADDI R26 R0 61
+	44: STW R26 R3 0
+	48: ADDI R25 R0 -8
+	52: ADD R2 R30 R25
+	56: ADDI R26 R0 17
+	60: STW R26 R2 0
+	64: ADDI R25 R0 -4
+	68: ADD R5 R30 R25
+	72: ADDI R26 R0 34
+	76: STW R26 R5 0
+	80: ADDI R26 R0 11
+	84: STW R26 R28 0
+	88: LDW R4 R4 0
+	92: LDW R3 R3 0
+	96: LDW R2 R2 0
+	100: LDW R1 R5 0
+	104: PSH R1 R29 -4
+	108: PSH R2 R29 -4
+	112: PSH R3 R29 -4
+	116: PSH R4 R29 -4
+	120: JSR 136
+	124: ADDI R29 R29 16
+	128: ADD R1 R0 R27
+	132: RET R0
+max:
+	136: PSH R31 R29 -4
+	140: PSH R28 R29 -4
+	144: ADD R28 R0 R29
+	148: LDW R1 R28 8
+	152: LDW R6 R28 12
+	156: LDW R5 R28 16
+	160: LDW R4 R28 20
+	164: LDW R3 R28 24
+	168: ADDI R2 R0 0
+	172: ADDI R25 R0 -36
+	176: ADD R2 R30 R25
+	180: STW R1 R2 0
+	184: STW R6 R30 -32
+	188: STW R5 R30 -28
+	192: STW R4 R30 -24
+	196: STW R3 R30 -20
+	200: ADDI R3 R0 5
+	204: ADDI R4 R0 2
+	208: LDW R5 R2 0
+	212: ADDI R4 R0 2
+	216: CMPI R1 R4 5
+	220: BGT R1 12
+	224: MULI R1 R4 4
+	228: ADDI R1 R1 -40
+	232: LDX R2 R30 R1
+	236: CMP R1 R2 R5
+	240: BLE R1 2
+	244: BEQ R0 2
+	248: ADD R2 R0 R5
+	252: ADDI R1 R4 1
+	256: ADD R5 R0 R2
+	260: ADD R4 R0 R1
+	264: BEQ R0 -12
+	268: ADD R27 R0 R5
+	272: ADD R29 R0 R28
+	276: POP R28 R29 4
+	280: POP R31 R29 4
+	284: RET R31
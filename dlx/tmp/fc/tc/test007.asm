@@ -0,0 +1,25 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: ADDI R2 R0 1
+	20: ADDI R3 R0 2
+	24: ADDI R25 R0 1
+	28: CMPI R1 R25 2
+	32: BLE R1 5
+	36: ADDI R25 R0 1
+	40: ADDI R2 R25 1
+	44: ADDI R3 R0 2
+	48: BEQ R0 4
+	52: ADDI R25 R0 2
+	56: ADDI R3 R25 1
+	60: ADDI R2 R0 1
+	64: CMP R1 R2 R3
+	68: BGE R1 3
+	72: SUBI R1 R2 1
+	76: BEQ R0 2
+	80: ADD R1 R0 R2
+	84: WRD R1
+	88: WRD R3
+	92: RET R0
@@ -0,0 +1,12 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R3 R0 0
+	16: ADD R2 R0 R0
+	20: CMPI R1 R0 1000
+	24: BGE R1 4
+	28: ADDI R1 R2 1
+	32: ADD R2 R0 R1
+	36: BEQ R0 -4
+	40: RET R0
@@ -0,0 +1,42 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: ADDI R4 R0 1
+	20: ADDI R5 R0 2
+	24: ADDI R3 R0 3
+	28: ADDI R4 R0 1
+	32: ADDI R3 R0 3
+	36: ADDI R5 R0 2
+	40: CMP R1 R4 R2
+	44: BGE R1 26
+	48: ADDI R4 R4 1
+	52: ADDI R3 R3 1
+	56: WRD R4
+	60: ADD R2 R0 R5
+	64: ADDI R1 R2 3
+	68: CMP R1 R1 R3
+	72: BGE R1 11
+	76: WRD R3
+	80: ADDI R1 R2 1
+	84: WRD R3
+	88: ADDI R1 R1 1
+	92: WRD R3
+	96: ADDI R1 R1 1
+	100: WRD R3
+	104: ADDI R1 R1 1
+	108: ADD R2 R0 R1
+	112: BEQ R0 -12
+	116: CMP R1 R2 R3
+	120: BGE R1 5
+	124: WRD R3
+	128: ADDI R1 R2 1
+	132: ADD R2 R0 R1
+	136: BEQ R0 -5
+	140: ADD R5 R0 R2
+	144: BEQ R0 -26
+	148: WRD R4
+	152: WRD R5
+	156: WRD R3
+	160: RET R0
@@ -0,0 +1,58 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R25 R0 4
+	16: SUB R29 R29 R25
+	20: ADDI R1 R0 0
+	24: ADDI R3 R0 1
+	28: ADDI R5 R0 2
+	32: ADDI R2 R0 3
+	36: ADDI R4 R0 4
+	40: ADDI R25 R0 1
+	44: CMPI R1 R25 2
+	48: BGE R1 15
+	52: ADDI R25 R0 1
+	56: ADDI R3 R25 1
+	60: ADDI R2 R0 3
+	64: ADDI R4 R0 4
+	68: CMP R1 R2 R4
+	72: BGE R1 5
+	76: ADDI R2 R2 2
+	80: ADDI R1 R4 1
+	84: ADD R4 R0 R1
+	88: BEQ R0 -5
+	92: ADD R24 R0 R2
+	96: ADD R2 R0 R3
+	100: ADD R3 R0 R24
+	104: BEQ R0 14
+	108: ADDI R25 R0 1
+	112: ADDI R3 R25 2
+	116: ADDI R2 R0 3
+	120: ADDI R4 R0 4
+	124: CMP R1 R2 R4
+	128: BGE R1 5
+	132: ADDI R2 R2 3
+	136: ADDI R1 R4 2
+	140: ADD R4 R0 R1
+	144: BEQ R0 -5
+	148: ADD R24 R0 R2
+	152: ADD R2 R0 R3
+	156: ADD R3 R0 R24
+	160: STW R2 R28 -4
+	164: ADD R6 R0 R3
+	168: ADDI R2 R0 2
+	172: CMP R1 R2 R4
+	176: BGE R1 12
+	180: LDW R1 R28 -4
+	184: CMP R1 R1 R4
+	188: BLE R1 4
+	192: ADD R2 R0 R6
+	196: ADD R1 R0 R3
+	200: BEQ R0 3
+	204: ADD R1 R0 R2
+	208: ADDI R2 R0 2
+	212: ADD R6 R0 R2
+	216: ADD R2 R0 R1
+	220: BEQ R0 -12
+	224: RET R0
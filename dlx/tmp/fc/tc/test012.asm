@@ -0,0 +1,23 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R5 R0 0
+	16: ADDI R4 R0 2
+	20: ADDI R3 R0 3
+	24: ADDI R25 R0 2
+	28: CMPI R1 R25 3
+	32: BGE R1 7
+	36: ADDI R1 R0 1
+	40: ADDI R25 R0 1
+	44: ADDI R2 R25 1
+	48: ADD R1 R0 R2
+	52: ADD R3 R0 R0
+	56: BEQ R0 5
+	60: ADDI R25 R0 2
+	64: ADDI R2 R25 1
+	68: ADDI R3 R0 2
+	72: ADDI R1 R0 3
+	76: ADDI R1 R2 1
+	80: WRD R1
+	84: RET R0
@@ -0,0 +1,84 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: JSR 120
+	20: ADDI R25 R0 1
+	24: PSH R25 R29 -4
+	28: JSR 160
+	32: ADDI R29 R29 4
+	36: ADDI R1 R0 8
+	40: ADDI R2 R0 1790
+	44: PSH R2 R29 -4
+	48: ADDI R25 R0 1790
+	52: PSH R25 R29 -4
+	56: ADDI R25 R0 8
+	60: PSH R25 R29 -4
+	64: JSR 200
+	68: ADDI R29 R29 8
+	72: POP R2 R29 4
+	76: PSH R2 R29 -4
+	80: ADDI R25 R0 4
+	84: PSH R25 R29 -4
+	88: ADDI R25 R0 2
+	92: PSH R25 R29 -4
+	96: JSR 244
+	100: ADDI R29 R29 8
+	104: POP R2 R29 4
+	108: ADD R1 R0 R27
+	112: ADDI R1 R1 1790
+	116: RET R0
+foo:
+	120: PSH R31 R29 -4
+	124: PSH R28 R29 -4
+	128: ADD R28 R0 R29
+	132: ADDI R1 R0 0
+	136: ADDI R1 R0 1
+	140: ADDI R1 R0 2
+	144: ADD R29 R0 R28
+	148: POP R28 R29 4
+	152: POP R31 R29 4
+	156: RET R31
+bar:
+	160: PSH R31 R29 -4
+	164: PSH R28 R29 -4
+	168: ADD R28 R0 R29
+	172: LDW R1 R28 8
+	176: ADDI R1 R0 0
+	180: ADDI R1 R0 1
+	184: ADD R29 R0 R28
+	188: POP R28 R29 4
+	192: POP R31 R29 4
+	196: RET R31
+baz:
+	200: PSH R31 R29 -4
+	204: PSH R28 R29 -4
+	208: ADD R28 R0 R29
+	212: LDW R1 R28 8
+	216: LDW R1 R28 12
+	220: ADDI R1 R0 0
+	224: ADDI R1 R0 1
+	228: ADD R29 R0 R28
+	232: POP R28 R29 4
+	236: POP R31 R29 4
+	240: RET R31
+boo:
+	244: PSH R31 R29 -4
+	248: PSH R28 R29 -4
+	252: ADD R28 R0 R29
+	256: LDW R1 R28 8
+	260: LDW R1 R28 12
+	264: ADDI R3 R0 0
+	268: ADD R2 R0 R0
+	272: CMPI R1 R0 0
+	276: BGE R1 4
+	280: MUL R1 R2 R2
+	284: ADD R2 R0 R1
+	288: BEQ R0 -4
+	292: ADDI R1 R2 4
+	296: ADD R27 R0 R1
+	300: ADD R29 R0 R28
+	304: POP R28 R29 4
+	308: POP R31 R29 4
+	312: RET R31
@@ -0,0 +1,55 @@
+	0: ADDI R25 R0 1
+	4: LSHI R25 R25 16
+	8: ADDI R25 R25 -5536
+	12: SUB R29 R30 R25
+main:
+	16: ADD R28 R0 R29
+	20: ADDI R1 R0 0
+	24: ADDI R3 R0 1
+	28: ADDI R2 R0 19
+	32: PSH R2 R29 -4
+	36: PSH R3 R29 -4
+	40: JSR 180
+	44: POP R3 R29 4
+	48: POP R2 R29 4
+	52: ADD R1 R0 R27
+	56: ADDI R1 R1 1
+	60: ADDI R25 R0 1
+	64: MULI R2 R25 19
+	68: MULI R1 R1 20
+	72: ADD R1 R2 R1
+	76: ADDI R1 R1 2700
+	80: ADDI R1 R1 12000
+	84: MULI R1 R1 4
+	88: ADDI R25 R0 -1
+	92: LSHI R25 R25 16
+	96: ADDI R25 R25 5536
+	100: ADD R1 R25 R1
+	104: ADDI R26 R0 45
+	108: STX R26 R30 R1
+	112: PSH R2 R29 -4
+	116: JSR 180
+	120: POP R2 R29 4
+	124: ADD R1 R0 R27
+	128: ADDI R1 R1 1
+	132: MULI R1 R1 20
+	136: ADD R1 R2 R1
+	140: ADDI R1 R1 2700
+	144: ADDI R1 R1 12000
+	148: MULI R1 R1 4
+	152: ADDI R25 R0 -1
+	156: LSHI R25 R25 16
+	160: ADDI R25 R25 5536
+	164: ADD R1 R25 R1
+	168: LDX R1 R30 R1
+	172: ADDI R1 R1 2
+	176: RET R0
+foo:
+	180: PSH R31 R29 -4
+	184: PSH R28 R29 -4
+	188: ADD R28 R0 R29
+	192: ADDI R27 R0 14
+	196: ADD R29 R0 R28
+	200: POP R28 R29 4
+	204: POP R31 R29 4
+	208: RET R31
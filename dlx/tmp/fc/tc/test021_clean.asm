@@ -0,0 +1,12 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: ADDI R1 R0 1
+	20: ADDI R2 R0 2
+	24: ADDI R25 R0 1
+	28: MULI R1 R25 2
+	32: MULI R1 R1 7
+	36: ADDI R1 R1 2
+	40: RET R0
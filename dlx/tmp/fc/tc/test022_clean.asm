@@ -0,0 +1,27 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: ADDI R3 R0 1
+	20: ADDI R5 R0 2
+	24: ADDI R4 R0 3
+	28: ADDI R3 R0 1
+	32: ADDI R5 R0 2
+	36: CMPI R1 R2 3
+	40: BGE R1 13
+	44: ADDI R3 R2 1
+	48: CMPI R1 R3 3
+	52: BGE R1 9
+	56: ADD R2 R0 R5
+	60: ADDI R1 R2 2
+	64: CMPI R1 R1 3
+	68: BGE R1 3
+	72: ADD R2 R0 R3
+	76: BEQ R0 -4
+	80: ADD R5 R0 R2
+	84: BEQ R0 -9
+	88: BEQ R0 -13
+	92: ADDI R25 R0 3
+	96: ADDI R1 R25 1
+	100: RET R0
@@ -0,0 +1,34 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: ADDI R2 R0 1
+	20: ADDI R3 R0 2
+	24: ADDI R4 R0 3
+	28: ADDI R5 R0 4
+	32: ADDI R1 R0 5
+	36: ADDI R2 R0 1
+	40: ADDI R5 R0 4
+	44: ADDI R25 R0 3
+	48: ADDI R1 R25 4
+	52: CMP R1 R1 R5
+	56: BGE R1 14
+	60: ADDI R1 R2 5
+	64: SUBI R6 R1 2
+	68: ADDI R25 R0 2
+	72: MULI R1 R25 6
+	76: CMP R1 R6 R1
+	80: BLE R1 5
+	84: DIVI R1 R2 3
+	88: MUL R2 R1 R5
+	92: SUBI R1 R5 1
+	96: BEQ R0 2
+	100: ADDI R1 R2 2
+	104: ADD R5 R0 R1
+	108: BEQ R0 -16
+	112: ADDI R25 R0 3
+	116: SUB R1 R25 R2
+	120: ADDI R1 R1 2
+	124: ADDI R1 R2 2
+	128: RET R0
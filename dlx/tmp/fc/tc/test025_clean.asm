@@ -0,0 +1,24 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: ADDI R5 R0 0
+	20: ADD R4 R5 R5
+	24: CMP R2 R5 R5
+	28: BEQ R2 10
+	32: MUL R6 R5 R5
+	36: ADDI R3 R6 4
+	40: ADDI R2 R0 5
+	44: ADDI R1 R0 5
+	48: ADD R4 R1 R5
+	52: ADD R2 R0 R3
+	56: ADD R3 R0 R6
+	60: ADDI R1 R0 5
+	64: BEQ R0 4
+	68: DIV R3 R5 R5
+	72: ADD R2 R0 R3
+	76: ADD R1 R0 R0
+	80: MUL R1 R5 R5
+	84: DIV R1 R5 R5
+	88: RET R0
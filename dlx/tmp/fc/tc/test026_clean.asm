@@ -0,0 +1,31 @@
+	0: ADDI R25 R0 64
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R25 R0 4
+	16: SUB R29 R29 R25
+	20: ADDI R5 R0 0
+	24: MULI R2 R0 4
+	28: STW R2 R28 -4
+	32: LDW R1 R28 -4
+	36: ADDI R1 R1 -32
+	40: ADD R4 R30 R1
+	44: LDW R3 R4 0
+	48: ADD R6 R0 R3
+	52: ADD R2 R0 R0
+	56: ADD R1 R0 R0
+	60: LDW R2 R4 0
+	64: LDW R1 R28 -4
+	68: ADDI R1 R1 -64
+	72: ADD R6 R30 R1
+	76: LDW R1 R6 0
+	80: CMP R1 R2 R1
+	84: BGE R1 8
+	88: MULI R1 R3 4
+	92: ADDI R1 R1 -32
+	96: STX R0 R30 R1
+	100: LDW R1 R6 0
+	104: LDW R1 R4 0
+	108: ADD R6 R0 R2
+	112: BEQ R0 -13
+	116: RET R0
@@ -0,0 +1,36 @@
+	0: ADDI R25 R0 24
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R2 R0 0
+	16: ADDI R25 R0 2
+	20: MULI R1 R25 0
+	24: SUBI R1 R1 6
+	28: MULI R1 R1 4
+	32: ADDI R1 R1 -12
+	36: ADD R4 R30 R1
+	40: LDW R3 R4 0
+	44: ADD R2 R0 R0
+	48: ADDI R25 R0 2
+	52: CMPI R1 R25 3
+	56: BGE R1 19
+	60: LDW R2 R4 0
+	64: LDW R5 R4 0
+	68: ADDI R25 R0 4
+	72: CMP R1 R25 R5
+	76: BGE R1 12
+	80: ADDI R25 R0 3
+	84: CMPI R1 R25 4
+	88: BGE R1 6
+	92: MULI R1 R3 4
+	96: ADDI R1 R1 -24
+	100: ADDI R26 R0 3
+	104: STX R26 R30 R1
+	108: BEQ R0 3
+	112: ADDI R26 R0 5
+	116: STW R26 R30 -4
+	120: BEQ R0 -14
+	124: ADD R3 R0 R5
+	128: BEQ R0 -20
+	132: LDW R1 R4 0
+	136: RET R0
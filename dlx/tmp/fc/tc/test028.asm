@@ -0,0 +1,17 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R4 R0 0
+	16: CMPI R1 R0 3
+	20: BGE R1 5
+	24: ADDI R1 R0 4
+	28: ADD R2 R0 R1
+	32: ADD R3 R0 R0
+	36: BEQ R0 4
+	40: ADDI R3 R0 4
+	44: ADD R1 R0 R0
+	48: ADD R2 R0 R0
+	52: ADDI R1 R1 0
+	56: ADD R1 R3 R2
+	60: RET R0
@@ -0,0 +1,32 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R4 R0 0
+	16: ADDI R25 R0 2
+	20: CMPI R1 R25 3
+	24: BGE R1 18
+	28: ADD R4 R0 R0
+	32: ADD R2 R0 R0
+	36: ADD R3 R0 R0
+	40: ADDI R25 R0 4
+	44: CMPI R1 R25 6
+	48: BLE R1 7
+	52: ADDI R2 R2 6
+	56: ADDI R1 R3 2
+	60: ADD R4 R0 R2
+	64: ADD R2 R0 R1
+	68: ADD R3 R0 R1
+	72: BEQ R0 -8
+	76: ADDI R1 R2 5
+	80: ADD R24 R0 R3
+	84: ADD R3 R0 R2
+	88: ADD R2 R0 R24
+	92: BEQ R0 5
+	96: ADD R4 R0 R0
+	100: ADD R3 R0 R0
+	104: ADD R1 R0 R0
+	108: ADD R2 R0 R0
+	112: ADD R1 R1 R3
+	116: ADD R1 R1 R2
+	120: RET R0
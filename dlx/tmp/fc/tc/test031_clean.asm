@@ -0,0 +1,20 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R2 R0 0
+	16: RDD R1
+	20: WRD R1
+	24: WRL
+	28: ADD R2 R0 R0
+	32: ADD R3 R0 R0
+	36: ADD R1 R0 R0
+	40: CMP R1 R1 R3
+	44: BLE R1 7
+	48: RDD R2
+	52: ADDI R1 R3 1
+	56: WRD R2
+	60: WRL
+	64: ADD R3 R0 R1
+	68: BEQ R0 -7
+	72: RET R0
@@ -0,0 +1,22 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R3 R0 0
+	16: RDD R2
+	20: ADDI R1 R2 -3
+	24: CMP R1 R0 R1
+	28: BGE R1 7
+	32: SUBI R1 R2 1
+	36: SUBI R1 R1 1
+	40: SUBI R1 R1 1
+	44: SUBI R1 R1 1
+	48: ADD R2 R0 R1
+	52: BEQ R0 -8
+	56: CMP R1 R0 R2
+	60: BGE R1 4
+	64: SUBI R1 R2 1
+	68: ADD R2 R0 R1
+	72: BEQ R0 -4
+	76: WRD R2
+	80: RET R0
@@ -0,0 +1,22 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: RDD R2
+	20: RDD R4
+	24: RDD R3
+	28: CMP R1 R4 R2
+	32: BGE R1 11
+	36: SUBI R1 R4 1
+	40: CMP R1 R2 R1
+	44: BNE R1 3
+	48: WRD R2
+	52: BEQ R0 2
+	56: MULI R3 R2 2
+	60: ADDI R2 R2 1
+	64: ADDI R1 R4 1
+	68: ADD R4 R0 R1
+	72: BEQ R0 -11
+	76: WRD R2
+	80: RET R0
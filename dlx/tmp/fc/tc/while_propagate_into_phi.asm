@@ -0,0 +1,33 @@
+	0: ADDI R25 R0 0
+	4: SUB R29 R30 R25
+main:
+	8: ADD R28 R0 R29
+	12: ADDI R1 R0 0
+	16: RDD R2
+	20: RDD R3
+	24: CMPI R1 R2 100
+	28: BGE R1 23
+	32: WRD R2
+	36: SUBI R2 R2 1
+	40: ADDI R1 R3 3
+	44: CMPI R1 R1 10
+	48: BGE R1 11
+	52: ADDI R2 R2 1
+	56: ADDI R1 R3 1
+	60: ADDI R2 R2 1
+	64: ADDI R1 R1 1
+	68: ADDI R2 R2 1
+	72: ADDI R1 R1 1
+	76: ADDI R2 R2 1
+	80: ADDI R1 R1 1
+	84: ADD R3 R0 R1
+	88: BEQ R0 -12
+	92: CMPI R1 R3 10
+	96: BGE R1 5
+	100: ADDI R2 R2 1
+	104: ADDI R1 R3 1
+	108: ADD R3 R0 R1
+	112: BEQ R0 -5
+	116: BEQ R0 -23
+	120: WRD R3
+	124: RET R0
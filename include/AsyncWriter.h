@@ -0,0 +1,42 @@
+/*
+ * AsyncWriter.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_ASYNCWRITER_H_
+#define INCLUDE_ASYNCWRITER_H_
+
+#include <string>
+
+/*
+ * writes the compiler's output files on a background thread, so compiling
+ * never waits for the disk. the thread starts with the first write, creates
+ * the directories of every file and writes the files in the order they
+ * were queued. a file is written under a temporary name and renamed, so
+ * other processes, eg. sharing a CompileCache, never read a partial file
+ *
+ * the queue holds at most MAX_QUEUED_BYTES. a write that does not fit waits
+ * until the thread catches up, so a slow disk bounds memory instead of
+ * letting buffers pile up. a single larger file is still accepted when the
+ * queue is empty. queued files are written before the process exits, also
+ * on exit()
+ */
+
+static const std::size_t MAX_QUEUED_BYTES = 64 << 20;
+
+// takes contents and queues them to be written to fileName, which is created or replaced
+void writeFileAsync(std::string fileName, std::string contents, bool executable = false);
+
+/*
+ * blocks until every queued file is written. failures are kept for the
+ * next finishWrites
+ */
+void waitForWrites();
+
+/*
+ * blocks until every queued file is written
+ * @return false if a file could not be written since the last call
+ */
+bool finishWrites();
+
+#endif /* INCLUDE_ASYNCWRITER_H_ */
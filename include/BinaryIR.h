@@ -0,0 +1,78 @@
+/*
+ * BinaryIR.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_BINARYIR_H_
+#define INCLUDE_BINARYIR_H_
+
+#include "SSA.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * compact binary form of an SSA module that can be read back, so compiled
+ * or partly compiled modules can be stored and loaded without parsing
+ *
+ * integers are LEB128 varints, signed ones zigzag encoded. the file is
+ * 	"SSAB", version, 1 if registers are allocated else 0
+ * 	strings: count, then the length and bytes of each
+ * 	functions: count, then per function its name as a string index, 1 if
+ * 	void, local variable offset, frame size, the number of blocks, and per
+ * 	block its number of instructions, 1 if a loop header and profile count
+ * 	bodies: per block its predecessors, successors with their edge counts,
+ * 	then its instructions
+ * blocks are indices into the blocks of their function. an instruction is
+ * its opcode, line id, register and two operands, each a kind
+ * (Operand::Type + 1, 0 if absent) followed by
+ * 	val: block << 1 | 1 if in another function, [function], position
+ * 	call: function, number of arguments, the arguments
+ * 	phi: variable name as a string index, number of arguments, then
+ * 	block and operand pairs
+ * 	constant: the value
+ * the layout of every block is known before the bodies, so references to
+ * later instructions, eg. by loop phis, need no fixups
+ *
+ * a single function is "SSAF", version, strings, then the function and its
+ * body as above. calls name their function by a string index, and values
+ * outside of the function are id << 1 | 1, for ids given by the caller
+ */
+namespace BinaryIR
+{
+
+	static const char* const MAGIC = "SSAB";
+	static const char* const FUNCTION_MAGIC = "SSAF";
+	static const uint64_t VERSION = 1;
+	static const char* const EXTENSION = ".ir";
+
+	std::string serialize(SSA::Module* ir, bool allocated);
+
+	/*
+	 * @param allocated set to whether registers were allocated
+	 * @return the module, or nullptr if data is not a valid module of this version
+	 */
+	SSA::Module* deserialize(const char* data, std::size_t size, bool& allocated);
+
+	// maps the file into memory and deserializes it, nullptr if it cannot be read
+	SSA::Module* load(std::string fileName, bool& allocated);
+
+	/*
+	 * @param foreign ids of the instructions of other functions that f may use
+	 * @return the function, or an empty string if it uses an instruction without an id
+	 */
+	std::string serializeFunction(SSA::Function* f, const std::unordered_map<SSA::Instruction*, uint64_t>& foreign);
+
+	/*
+	 * replaces the body of f, whose name must match, with the one in data.
+	 * calls are resolved by name in the module of f
+	 * @param foreign instructions of other functions by id
+	 * @return false, leaving f unchanged, if data is not a valid function
+	 */
+	bool deserializeFunction(const char* data, std::size_t size, SSA::Function* f,
+			const std::vector<SSA::Instruction*>& foreign);
+
+};
+
+#endif /* INCLUDE_BINARYIR_H_ */
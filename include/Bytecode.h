@@ -0,0 +1,105 @@
+/*
+ * Bytecode.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_BYTECODE_H_
+#define INCLUDE_BYTECODE_H_
+
+#include "SSA.h"
+#include "RegAllocStructs.h"
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * flat, fixed width lowering of a register allocated module for BytecodeVM
+ *
+ * operands are indices into the cells of the current call:
+ * 	registers | scratch | imported values | constant pool
+ * constants, including the global register, are copied into the pool when a
+ * function is called. branch targets are offsets into the code array
+ */
+class Bytecode
+{
+public:
+	enum Op : uint16_t
+	{
+		ADD, SUB, MUL, DIV, CMP, MOV,
+		LD, ST,		// address in cell a
+		LDS, STS,	// frame slot a
+		LDG, STG,	// global word a
+		LDX, STX,	// global register + cell a
+		JMP, BNE, BEQ, BLE, BLT, BGE, BGT,
+		ARG, CALL, POP, RET, EXP,
+		IN, OUT, NL, END,
+		NUM_OPS
+	};
+
+	// d is the destination cell, or a source for ST*, OUT, ARG and EXP
+	struct Instr
+	{
+		Op op;
+		uint16_t d;
+		int32_t a;
+		int32_t b;
+	};
+
+	struct FunctionInfo
+	{
+		std::string name;
+		int entry;
+		int numCells;
+		// spill slots in words
+		int frameSize;
+		// initial values of the constant pool, starting at cell constantBase
+		int constantBase;
+		std::vector<int> constants;
+		// cell, export index pairs copied on entry
+		std::vector<std::pair<int, int>> imports;
+	};
+
+	static const uint16_t NO_CELL = UINT16_MAX;
+	// scratch cells for breaking move cycles and saving branch conditions
+	static const int SCRATCH = NUM_REG;
+	static const int BRANCH_SCRATCH = NUM_REG + 1;
+
+private:
+	std::vector<Instr> code;
+	std::vector<FunctionInfo> functions;
+	std::unordered_map<SSA::Function*, int> functionIds;
+	// values read by other functions, eg. globals of main
+	std::unordered_map<SSA::Instruction*, int> exports;
+	// bytes of memory below the global register
+	int globalSize;
+
+	// per function lowering state
+	SSA::Function* f;
+	FunctionInfo* info;
+	std::map<int, int> constantCells;
+	std::unordered_map<SSA::Instruction*, int> importCells;
+	std::unordered_map<SSA::Instruction*, int> numUses;
+
+	void lower(SSA::Function* func);
+	void lower(SSA::Instruction* i, SSA::Instruction* prev, SSA::Instruction* next);
+	void lowerMoves(std::vector<std::pair<int, int>> moves);
+	void emit(Op op, int d, int a = 0, int b = 0);
+	int constantCell(int c);
+	int cell(SSA::Operand* o);
+	int dest(SSA::Instruction* i);
+	bool isFused(SSA::Instruction* adda, SSA::Instruction* memAccess);
+	void lowerMemoryAccess(SSA::Instruction* i, SSA::Instruction* prev);
+public:
+	Bytecode(SSA::Module* ir);
+	const std::vector<Instr>& getCode() const;
+	const std::vector<FunctionInfo>& getFunctions() const;
+	int getMainId() const;
+	int getGlobalSize() const;
+	int getNumExports() const;
+	std::string toStr() const;
+	static std::string opToStr(Op op);
+};
+
+#endif /* INCLUDE_BYTECODE_H_ */
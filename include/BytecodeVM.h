@@ -0,0 +1,62 @@
+/*
+ * BytecodeVM.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_BYTECODEVM_H_
+#define INCLUDE_BYTECODEVM_H_
+
+#include "Bytecode.h"
+#include <cstdio>
+#include <vector>
+
+/*
+ * runs Bytecode with a direct threaded dispatch loop. the code is copied once
+ * into an array of handler addresses, so each instruction jumps straight to
+ * the next handler instead of going through a switch
+ *
+ * cells of every active call live on one stack, and memory holds the globals
+ * followed by the spill slots of every active call
+ */
+class BytecodeVM
+{
+private:
+	struct Threaded
+	{
+		const void* handler;
+		uint16_t d;
+		int32_t a;
+		int32_t b;
+	};
+	struct Frame
+	{
+		int returnPc;
+		int cellBase;
+		int memBase;
+		int frameSize;
+		int dest;
+		int argBase;
+		int numArgs;
+		int popIndex;
+	};
+	const Bytecode& bytecode;
+	FILE* in;
+	FILE* out;
+	std::vector<Threaded> threaded;
+	std::vector<int> cellStack;
+	std::vector<int> memory;
+	std::vector<int> args;
+	std::vector<int> exports;
+	std::vector<Frame> frames;
+	unsigned long instructionCount;
+
+	void enter(int functionId, int returnPc, int dest, int numArgs);
+	int& address(int addr);
+	void error(int pc, std::string msg) const;
+public:
+	BytecodeVM(const Bytecode& bytecode, FILE* in = stdin, FILE* out = stdout);
+	void run();
+	unsigned long getInstructionCount() const;
+};
+
+#endif /* INCLUDE_BYTECODEVM_H_ */
@@ -0,0 +1,33 @@
+/*
+ * CFGLayout.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_CFGLAYOUT_H_
+#define INCLUDE_CFGLAYOUT_H_
+
+#include "SSA.h"
+
+/*
+ * an edge is critical if its source has multiple successors and its target
+ * has multiple predecessors. an empty block is inserted on each such edge so
+ * insertMoveBeforePhi has a block that only runs on that edge
+ *
+ * @return number of edges split
+ */
+int splitCriticalEdges(SSA::Function* f);
+
+/*
+ * order blocks in reverse postorder, visiting the first successor last so it
+ * falls through, and keep the blocks of each loop contiguous
+ *
+ * with a profile, branches are inverted so the hotter successor falls through
+ * and cold blocks are moved to the end
+ */
+void layoutBlocks(SSA::Function* f);
+
+// split critical edges, layout blocks and renumber instructions
+void canonicalizeCFG(SSA::Function* f);
+void canonicalizeCFG(SSA::Module* ir);
+
+#endif /* INCLUDE_CFGLAYOUT_H_ */
@@ -0,0 +1,83 @@
+/*
+ * CodeGen.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_CODEGEN_H_
+#define INCLUDE_CODEGEN_H_
+
+#include "DLX.h"
+#include "Liveness.h"
+#include "SSA.h"
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * lowers a register allocated module to a DLX program image
+ *
+ * memory, from the top: arrays and values exported by main at negative
+ * offsets from GP, then the stack, growing down. GP must hold the top of
+ * memory when the program starts at address 0, which runs main
+ *
+ * calls: the caller pushes the registers live across the call that the
+ * callee may write (see getClobberedRegs), then the args last to first, and
+ * jumps with JSR. the callee pushes RA and FP, points FP
+ * at the saved FP and reserves its spill slots below it, so arg k is at
+ * FP + 8 + 4k and spill slot c at FP - frameSize + c. results return in RV
+ */
+class CodeGen
+{
+private:
+	std::vector<uint32_t> program;
+	std::unordered_map<SSA::Function*, int> entries;
+	// JSR to patch once every function has an entry
+	std::list<std::pair<int, SSA::Function*>> calls;
+	// offsets from GP of values read by other functions, eg. globals of main
+	std::unordered_map<SSA::Instruction*, int> exports;
+	// registers each function may write, so callers save only those
+	ClobberSets clobbers;
+	// bytes below GP
+	int globalSize;
+	// instruction and block each word was generated for, or nullptr
+	std::vector<SSA::Instruction*> origins;
+	std::vector<SSA::BasicBlock*> originBlocks;
+
+	// per function state
+	SSA::Function* f;
+	int frameSize;
+	std::unordered_map<SSA::Instruction*, int> numUses;
+	std::unordered_map<SSA::Instruction*, std::vector<int>> savedRegs;
+	int numPops;
+	SSA::Instruction* currentIns;
+	SSA::BasicBlock* currentBB;
+
+	void generate(SSA::Function* func);
+	void generate(SSA::Instruction* i, SSA::Instruction* prev, SSA::Instruction* next);
+	void generateMoves(std::list<SSA::Instruction*> moves);
+	void generateArithmetic(SSA::Instruction* i, DLX::Opcode op, DLX::Opcode opi);
+	void generateMemoryAccess(SSA::Instruction* i, SSA::Instruction* prev);
+	void generateCall(SSA::Instruction* i);
+	void generateReturn(SSA::Operand* value);
+	void computeSavedRegs();
+	bool isFused(SSA::Instruction* adda, SSA::Instruction* memAccess);
+	bool getConst(SSA::Operand* o, int& c);
+	int use(SSA::Operand* o, int scratch);
+	int dest(SSA::Instruction* i);
+	int reg(SSA::Instruction* i);
+	void loadConst(int r, int c);
+	void emit(DLX::Opcode op, int a, int b, int c);
+public:
+	CodeGen(SSA::Module* ir);
+	const std::vector<uint32_t>& getProgram() const;
+	int getEntry(SSA::Function* func) const;
+	int getGlobalSize() const;
+	SSA::Instruction* getOrigin(int pc) const;
+	SSA::BasicBlock* getOriginBlock(int pc) const;
+	// little endian words
+	void write(std::string fileName) const;
+	std::string toStr() const;
+};
+
+#endif /* INCLUDE_CODEGEN_H_ */
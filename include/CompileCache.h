@@ -0,0 +1,54 @@
+/*
+ * CompileCache.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_COMPILECACHE_H_
+#define INCLUDE_COMPILECACHE_H_
+
+#include "SSA.h"
+#include <functional>
+#include <string>
+
+/*
+ * on disk cache of compiled modules, shared by compiler processes
+ *
+ * a key is the compiler build, the options that change the compiled module
+ * and the source. an entry is named by a hash of its key and holds the key
+ * itself, so a hash collision is a miss, followed by the module in the
+ * BinaryIR format. entries are written by AsyncWriter, ie. renamed into
+ * place, so no process reads a partial entry, and an entry stays readable
+ * while another process evicts it
+ *
+ * evict removes the least recently used entries until the directory holds
+ * at most maxBytes. hits refresh the modification time of their entry
+ */
+// bytes
+const std::size_t DEFAULT_CACHE_SIZE = std::size_t(256) << 20;
+
+class CompileCache
+{
+private:
+	std::string dir;
+	std::size_t maxBytes;
+	std::string entryName(const std::string& key) const;
+public:
+	CompileCache(std::string dir, std::size_t maxBytes);
+	static std::string key(const std::string& options, const std::string& source);
+	/*
+	 * @param allocated set to whether registers were allocated
+	 * @return the cached module, or nullptr on a miss
+	 */
+	SSA::Module* lookup(const std::string& key, bool& allocated);
+	void store(const std::string& key, SSA::Module* ir, bool allocated);
+	/*
+	 * entries of other data, eg. single functions
+	 * @param read called with the data of the entry, false if it is not valid
+	 * @return false on a miss or if read failed
+	 */
+	bool lookupData(const std::string& key, const std::function<bool(const char*, std::size_t)>& read);
+	void storeData(const std::string& key, const std::string& data);
+	void evict();
+};
+
+#endif /* INCLUDE_COMPILECACHE_H_ */
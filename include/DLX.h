@@ -0,0 +1,73 @@
+/*
+ * DLX.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_DLX_H_
+#define INCLUDE_DLX_H_
+
+#include <cstdint>
+#include <string>
+
+/*
+ * the DLX instruction set. every instruction is one 32 bit word:
+ * 	F1: op(6) a(5) b(5) c(16), c is sign extended
+ * 	F2: op(6) a(5) b(5) unused(11) c(5)
+ * 	F3: op(6) c(26)
+ * memory is byte addressed and word aligned. branch offsets are in words from
+ * the branch, JSR takes a byte address, and RET with c = 0 halts
+ */
+namespace DLX
+{
+
+	enum Opcode
+	{
+		ADD = 0, SUB = 1, MUL = 2, DIV = 3, MOD = 4, CMP = 5,
+		OR = 8, AND = 9, BIC = 10, XOR = 11, LSH = 12, ASH = 13, CHK = 14,
+		ADDI = 16, SUBI = 17, MULI = 18, DIVI = 19, MODI = 20, CMPI = 21,
+		ORI = 24, ANDI = 25, BICI = 26, XORI = 27, LSHI = 28, ASHI = 29, CHKI = 30,
+		LDW = 32, LDX = 33, POP = 34, STW = 36, STX = 37, PSH = 38,
+		BEQ = 40, BNE = 41, BLT = 42, BGE = 43, BLE = 44, BGT = 45, BSR = 46,
+		JSR = 48, RET = 49,
+		RDD = 50, WRD = 51, WRH = 52, WRL = 53,
+		ERR = 63
+	};
+
+	enum Format {F1, F2, F3};
+
+	struct Instruction
+	{
+		Opcode op;
+		int a;
+		int b;
+		int c;
+	};
+
+	/*
+	 * register conventions. the allocator's registers are R1 to R{NUM_REG},
+	 * scratch registers sit below the reserved ones at the top
+	 */
+	static const int ZERO = 0;
+	static const int FIRST_ALLOC_REG = 1;
+	static const int BRANCH_SCRATCH = 23;
+	static const int MOVE_SCRATCH = 24;
+	static const int SCRATCH1 = 25;
+	static const int SCRATCH2 = 26;
+	static const int RV = 27;
+	static const int FP = 28;
+	static const int SP = 29;
+	// arrays and exported values sit at negative offsets from GP
+	static const int GP = 30;
+	static const int RA = 31;
+	static const int NUM_REGS = 32;
+
+	Format getFormat(Opcode op);
+	bool fitsImmediate(int64_t c);
+	uint32_t encode(Instruction instr);
+	Instruction decode(uint32_t word);
+	std::string opToStr(Opcode op);
+	std::string toStr(Instruction instr);
+
+};
+
+#endif /* INCLUDE_DLX_H_ */
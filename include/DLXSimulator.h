@@ -0,0 +1,65 @@
+/*
+ * DLXSimulator.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_DLXSIMULATOR_H_
+#define INCLUDE_DLXSIMULATOR_H_
+
+#include "CodeGen.h"
+#include "DLX.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/*
+ * executes a DLX image, counting cycles with a fixed latency per opcode
+ *
+ * the image is copied to address 0 and GP starts at the top of memory, see
+ * CodeGen. instructions are decoded once, so code must not modify itself
+ */
+class DLXSimulator
+{
+private:
+	std::vector<DLX::Instruction> code;
+	std::vector<int> memory;
+	int regs[DLX::NUM_REGS];
+	FILE* in;
+	FILE* out;
+	int latencies[DLX::ERR + 1];
+	unsigned long cycles;
+	unsigned long instructionCount;
+	unsigned long loads;
+	unsigned long stores;
+	unsigned long branches;
+	unsigned long takenBranches;
+	// executions and cycles per word of the image
+	std::vector<unsigned long> counts;
+	std::vector<unsigned long> pcCycles;
+
+	int& word(int address, int pc);
+	void error(int pc, std::string msg) const;
+public:
+	static const int DEFAULT_MEMORY_SIZE = 1 << 22;
+
+	DLXSimulator(const std::vector<uint32_t>& program, int memorySize = DEFAULT_MEMORY_SIZE,
+			FILE* in = stdin, FILE* out = stdout);
+	void setLatency(DLX::Opcode op, int latency);
+	/*
+	 * @param spec comma separated OPCODE=cycles, eg. MUL=4,LDW=3
+	 * @return false if spec is malformed
+	 */
+	bool setLatencies(std::string spec);
+	void run();
+	unsigned long getCycles() const;
+	unsigned long getInstructionCount() const;
+	unsigned long getCount(int pc) const;
+	std::string statsToStr() const;
+	/*
+	 * execution counts per basic block, named as in the GraphML output, and
+	 * the numHottest SSA instructions by cycles
+	 */
+	std::string profileToStr(const CodeGen& codeGen, int numHottest) const;
+};
+
+#endif /* INCLUDE_DLXSIMULATOR_H_ */
@@ -0,0 +1,20 @@
+/*
+ * Directory.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_DIRECTORY_H_
+#define INCLUDE_DIRECTORY_H_
+
+#include <string>
+
+/*
+ * creates a directory and its parents, like mkdir -p, without starting a
+ * shell. directories created or found once are remembered, so the dumps
+ * of every file in a corpus only pay for the directories they add
+ *
+ * @return false if a directory could not be created
+ */
+bool makeDirectories(std::string path);
+
+#endif /* INCLUDE_DIRECTORY_H_ */
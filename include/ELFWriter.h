@@ -0,0 +1,31 @@
+/*
+ * ELFWriter.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_ELFWRITER_H_
+#define INCLUDE_ELFWRITER_H_
+
+#include "SSA.h"
+#include <string>
+
+/*
+ * writes register allocated modules as static x86-64 Linux executables
+ *
+ * the image needs no libc or linker. a small runtime, written with the same
+ * assembler as X86Gen, implements the builtins with buffered read and write
+ * system calls. code and runtime are one read only segment at TEXT_ADDRESS,
+ * the io buffers and globals are zero filled memory at DATA_ADDRESS
+ */
+namespace ELF
+{
+
+	static const uint64_t TEXT_ADDRESS = 0x400000;
+	static const uint64_t DATA_ADDRESS = 0x10000000;
+	static const int BUFFER_SIZE = 4096;
+
+	void writeExecutable(SSA::Module* ir, std::string fileName);
+
+};
+
+#endif /* INCLUDE_ELFWRITER_H_ */
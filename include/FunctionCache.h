@@ -0,0 +1,50 @@
+/*
+ * FunctionCache.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_FUNCTIONCACHE_H_
+#define INCLUDE_FUNCTIONCACHE_H_
+
+#include "CompileCache.h"
+#include "Parser.h"
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/*
+ * incremental compilation on top of CompileCache. every function is also
+ * stored on its own, keyed by its tokens, what it sees of the program around
+ * it (see Parser::describeContext), the signatures of the functions it
+ * calls and their keys, since its registers depend on the ones its callees
+ * write. a function whose key did not change gets its compiled body back, so
+ * only edited functions and their callers go through the pipeline again
+ *
+ * values of main used by functions are stored by their position in main's
+ * first block as parsed. functions that declare functions, and functions
+ * using values outside of that block, are always compiled
+ */
+class FunctionCache
+{
+private:
+	CompileCache& cache;
+	// keys of the functions that may be cached, taken before any pass
+	std::list<std::pair<SSA::Function*, std::string>> keys;
+	// main's first block as parsed
+	std::vector<SSA::Instruction*> foreign;
+	std::unordered_map<SSA::Instruction*, uint64_t> foreignIds;
+	std::unordered_set<SSA::Function*> reused;
+public:
+	// call right after parsing. options are those of the module's key
+	FunctionCache(CompileCache& cache, const std::string& options, SSA::Module* ir,
+			const std::list<Parser::FunctionSource>& sources);
+	// replaces the body of every unchanged function with its compiled body
+	void reuse();
+	bool isReused(SSA::Function* f) const;
+	// stores every function that was compiled, call after the pipeline
+	void store();
+};
+
+#endif /* INCLUDE_FUNCTIONCACHE_H_ */
@@ -0,0 +1,49 @@
+/*
+ * GVN.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_GVN_H_
+#define INCLUDE_GVN_H_
+
+#include "SSA.h"
+#include <list>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+
+/*
+ * dominator based global value numbering. computations, loads and calls to
+ * functions that do not write memory are replaced by an equal instruction
+ * in a dominating block, regardless of the lexical nesting the parser's CSE
+ * is limited to. calls use the summaries from summarizeFunctions
+ */
+class GlobalValueNumbering
+{
+private:
+	SSA::Function* f;
+	SSA::DominatorTree* domTree;
+	// scoped like Parser::cseStack, one level per dominator tree node
+	std::list<std::map<SSA::Opcode, std::list<SSA::Instruction*>>> valueStack;
+	std::unordered_map<SSA::Instruction*, SSA::Instruction*> leaders;
+	std::list<SSA::Instruction*> redundant;
+
+	void visit(SSA::BasicBlock* b);
+	bool isCandidate(SSA::Instruction* i) const;
+	bool isEqual(SSA::Instruction* x, SSA::Instruction* y) const;
+	SSA::Instruction* lookup(SSA::Instruction* i);
+	void memoryKill(SSA::Instruction* i);
+	std::unordered_set<SSA::BasicBlock*> getBlocksBetween(SSA::BasicBlock* idom,
+			SSA::BasicBlock* b) const;
+	SSA::Instruction* getLeader(SSA::Instruction* i) const;
+	void rewriteOperands(SSA::Instruction* i);
+public:
+	GlobalValueNumbering(SSA::Function* f);
+	// @return number of instructions eliminated
+	int run();
+};
+
+int globalValueNumbering(SSA::Function* f);
+int globalValueNumbering(SSA::Module* ir);
+
+#endif /* INCLUDE_GVN_H_ */
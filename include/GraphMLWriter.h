@@ -8,8 +8,6 @@
 
 #include "SSA.h"
 #include "RegAllocStructs.h"
-#include <iostream>
-#include <fstream>
 #include <string>
 #include <map>
 #include <utility>
@@ -23,32 +21,43 @@ namespace GraphML
 	static const std::string EXTENSION = ".graphml";
 	static const std::string TESTCASE_DIR = "testcases/";
 
-	static const char* const ERR = "IO error";
-
 	static const char* const HEADER =
 		"<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>\n"
 		"<graphml xmlns=\"http://graphml.graphdrawing.org/xmlns\" xmlns:java=\"http://www.yworks.com/xml/yfiles-common/1.0/java\" xmlns:sys=\"http://www.yworks.com/xml/yfiles-common/markup/primitives/2.0\" xmlns:x=\"http://www.yworks.com/xml/yfiles-common/markup/2.0\" xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\" xmlns:y=\"http://www.yworks.com/xml/graphml\" xmlns:yed=\"http://www.yworks.com/xml/yed/3\" xsi:schemaLocation=\"http://graphml.graphdrawing.org/xmlns http://www.yworks.com/xml/schema/graphml/1.1/ygraphml.xsd\">\n"
 		"	<key for=\"node\" id=\"d0\" yfiles.type=\"nodegraphics\"/>\n"
 		"	<graph id=\"G\" edgedefault=\"directed\">\n";
 
-	static const char* const GRAPH_HEADER =
-		"		<node id=\"{graph_id}\" yfiles.foldertype=\"group\">\n"
+	/*
+	 * templates are split at their placeholders, so a value is written
+	 * between consecutive fragments instead of being substituted
+	 */
+
+	// graph id, graph id, graph type
+	static const char* const GRAPH_HEADER[] = {
+		"		<node id=\"",
+		"\" yfiles.foldertype=\"group\">\n"
 		"			<data key=\"d0\">\n"
 		"				<y:ProxyAutoBoundsNode>\n"
 		"					<y:Realizers active=\"0\">\n"
 		"						<y:GroupNode>\n"
-		"							<y:NodeLabel>\"{graph_id}\"</y:NodeLabel>\n"
+		"							<y:NodeLabel>\"",
+		"\"</y:NodeLabel>\n"
 		"						</y:GroupNode>\n"
 		"					</y:Realizers>\n"
 		"				</y:ProxyAutoBoundsNode>\n"
 		"			</data>\n"
-		"			<graph edgedefault=\"{graph_type}\">\n";
-
-	static const char* const NODE_HEADER =
-		"				<node id=\"{node_id}\">\n"
+		"			<graph edgedefault=\"",
+		"\">\n"
+	};
+
+	// node id
+	static const char* const NODE_HEADER[] = {
+		"				<node id=\"",
+		"\">\n"
 		"					<data key=\"d0\">\n"
 		"						<y:ShapeNode>\n"
-		"							<y:NodeLabel alignment=\"left\" autoSizePolicy=\"content\">";
+		"							<y:NodeLabel alignment=\"left\" autoSizePolicy=\"content\">"
+	};
 
 	static const char* const NODE_FOOTER =
 		"							</y:NodeLabel>\n"
@@ -57,9 +66,14 @@ namespace GraphML
 		"					</data>\n"
 		"				</node>\n";
 
-	static const char* const EDGE =
-		"				<edge id=\"{id}\" source=\"{from}\" target=\"{to}\">\n"
-		"				</edge>\n";
+	// id, from, to
+	static const char* const EDGE[] = {
+		"				<edge id=\"",
+		"\" source=\"",
+		"\" target=\"",
+		"\">\n"
+		"				</edge>\n"
+	};
 
 	static const char* const GRAPH_FOOTER =
 		"			</graph>\n"
@@ -69,20 +83,58 @@ namespace GraphML
 		"	</graph>\n"
 		"</graphml>\n";
 
-	std::ofstream getFile(char const* subdir, char const* footer = "");
+	/*
+	 * appends to a buffer that is handed to the background writer when
+	 * destroyed, so dumping never waits for the disk
+	 */
+	class Writer
+	{
+	private:
+		std::string fileName;
+		std::string buffer;
+	public:
+		Writer(std::string fileName);
+		~Writer();
+		Writer& operator<<(const char* s);
+		Writer& operator<<(const std::string& s);
+		Writer& operator<<(int i);
+	};
+
+	// points in the pipeline whose dumps can be selected, none by default
+	enum DumpPoint
+	{
+		DUMP_SSA_FIRST = 1,
+		DUMP_REGALLOC = 2,
+		DUMP_IGRAPH = 4
+	};
+
+	/*
+	 * @param spec comma separated ssa-first, regalloc, igraph or all
+	 * @return false if a dump point is unknown
+	 */
+	bool setDumpPoints(std::string spec);
+	// @param spec comma separated shell patterns of function names, eg. main,f*
+	void setDumpFunctions(std::string spec);
+	bool isDumping(DumpPoint point);
+	// true if no patterns are set or one of them matches
+	bool isDumpingFunction(const std::string& funcName);
+
+	// the name of the output file, whose directories are created when it is written
+	std::string getFileName(char const* subdir, char const* footer = "");
 
-	void writeSSAEdge(std::ofstream& f, std::map<SSA::BasicBlock*, std::string>& BBtoNodeId,
+	void writeSSAEdge(Writer& w, std::map<SSA::BasicBlock*, int>& BBtoNodeId, std::string& funcName,
 					SSA::BasicBlock* from, SSA::BasicBlock* to, int& edgeId);
-	void writeSSAFunc(std::ofstream&, SSA::Function* func);
+	void writeSSAFunc(Writer& w, SSA::Function* func);
 
 	/**
 	 * @param ssa SSA IR to be outputted
 	 * @param s write output to graphml/{s}
 	 * output SSA IR in GraphML format, viewable in yEd GUI: https://www.yworks.com/products/yed
+	 * only functions selected by setDumpFunctions are written
 	 */
 	void SSAtoGraphML(SSA::Module* module, char const* subdir);
 
-	void InterferenceGraphToGraphML(InterferenceGraph graph, char const* subdir, char const* footer = "");
+	void InterferenceGraphToGraphML(const InterferenceGraph& graph, char const* subdir, char const* footer = "");
 
 };
 
@@ -0,0 +1,78 @@
+/*
+ * Interpreter.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_INTERPRETER_H_
+#define INCLUDE_INTERPRETER_H_
+
+#include "SSA.h"
+#include <cstdio>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/*
+ * executes a module after allocateRegisters. each call gets NUM_REG
+ * registers and a frame for spill slots, which is the same as the caller
+ * saving every register around the call. the global register holds the
+ * address between arrays, at negative offsets, and the frame, at non negative
+ * offsets
+ *
+ * the moves at the end of a block form a parallel copy, see insertMoveBeforePhi
+ *
+ * with allocated = false, values are kept per instruction instead of per
+ * register and phis are evaluated on entry, so the module can also be run
+ * before register allocation as a reference
+ */
+class Interpreter
+{
+private:
+	struct Frame
+	{
+		SSA::Function* f;
+		std::vector<int> regs;
+		std::unordered_map<SSA::Instruction*, int> values;
+		std::vector<int> slots;
+		std::list<int> args;
+	};
+	SSA::Module* ir;
+	bool allocated;
+	FILE* in;
+	FILE* out;
+	int globalSize;
+	std::vector<int> globals;
+	// values of instructions that other functions read, eg. globals of main
+	std::unordered_set<SSA::Instruction*> foreignReads;
+	std::unordered_map<SSA::Instruction*, int> foreignValues;
+	bool halted;
+	unsigned long instructionCount;
+	std::vector<unsigned long> opcodeCounts;
+	// loads and stores of spill slots, a subset of the load and store counts
+	unsigned long spillLoadCount;
+	unsigned long spillStoreCount;
+	std::unordered_map<SSA::BasicBlock*, unsigned long> blockCounts;
+	std::unordered_map<SSA::BasicBlock*, std::unordered_map<SSA::BasicBlock*, unsigned long>> edgeCounts;
+
+	int call(SSA::Function* f, std::list<int> args);
+	int callBuiltin(SSA::Function* f, std::list<int> args);
+	int getValue(Frame& frame, SSA::Operand* o);
+	void setValue(Frame& frame, SSA::Instruction* i, int v);
+	int& memory(Frame& frame, int address);
+	void count(SSA::Instruction* i);
+	void error(SSA::Instruction* i, std::string msg) const;
+public:
+	Interpreter(SSA::Module* ir, bool allocated = true, FILE* in = stdin, FILE* out = stdout);
+	void run();
+	unsigned long getInstructionCount() const;
+	unsigned long getOpcodeCount(SSA::Opcode op) const;
+	unsigned long getSpillLoadCount() const;
+	unsigned long getSpillStoreCount() const;
+	unsigned long getBlockCount(SSA::BasicBlock* b) const;
+	unsigned long getEdgeCount(SSA::BasicBlock* from, SSA::BasicBlock* to) const;
+	std::string statsToStr() const;
+};
+
+#endif /* INCLUDE_INTERPRETER_H_ */
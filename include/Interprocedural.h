@@ -0,0 +1,31 @@
+/*
+ * Interprocedural.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_INTERPROCEDURAL_H_
+#define INCLUDE_INTERPROCEDURAL_H_
+
+#include "SSA.h"
+
+/*
+ * computes the FunctionSummary of every function of the module from its
+ * body and the summaries of its callees. effects are iterated to a fixpoint
+ * over the call graph, starting from none, so recursive functions get the
+ * union of their effects and are never speculatable
+ *
+ * functions that are not in Module::getFuncs, eg. those reused by
+ * FunctionCache, keep their summary and are only used as callees
+ */
+void summarizeFunctions(SSA::Module* ir);
+
+/*
+ * moves calls to speculatable functions whose arguments are defined outside
+ * a loop to the loop's preheader, innermost loops first so calls leave
+ * whole nests. run after summarizeFunctions
+ * @return number of calls hoisted
+ */
+int hoistInvariantCalls(SSA::Function* f);
+int hoistInvariantCalls(SSA::Module* ir);
+
+#endif /* INCLUDE_INTERPROCEDURAL_H_ */
@@ -0,0 +1,34 @@
+/*
+ * JIT.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_JIT_H_
+#define INCLUDE_JIT_H_
+
+#include "SSA.h"
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+/*
+ * compiles a register allocated module with X86Gen into executable memory
+ * and runs it in process. the builtins are C functions reading and writing
+ * the streams given to run
+ */
+class JIT
+{
+private:
+	uint8_t* buffer;
+	std::size_t bufferSize;
+	std::size_t codeSize;
+	std::vector<int32_t> globals;
+public:
+	JIT(SSA::Module* ir);
+	~JIT();
+	// runs main, reading InputNum from in and writing OutputNum to out
+	void run(FILE* in = stdin, FILE* out = stdout);
+	std::size_t getCodeSize() const;
+};
+
+#endif /* INCLUDE_JIT_H_ */
@@ -0,0 +1,79 @@
+/*
+ * Liveness.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_LIVENESS_H_
+#define INCLUDE_LIVENESS_H_
+
+#include "SSA.h"
+#include <cstdint>
+#include <set>
+#include <vector>
+#include <unordered_map>
+
+/*
+ * dense set of value numbers, operated on 64 values at a time
+ */
+class BitVector
+{
+private:
+	std::vector<uint64_t> words;
+public:
+	BitVector() {}
+	BitVector(int size) : words((size + 63) / 64, 0) {}
+	void set(int i);
+	void reset(int i);
+	bool test(int i) const;
+	// @return true if any bit was added
+	bool unionWith(const BitVector& other);
+	void subtract(const BitVector& other);
+	bool operator==(const BitVector& other) const;
+	std::vector<int> toIndices() const;
+	int count() const;
+};
+
+/*
+ * iterative SSA liveness over the whole CFG
+ *
+ * liveOut(b) = U liveIn(s) + phi args in s coming from b, for each successor s
+ * liveIn(b)  = uses(b) + (liveOut(b) - defs(b))
+ *
+ * phi outputs are defs of the phi's block and phi args are uses at the end
+ * of the matching predecessor, so neither is live in the phi's block
+ */
+class Liveness
+{
+private:
+	SSA::Function* f;
+	std::vector<SSA::Instruction*> values;
+	std::unordered_map<SSA::Instruction*, int> valueIds;
+	std::unordered_map<SSA::BasicBlock*, BitVector> liveIn;
+	std::unordered_map<SSA::BasicBlock*, BitVector> liveOut;
+	void addValue(SSA::Instruction* i);
+	void addValues(SSA::Operand* o);
+public:
+	Liveness(SSA::Function* f);
+	int getNumValues() const;
+	// @return -1 if i does not produce a value
+	int getValueId(SSA::Instruction* i) const;
+	SSA::Instruction* getValue(int id) const;
+	const BitVector& getLiveIn(SSA::BasicBlock* b) const;
+	const BitVector& getLiveOut(SSA::BasicBlock* b) const;
+	// add values read by a non phi operand to live
+	void addUses(BitVector& live, SSA::Operand* o) const;
+};
+
+// allocator registers that a call to each function may write, see
+// getClobberedRegs
+typedef std::unordered_map<SSA::Function*, std::set<int>> ClobberSets;
+
+/*
+ * @return allocator registers of the values live across each call in f that
+ * the callee may write, which is what a caller has to save. callees missing
+ * from clobbers may write every register
+ */
+std::unordered_map<SSA::Instruction*, std::vector<int>> getRegsLiveAcrossCalls(SSA::Function* f,
+		const ClobberSets& clobbers);
+
+#endif /* INCLUDE_LIVENESS_H_ */
@@ -0,0 +1,46 @@
+/*
+ * LoopUnroll.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_LOOPUNROLL_H_
+#define INCLUDE_LOOPUNROLL_H_
+
+#include "SSA.h"
+
+const int DEFAULT_UNROLL_FACTOR = 4;
+
+/*
+ * loop in the shape produced by Parser::whileLoop where the body is a single
+ * basic block and the condition compares an induction variable against a
+ * loop invariant bound:
+ *
+ * preheader -> header: phis, invariants, cmp iv bound, branch
+ * header -> body -> header
+ * header -> exit
+ */
+struct CountedLoop
+{
+	SSA::BasicBlock* preheader;
+	SSA::BasicBlock* header;
+	SSA::BasicBlock* body;
+	SSA::BasicBlock* exit;
+	SSA::Instruction* iv;
+	SSA::Instruction* cmp;
+	SSA::Instruction* branch;
+	SSA::Operand* bound;
+	// exit opcode as if iv were the left operand of cmp
+	SSA::Opcode exitOp;
+	bool ivLeft;
+	int step;
+	// -1 if the trip count is only known at runtime
+	int tripCount;
+};
+
+bool matchCountedLoop(SSA::BasicBlock* header, CountedLoop& loop);
+
+bool unrollLoop(SSA::BasicBlock* header, int factor);
+void unrollLoops(SSA::Function* f, int factor = DEFAULT_UNROLL_FACTOR);
+void unrollLoops(SSA::Module* ir, int factor = DEFAULT_UNROLL_FACTOR);
+
+#endif /* INCLUDE_LOOPUNROLL_H_ */
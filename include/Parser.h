@@ -3,6 +3,9 @@
  * Author: Joshua Cao
  */
 
+#ifndef PARSER_H
+#define PARSER_H
+
 #include "Scanner.h"
 #include "SSA.h"
 #include <string>
@@ -25,6 +28,17 @@ public:
 
 class Parser
 {
+public:
+	// the tokens of a function and what they refer to outside of it, see FunctionCache
+	struct FunctionSource
+	{
+		SSA::Function* function;
+		std::string tokens;
+		// visible variables and arrays, and where its arrays start
+		std::string context;
+		// false if it declares functions, which may refer to its instructions
+		bool cacheable;
+	};
 private:
 	enum Opcode {add, sub, mul, div};
 	class Array
@@ -39,6 +53,7 @@ private:
 		Array(Parser* parser, std::vector<int> dims);
 		Array& operator=(const Array other);
 		static void resetTotalOffset();
+		static int getTotalOffset();
 		int getOffset();
 		std::vector<int> getDims() const;
 	};
@@ -60,6 +75,13 @@ private:
 
 	// keep track of instructions for CSE
 	std::list<std::map<SSA::Opcode, std::list<SSA::Instruction*>>> cseStack;
+	// size of cseStack when the innermost while loop started. instructions
+	// from before the loop are not in its use chain, so they miss its phis
+	std::size_t cseLoopDepth;
+
+	std::list<FunctionSource> functionSources;
+	// block of main that holds the global variables
+	SSA::BasicBlock* mainEntry;
 
 	// grammar parsing
 	void function();
@@ -110,7 +132,6 @@ private:
 	// CSE
 	void pushCSEmap();
 	void popCSEmap();
-	SSA::Operand* getMemoryAccessOffset(SSA::Instruction* store) const;
 	SSA::Instruction* cseCheck(SSA::Instruction* i);
 	void memoryKill(SSA::Instruction* ins);
 
@@ -118,7 +139,14 @@ private:
 	void emitFunc();
 	void emitBB(SSA::BasicBlock* bb);
 	void emit(SSA::BasicBlock* bb, SSA::Instruction* ins);
+
+	std::string describeContext();
+	std::string describeValue(SSA::Operand* value);
 public:
 	Parser(char const* s);
 	SSA::Module* parse();
+	// functions in the order their parsing finished
+	const std::list<FunctionSource>& getFunctionSources() const;
 };
+
+#endif
@@ -0,0 +1,73 @@
+/*
+ * PassManager.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_PASSMANAGER_H_
+#define INCLUDE_PASSMANAGER_H_
+
+#include "SSA.h"
+#include <functional>
+#include <list>
+#include <string>
+#include <vector>
+
+/*
+ * runs named module passes in a configurable order
+ *
+ * transforms run in registration order unless setPipeline picks others.
+ * analyses only run when named in the pipeline, which forces them to be
+ * computed so their cost shows up separately
+ *
+ * every step is timed and measured: wall time, instructions in the module
+ * before and after, and heap allocations made by the step on the thread
+ * running it. steps with the same name, eg. from several input files, are
+ * summed
+ */
+class PassManager
+{
+public:
+	typedef std::function<void(SSA::Module*)> Pass;
+private:
+	struct Registered
+	{
+		std::string name;
+		Pass pass;
+		bool analysis;
+	};
+	struct Stats
+	{
+		std::string name;
+		unsigned long runs;
+		double seconds;
+		long instructionsBefore;
+		long instructionsAfter;
+		unsigned long allocations;
+		unsigned long bytes;
+	};
+	std::vector<Registered> passes;
+	std::list<std::string> pipeline;
+	bool defaultPipeline;
+	std::vector<Stats> stats;
+
+	const Registered* find(std::string name) const;
+public:
+	PassManager();
+	void registerPass(std::string name, Pass pass);
+	void registerAnalysis(std::string name, Pass pass);
+	/*
+	 * @param spec comma separated pass and analysis names
+	 * @return false if a name is not registered
+	 */
+	bool setPipeline(std::string spec);
+	bool contains(std::string name) const;
+	void run(SSA::Module* ir);
+	// runs and measures a step outside the pipeline, eg. parsing. ir may change
+	void time(std::string name, SSA::Module* const& ir, std::function<void()> step);
+	std::string statsToStr() const;
+	std::string passesToStr() const;
+	// the pipeline, comma separated
+	std::string pipelineToStr() const;
+};
+
+#endif /* INCLUDE_PASSMANAGER_H_ */
@@ -0,0 +1,34 @@
+/*
+ * Profile.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_PROFILE_H_
+#define INCLUDE_PROFILE_H_
+
+#include "SSA.h"
+#include <cstdio>
+#include <string>
+
+/*
+ * block and edge execution counts for profile guided optimization
+ *
+ * blocks are identified by function name and position right after parsing,
+ * so a profile recorded by one compile applies to later compiles of the same
+ * source. a function whose number of blocks changed is skipped as stale.
+ * the file has one entry per line:
+ * 	function <name> <number of blocks>
+ * 	block <index> <count>
+ * 	edge <from> <to> <count>
+ *
+ * loaded counts are kept on the blocks, see BasicBlock::getCount, and used by
+ * unrollLoops, canonicalizeCFG and the spill costs of allocateRegisters
+ */
+
+// runs the module as parsed with the Interpreter and writes its counts
+void recordProfile(SSA::Module* ir, std::string fileName, FILE* in = stdin, FILE* out = stdout);
+
+// must be called before any pass changes the CFG
+void loadProfile(SSA::Module* ir, std::string fileName);
+
+#endif /* INCLUDE_PROFILE_H_ */
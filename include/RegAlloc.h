@@ -6,16 +6,39 @@
 #ifndef REGISTER_ALLOCATOR
 #define REGISTER_ALLOCATOR
 
+#include "Liveness.h"
 #include "RegAllocStructs.h"
 #include "SSA.h"
 #include <iostream>
 
 extern int numIters;
 
-void addOperandToLive(std::list<SSA::Instruction*>& live, SSA::Operand* o);
 void insertMoveBeforePhi(SSA::Function* f);
 
+/*
+ * orders a parallel copy of destination, source pairs so that no source is
+ * overwritten before it is read. cycles are broken through scratch
+ */
+std::list<std::pair<int, int>> sequentializeMoves(std::list<std::pair<int, int>> moves, int scratch);
+
+/*
+ * registers each function may write, itself or through its calls, ie. what
+ * a caller loses across a call to it. builtins write none. recursive
+ * functions are iterated to a fixpoint
+ */
+ClobberSets getClobberedRegs(SSA::Module* ir);
+
+/*
+ * values live across a call prefer registers the callee does not write, so
+ * the caller need not save them. callees missing from clobbers may write
+ * every register
+ */
+void allocateRegisters(SSA::Function* f, const ClobberSets& clobbers);
 void allocateRegisters(SSA::Function* f);
+/*
+ * allocates bottom-up over the call graph, so callees are allocated, and
+ * their clobber sets known, before their callers
+ */
 void allocateRegisters(SSA::Module* ir);
 
 #endif
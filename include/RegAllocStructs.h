@@ -9,6 +9,7 @@
 #include "SSA.h"
 #include "RegAlloc.h"
 #include <algorithm>
+#include <set>
 #include <vector>
 #include <unordered_map>
 #include <stack>
@@ -37,16 +38,22 @@ private:
 	std::vector<std::vector<bool>> adjacencyMatrix;
 	std::list<Node> nodes;
 	SSA::Function* f;
+	std::unordered_map<SSA::Instruction*, float> spillCosts;
+	std::unordered_map<SSA::Instruction*, std::set<int>> avoided;
 
 	void clearMatrixEdges(Node n);
 	Node* getNode(SSA::Instruction* i);
 	Node* popNode(int k);
+	void computeSpillCosts();
 	std::list<Node>::iterator spillNode();
 public:
 	InterferenceGraph(std::vector<SSA::Instruction*> instructions, SSA::Function* f);
 	void addEdge(SSA::Instruction* x, SSA::Instruction* y);
+	// i gets one of regs only if no other color is free
+	void avoidRegs(SSA::Instruction* i, const std::set<int>& regs);
 	std::list<Node> getNodes() const;
-	void colorGraph(int k);
+	// @return false if values were spilled, and f has to be allocated again
+	bool colorGraph(int k);
 };
 
 class IntervalList
@@ -65,8 +72,17 @@ public:
 		bool intersects(Interval other) const;
 	};
 private:
+	// by creation, which is the order the heap addresses this map was keyed
+	// by mostly had, without depending on the allocator
+	struct CreationOrder
+	{
+		bool operator()(SSA::Instruction* x, SSA::Instruction* y) const
+		{
+			return x->getCreation() < y->getCreation();
+		}
+	};
 	SSA::Function* f;
-	std::map<SSA::Instruction*, Interval> intervals;
+	std::map<SSA::Instruction*, Interval, CreationOrder> intervals;
 public:
 	IntervalList(SSA::Function* f) : f(f) {}
 	std::list<std::pair<int, int>> getRanges(SSA::Instruction* i) const;
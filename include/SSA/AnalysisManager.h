@@ -0,0 +1,41 @@
+/*
+ * AnalysisManager.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_SSA_ANALYSISMANAGER_H_
+#define INCLUDE_SSA_ANALYSISMANAGER_H_
+
+namespace SSA
+{
+
+class Function;
+class DominatorTree;
+class DominanceFrontier;
+class LoopForest;
+
+/*
+ * computes control flow analyses of a function on demand and caches them
+ * until the function's control flow graph changes. adding or removing
+ * instructions does not invalidate anything
+ */
+class AnalysisManager
+	{
+	private:
+		Function* f;
+		DominatorTree* domTree;
+		DominanceFrontier* domFrontier;
+		LoopForest* loops;
+	public:
+		AnalysisManager(Function* f)
+			: f(f), domTree(nullptr), domFrontier(nullptr), loops(nullptr) {}
+		~AnalysisManager();
+		DominatorTree* getDominatorTree();
+		DominanceFrontier* getDominanceFrontier();
+		LoopForest* getLoopForest();
+		void invalidate();
+	};
+
+}
+
+#endif /* INCLUDE_SSA_ANALYSISMANAGER_H_ */
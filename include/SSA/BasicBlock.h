@@ -7,6 +7,7 @@
 #define INCLUDE_SSA_BASICBLOCK_H_
 
 #include <list>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace SSA
@@ -26,9 +27,16 @@ class BasicBlock
 		std::list<BasicBlock*> succ;
 		std::list<Instruction*>::iterator getInstructionIter(Instruction* i);
 		bool loopHeader;
+		// execution counts from a profile, -1 if unknown. see Profile.h
+		long count;
+		std::unordered_map<BasicBlock*, long> edgeCounts;
+		// creation order, see BlockOrder
+		unsigned long serial;
+		static unsigned long nextSerial;
+		void cfgChanged();
 	public:
-		BasicBlock() : parent(nullptr), loopHeader(false) {}
-		BasicBlock(bool loopHeader) : parent(nullptr), loopHeader(loopHeader) {}
+		BasicBlock() : parent(nullptr), loopHeader(false), count(-1), serial(nextSerial++) {}
+		BasicBlock(bool loopHeader) : parent(nullptr), loopHeader(loopHeader), count(-1), serial(nextSerial++) {}
 		~BasicBlock();
 		Function* getParent() const;
 		void setParent(Function* f);
@@ -37,12 +45,22 @@ class BasicBlock
 		void emitFront(Instruction* ins);
 		void emitBefore(Instruction* x, Instruction* y);
 		void emitAfter(Instruction* x, Instruction* y);
+		void remove(Instruction* ins);
 		std::list<Instruction*>& getInstructions();
 		void addPredecessor(BasicBlock* pred);
 		void addSuccessor(BasicBlock* succ);
+		void replacePredecessor(BasicBlock* oldPred, BasicBlock* newPred);
+		void replaceSuccessor(BasicBlock* oldSucc, BasicBlock* newSucc);
+		// the caller must invert the branch
+		void swapSuccessors();
 		std::list<BasicBlock*> getPredecessors();
 		std::list<BasicBlock*> getSuccessors();
 		bool isLoopHeader() const;
+		long getCount() const;
+		void setCount(long count);
+		long getEdgeCount(BasicBlock* succ) const;
+		void setEdgeCount(BasicBlock* succ, long count);
+		unsigned long getSerial() const;
 	};
 
 }
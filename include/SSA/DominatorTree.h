@@ -0,0 +1,71 @@
+/*
+ * DominatorTree.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_SSA_DOMINATORTREE_H_
+#define INCLUDE_SSA_DOMINATORTREE_H_
+
+#include <list>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace SSA
+{
+
+class Instruction;
+class BasicBlock;
+class Function;
+
+/*
+ * K. D. Cooper, T. J. Harvey, K. Kennedy
+ * A Simple, Fast Dominance Algorithm
+ *
+ * blocks unreachable from the entry have no immediate dominator and are not
+ * dominated by anything
+ */
+class DominatorTree
+	{
+	private:
+		Function* f;
+		BasicBlock* entry;
+		std::vector<BasicBlock*> postOrder;
+		std::unordered_map<BasicBlock*, int> postOrderIds;
+		std::unordered_map<BasicBlock*, BasicBlock*> idoms;
+		std::unordered_map<BasicBlock*, std::list<BasicBlock*>> children;
+		// preorder numbering of the tree for constant time dominance queries
+		std::unordered_map<BasicBlock*, std::pair<int, int>> treeIds;
+		void computePostOrder();
+		void computeTreeIds();
+		BasicBlock* intersect(BasicBlock* x, BasicBlock* y) const;
+	public:
+		DominatorTree(Function* f);
+		Function* getFunction() const;
+		BasicBlock* getEntry() const;
+		BasicBlock* getIDom(BasicBlock* b) const;
+		std::list<BasicBlock*> getChildren(BasicBlock* b) const;
+		std::vector<BasicBlock*> getReversePostOrder() const;
+		bool isReachable(BasicBlock* b) const;
+		bool dominates(BasicBlock* x, BasicBlock* y) const;
+		bool dominates(Instruction* x, Instruction* y) const;
+	};
+
+/*
+ * K. D. Cooper, T. J. Harvey, K. Kennedy
+ * A Simple, Fast Dominance Algorithm
+ * Figure 5. dominance frontier algorithm
+ */
+class DominanceFrontier
+	{
+	private:
+		std::unordered_map<BasicBlock*, std::unordered_set<BasicBlock*>> frontiers;
+	public:
+		DominanceFrontier(DominatorTree* domTree);
+		std::unordered_set<BasicBlock*> getFrontier(BasicBlock* b) const;
+		bool isInFrontier(BasicBlock* x, BasicBlock* y) const;
+	};
+
+}
+
+#endif /* INCLUDE_SSA_DOMINATORTREE_H_ */
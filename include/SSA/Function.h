@@ -8,8 +8,10 @@
 
 #include <string>
 #include <list>
+#include <set>
 #include <unordered_set>
 #include "BasicBlock.h"
+#include "AnalysisManager.h"
 
 namespace SSA
 {
@@ -19,6 +21,35 @@ class Instruction;
 class Function;
 class Module;
 
+/*
+ * side effects of a function and everything it calls, see Interprocedural.h.
+ * the default assumes the worst, for functions that were not summarized
+ */
+struct FunctionSummary
+{
+	// offsets of the arrays it may load from or store to, see Module::getArray
+	std::set<int> readArrays;
+	std::set<int> writtenArrays;
+	// accesses an address that is not known to be in one array
+	bool readsAnywhere;
+	bool writesAnywhere;
+	// reads input or writes output
+	bool io;
+	// always returns, without side effects or runtime errors
+	bool speculatable;
+	FunctionSummary()
+		: readsAnywhere(true), writesAnywhere(true), io(true), speculatable(false) {}
+	bool isPure() const;
+	bool isReadOnly() const;
+	// array 0 is any address
+	bool mayRead(int array) const;
+	bool mayWrite(int array) const;
+	// whether a call may change what a call to reader loads
+	bool mayClobber(const FunctionSummary& reader) const;
+	bool operator==(const FunctionSummary& other) const;
+	std::string toStr() const;
+};
+
 class Function
 	{
 	private:
@@ -28,23 +59,40 @@ class Function
 		// keep track of locals offset for spilling later
 		// optimally keep track of some sort of mapping for better optimizations
 		int localVariableOffset;
+		// bytes of spill slots, at non negative offsets from the global register
+		int frameSize;
 		Module* parent;
+		AnalysisManager analyses;
+		FunctionSummary summary;
 	public:
 		Function(Module* module, std::string name)
-			: name(name), isVoidReturn(true), localVariableOffset(0), parent(module) {}
+			: name(name), isVoidReturn(true), localVariableOffset(0), frameSize(0), parent(module), analyses(this) {}
 		Function(Module* module, std::string name, bool isVoid)
-					: name(name), isVoidReturn(isVoid), localVariableOffset(0), parent(module) {}
+					: name(name), isVoidReturn(isVoid), localVariableOffset(0), frameSize(0), parent(module), analyses(this) {}
 		~Function();
 		void emit(BasicBlock* bb);
+		void emitAfter(BasicBlock* x, BasicBlock* y);
 		std::string getName();
 		std::list<BasicBlock*> getBBs();
+		// reorder blocks. edges are unchanged, so analyses stay valid
+		void setBBs(std::list<BasicBlock*> order);
+		// replaces the blocks and frame with those of other, which is left empty
+		void takeBody(Function* other);
 		Module* getParent() const;
 		bool isVoid() const;
+		bool isBuiltin() const;
 		int getLocalVariableOffset() const;
 		void setIsVoid(bool isVoid);
 		void setLocalVariableOffset(int i);
+		int getFrameSize() const;
+		void setFrameSize(int size);
 		int resetLineIds();
 		void resetRegs();
+		const FunctionSummary& getSummary() const;
+		void setSummary(const FunctionSummary& s);
+		AnalysisManager& getAnalyses();
+		// call whenever blocks or edges are added or removed
+		void invalidateAnalyses();
 	};
 
 }
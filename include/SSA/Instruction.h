@@ -25,7 +25,10 @@ class Instruction
 	{
 	private:
 		static uint idCount;
+		static unsigned long creationCount;
 		uint id;
+		// order of creation, which setId does not change
+		unsigned long creation;
 		BasicBlock* parent;
 		int reg;
 		Opcode op;
@@ -36,14 +39,15 @@ class Instruction
 	Instruction(Opcode op) : Instruction(op, nullptr, nullptr) {};
 		Instruction(Opcode op, Operand* x) : Instruction(op, x, nullptr) {};
 		Instruction(Opcode op, Operand* x, Operand* y)
-					: op(op), parent(nullptr), x(x), y(y), id(idCount++), reg(-1) {};
+					: op(op), parent(nullptr), x(x), y(y), id(idCount++), creation(creationCount++), reg(-1) {};
 		Instruction(const Instruction &other)
 			: op(other.op), x(other.x), y(other.y), parent(other.parent),
-			  reg(other.reg), id(other.id) {}
+			  reg(other.reg), id(other.id), creation(creationCount++) {}
 		virtual ~Instruction();
 		Instruction* clone() const;
 		virtual bool equals(Instruction* other);
 		uint getId() const;
+		unsigned long getCreation() const;
 		BasicBlock* getParent() const;
 		int getReg() const;
 		bool hasOutput() const;
@@ -51,6 +55,7 @@ class Instruction
 		void setParent(BasicBlock* b);
 		void setReg(int reg);
 		Opcode const getOpcode();
+		void setOpcode(Opcode op);
 		Operand* const getOperand1();
 		Operand* const getOperand2();
 		void setOperand1(Operand* o);
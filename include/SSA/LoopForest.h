@@ -0,0 +1,56 @@
+/*
+ * LoopForest.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_SSA_LOOPFOREST_H_
+#define INCLUDE_SSA_LOOPFOREST_H_
+
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace SSA
+{
+
+class BasicBlock;
+class DominatorTree;
+
+/*
+ * natural loops, found from back edges whose target dominates the source.
+ * the parser only produces reducible control flow, so every cycle is a
+ * natural loop
+ */
+class LoopForest
+	{
+	public:
+		struct Loop
+		{
+		public:
+			Loop(BasicBlock* header, Loop* parent);
+			BasicBlock* header;
+			Loop* parent;
+			std::list<Loop*> children;
+			std::list<BasicBlock*> latches;
+			std::unordered_set<BasicBlock*> blocks;
+			// outermost loops have depth 1
+			int depth;
+			bool contains(BasicBlock* b) const;
+		};
+	private:
+		std::list<Loop*> loops;
+		std::list<Loop*> topLevelLoops;
+		std::unordered_map<BasicBlock*, Loop*> innermostLoops;
+	public:
+		LoopForest(DominatorTree* domTree);
+		~LoopForest();
+		std::list<Loop*> getLoops() const;
+		std::list<Loop*> getTopLevelLoops() const;
+		Loop* getLoopFor(BasicBlock* b) const;
+		int getLoopDepth(BasicBlock* b) const;
+		bool isLoopHeader(BasicBlock* b) const;
+	};
+
+}
+
+#endif /* INCLUDE_SSA_LOOPFOREST_H_ */
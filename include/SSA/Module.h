@@ -7,6 +7,7 @@
 #define INCLUDE_SSA_MODULE_H_
 
 #include <list>
+#include <map>
 #include <unordered_set>
 #include <string>
 
@@ -23,6 +24,8 @@ class Module
 	private:
 		std::list<Function*> funcs;
 		std::unordered_set<SSA::Operand*> ops;
+		// size in bytes of every array by its offset from the global register
+		std::map<int, int> arrays;
 	public:
 		Module();
 		~Module();
@@ -31,6 +34,11 @@ class Module
 		std::list<Function*>& getFuncs();
 		Function* getFunction(std::string name) const;
 		void addOperand(SSA::Operand* o);
+		void addArray(int offset, int size);
+		// @return offset of the array containing address, 0 if there is none
+		int getArray(int address) const;
+		// @return size in bytes of the array at offset, 0 if there is none
+		int getArraySize(int offset) const;
 		// this is SUPER expensive but this whole compilers memory management sucks
 		// so this works as a bandaid by clearing out unused operands
 		void cleanOperands();
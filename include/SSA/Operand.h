@@ -18,6 +18,12 @@ class BasicBlock;
 class Function;
 class Module;
 
+// orders blocks by creation, so phi arguments do not depend on heap addresses
+struct BlockOrder
+{
+	bool operator()(const BasicBlock* x, const BasicBlock* y) const;
+};
+
 class Operand
 	{
 	public:
@@ -46,8 +52,9 @@ class Operand
 
 		virtual std::string getVarName() const;
 		virtual Operand* getPhiArg(BasicBlock* b) const;
-		virtual std::map<BasicBlock*, Operand*> getPhiArgs() const;
+		virtual std::map<BasicBlock*, Operand*, BlockOrder> getPhiArgs() const;
 		virtual void addPhiArg(BasicBlock* b, Operand* o) {}
+		virtual void replacePhiBlock(BasicBlock* oldBlock, BasicBlock* newBlock) {}
 	};
 
 	class ValOperand : public Operand
@@ -86,7 +93,7 @@ class Operand
 	{
 	private:
 		std::string varName;
-		std::map<BasicBlock*, Operand*> args;
+		std::map<BasicBlock*, Operand*, BlockOrder> args;
 	public:
 		PhiOperand(std::string varName) : varName(varName) {}
 		PhiOperand(std::string varName, BasicBlock* b, Operand* o);
@@ -97,8 +104,9 @@ class Operand
 		std::list<Operand*> getArgs() const;
 		void replaceArg(SSA::Operand* oldOp, SSA::Operand* newOp);
 		virtual bool containsArg(SSA::Operand* o);
-		std::map<BasicBlock*, Operand*> getPhiArgs() const;
+		std::map<BasicBlock*, Operand*, BlockOrder> getPhiArgs() const;
 		void addPhiArg(BasicBlock* b, Operand* o);
+		void replacePhiBlock(BasicBlock* oldBlock, BasicBlock* newBlock);
 		std::string toStr();
 	};
 
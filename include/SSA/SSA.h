@@ -11,5 +11,8 @@
 #include "BasicBlock.h"
 #include "Function.h"
 #include "Module.h"
+#include "DominatorTree.h"
+#include "LoopForest.h"
+#include "AnalysisManager.h"
 
 #endif
@@ -6,14 +6,48 @@
 #ifndef INCLUDE_SSA_SSAUTILS_H_
 #define INCLUDE_SSA_SSAUTILS_H_
 
+#include <list>
 #include <string>
 
 namespace SSA
 {
 
 enum Opcode : uint;
+class Operand;
+class Instruction;
+class Function;
 
 std::string opToStr(Opcode op);
 
+/*
+ * @return offset operand of the adda feeding a load or store, or nullptr
+ */
+Operand* getMemoryAccessOffset(Instruction* i);
+
+/*
+ * indices are assumed to be in bounds, so an offset of add #base, index
+ * stays in the array at base
+ * @return offset of the array a load or store accesses, see
+ * Module::getArray, or 0 if unknown
+ */
+int getAccessedArray(Instruction* i);
+
+/*
+ * @return instructions read by i, including phi and call args
+ */
+std::list<Instruction*> getValues(Instruction* i);
+
+/*
+ * @return function i calls, or nullptr if i is not a call
+ */
+Function* getCallee(Instruction* i);
+
+/*
+ * @return every function f calls, once, in the order of their first call
+ */
+std::list<Function*> getCallees(Function* f);
+
+bool isBranch(Opcode op);
+
 }
 #endif /* INCLUDE_SSA_SSAUTILS_H_ */
@@ -10,6 +10,7 @@
 #include <fstream>
 #include <iostream>
 #include <string>
+#include <vector>
 
 namespace LexAnalysis
 {
@@ -62,6 +63,12 @@ namespace LexAnalysis
 	private:
 		std::ifstream f;
 		char c;
+		// tokens since the outermost startRecording, and where each recording starts
+		std::string recorded;
+		std::vector<std::size_t> recordingStarts;
+		std::size_t lastTokenStart;
+		void scan();
+		void record();
 		void err();
 		void check_keywords();
 		void comment();
@@ -73,6 +80,10 @@ namespace LexAnalysis
 		int linenum;
 		Scanner(char const* s);
 		void next();
+		// records the current token and every following one, recordings may nest
+		void startRecording();
+		// @return the tokens since the matching startRecording, except the current one
+		std::string stopRecording();
 	};
 
 	char const* tkToStr(Token tk);
@@ -0,0 +1,29 @@
+/*
+ * Server.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_SERVER_H_
+#define INCLUDE_SERVER_H_
+
+#include <functional>
+#include <string>
+
+/*
+ * long running compiler for many small compiles, see ServerProtocol.h
+ *
+ * every request runs compile in a process forked from the server ahead of
+ * time, so it starts without exec, dynamic linking, static initialization
+ * or waiting for a fork, from the server's already mapped memory. the
+ * compiler keeps global state and exits on errors, so a request cannot run
+ * in the server itself. a request is stopped when its client disconnects
+ *
+ * SIGINT and SIGTERM stop the server and remove the socket. a stale socket
+ * of a stopped server is replaced, one of a running server is an error
+ *
+ * @param compile the command line compiler, called with the client's arguments
+ * @return exit status if the socket cannot be set up, otherwise it never returns
+ */
+int runServer(std::string socketPath, std::function<int(int, char**)> compile);
+
+#endif /* INCLUDE_SERVER_H_ */
@@ -0,0 +1,43 @@
+/*
+ * ServerProtocol.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_SERVERPROTOCOL_H_
+#define INCLUDE_SERVERPROTOCOL_H_
+
+#include <string>
+
+/*
+ * protocol between compiler-client and compiler --server on a unix socket
+ *
+ * a frame is its length as 4 little endian bytes, then its bytes. the
+ * client sends one byte carrying its stdin, stdout and stderr, then the
+ * frames
+ * 	HELLO, working directory, number of arguments, the arguments
+ * and the server answers with one frame, "exit <status>", "signal <number>"
+ * or "error <message>". the compiler runs in the client's directory on the
+ * client's descriptors, so input, output and files are the same as without
+ * the server
+ */
+namespace ServerProtocol
+{
+
+	static const char* const HELLO = "compile 1";
+	// requests are small, a longer frame is an error
+	static const std::size_t MAX_FRAME = 1 << 20;
+
+	// $COMPILER_SERVER, or /tmp/compiler-<uid>.sock
+	std::string defaultSocketPath();
+
+	bool writeFrame(int fd, const std::string& frame);
+	// @return false at the end of the stream, on an error or if the frame is too long
+	bool readFrame(int fd, std::string& frame);
+
+	bool sendDescriptors(int socket, const int* fds, int count);
+	// @return false unless exactly count descriptors arrived
+	bool receiveDescriptors(int socket, int* fds, int count);
+
+};
+
+#endif /* INCLUDE_SERVERPROTOCOL_H_ */
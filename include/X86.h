@@ -0,0 +1,65 @@
+/*
+ * X86.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_X86_H_
+#define INCLUDE_X86_H_
+
+#include <cstdint>
+#include <vector>
+
+/*
+ * the subset of x86-64 encodings the backends need. memory operands are
+ * always [base + index + disp32], index -1 for none, and jumps take a rel32
+ * which is patched once the target is known
+ */
+namespace X86
+{
+
+	enum Reg
+	{
+		RAX, RCX, RDX, RBX, RSP, RBP, RSI, RDI,
+		R8, R9, R10, R11, R12, R13, R14, R15
+	};
+
+	// condition codes of Jcc rel32, the second opcode byte
+	static const uint8_t JE = 0x84;
+	static const uint8_t JNE = 0x85;
+	static const uint8_t JL = 0x8C;
+	static const uint8_t JGE = 0x8D;
+	static const uint8_t JLE = 0x8E;
+	static const uint8_t JG = 0x8F;
+	static const uint8_t JB = 0x82;
+	static const uint8_t JBE = 0x86;
+	static const uint8_t JA = 0x87;
+	static const uint8_t JS = 0x88;
+	static const uint8_t JNS = 0x89;
+
+	class Assembler
+	{
+	private:
+		std::vector<uint8_t> code;
+	public:
+		const std::vector<uint8_t>& getCode() const;
+		int size() const;
+
+		void emitByte(uint8_t b);
+		void emitImm32(int32_t imm);
+		void emitRex(bool w, int reg, int index, int base);
+		// opcode with a register direct ModRM
+		void emitRegOp(std::vector<uint8_t> opcode, int reg, int rm, bool w = false);
+		void emitMemOp(std::vector<uint8_t> opcode, int reg, int base, int index, int32_t disp, bool w = false);
+		void emitMov(int dst, int src);
+		void emitMovImm(int dst, int32_t imm);
+		void emitMovImm64(int dst, uint64_t imm);
+		void emitPush(int r);
+		void emitPop(int r);
+		// @return position of the rel32 to patch
+		int emitJump(std::vector<uint8_t> opcode);
+		void patch(int pos, int target);
+	};
+
+};
+
+#endif /* INCLUDE_X86_H_ */
@@ -0,0 +1,94 @@
+/*
+ * X86Gen.h
+ * Author: Joshua Cao
+ */
+
+#ifndef INCLUDE_X86GEN_H_
+#define INCLUDE_X86GEN_H_
+
+#include "Liveness.h"
+#include "SSA.h"
+#include "X86.h"
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * lowers a register allocated module to x86-64
+ *
+ * the allocator's registers live in the callee saved rbx, rbp, r12 to r15, so
+ * the builtins can be plain C calls. everything else is scratch. values are
+ * 32 bits and addresses are kept as 32 bit offsets from the global register,
+ * which the loads and stores add to an absolute address. spill slots are at
+ * [rsp + offset]
+ *
+ * calls follow CodeGen: the caller pushes the registers live across the call
+ * that the callee may write and the args last to first, and the callee
+ * returns in eax. array accesses with a computed index are checked against
+ * their array, or the whole global buffer if the array is unknown
+ */
+class X86Gen
+{
+public:
+	/*
+	 * absolute addresses the code is generated against. the helpers follow
+	 * the System V ABI: inputNum returns in eax, outputNum takes edi
+	 */
+	struct Runtime
+	{
+		// top of getGlobalSize() bytes of zeroed memory
+		uint64_t globalReg;
+		uint64_t inputNum;
+		uint64_t outputNum;
+		uint64_t outputNewLine;
+		uint64_t divisionByZero;
+		uint64_t outOfBounds;
+	};
+private:
+	SSA::Module* ir;
+	X86::Assembler as;
+	Runtime runtime;
+	std::unordered_map<SSA::Function*, int> entries;
+	// call rel32 to patch once every function has an entry
+	std::list<std::pair<int, SSA::Function*>> calls;
+	// offsets from the global register of values read by other functions
+	std::unordered_map<SSA::Instruction*, int> exports;
+	// registers each function may write, so callers save only those
+	ClobberSets clobbers;
+	int globalSize;
+
+	// per function state
+	SSA::Function* f;
+	int frameBytes;
+	int numPops;
+	std::unordered_map<SSA::Instruction*, int> numUses;
+	std::unordered_map<SSA::Instruction*, std::vector<int>> savedRegs;
+
+	void generate(SSA::Function* func);
+	void generate(SSA::Instruction* i, SSA::Instruction* prev, SSA::Instruction* next);
+	void generateMoves(std::list<SSA::Instruction*> moves);
+	void generateArithmetic(SSA::Instruction* i);
+	void generateMemoryAccess(SSA::Instruction* i, SSA::Instruction* prev);
+	void generateCall(SSA::Instruction* i);
+	void generateReturn(SSA::Operand* value);
+	void callHelper(uint64_t helper);
+	bool isFused(SSA::Instruction* adda, SSA::Instruction* memAccess);
+	bool getConst(SSA::Operand* o, int& c);
+	int use(SSA::Operand* o, int scratch);
+	int dest(SSA::Instruction* i);
+	int reg(int allocReg);
+	void exportValue(SSA::Instruction* i);
+public:
+	// lays out the globals, see getGlobalSize
+	X86Gen(SSA::Module* ir);
+	int getGlobalSize() const;
+	/*
+	 * generates the module. offset 0 is an entry callable from C which runs
+	 * main with every allocator register at 0
+	 */
+	void generate(const Runtime& runtime);
+	const std::vector<uint8_t>& getCode() const;
+};
+
+#endif /* INCLUDE_X86GEN_H_ */
@@ -0,0 +1,18 @@
+function factIter 4
+block 0 1
+edge 0 1 1
+block 1 11
+edge 1 2 10
+edge 1 3 1
+block 2 10
+edge 2 1 10
+block 3 1
+function factRec 3
+block 0 10
+edge 0 1 1
+edge 0 2 9
+block 1 1
+edge 1 2 0
+block 2 9
+function main 1
+block 0 1
@@ -0,0 +1,135 @@
+/*
+ * AsyncWriter.cpp
+ * Author: Joshua Cao
+ */
+
+#include "AsyncWriter.h"
+#include "Directory.h"
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <sys/stat.h>
+#include <unistd.h>
+
+struct QueuedFile
+{
+	std::string fileName;
+	std::string contents;
+	bool executable;
+};
+
+static std::mutex queueMutex;
+// signals the writer that a file was queued, and writers that space was freed
+static std::condition_variable queueChanged;
+static std::condition_variable queueShrunk;
+static std::deque<QueuedFile> queue;
+static std::size_t queuedBytes = 0;
+static bool stopping = false;
+static bool failed = false;
+static std::thread writer;
+
+// @return false if the file could not be written
+static bool writeFile(const QueuedFile& file)
+{
+	std::size_t dirIndex = file.fileName.find_last_of('/');
+	if (dirIndex != std::string::npos)
+	{
+		makeDirectories(file.fileName.substr(0, dirIndex));
+	}
+	// written under a name of this process and renamed, so no process sees a partial file
+	std::string tempName = file.fileName + "." + std::to_string(getpid()) + ".tmp";
+	FILE* out = fopen(tempName.c_str(), "wb");
+	if (!out)
+	{
+		return false;
+	}
+	bool written = fwrite(file.contents.data(), 1, file.contents.size(), out) == file.contents.size();
+	written = fclose(out) == 0 && written;
+	if (written && file.executable)
+	{
+		written = chmod(tempName.c_str(), 0755) == 0;
+	}
+	written = written && rename(tempName.c_str(), file.fileName.c_str()) == 0;
+	if (!written)
+	{
+		remove(tempName.c_str());
+	}
+	return written;
+}
+
+static void writeFiles()
+{
+	std::unique_lock<std::mutex> lock(queueMutex);
+	while (true)
+	{
+		queueChanged.wait(lock, []() { return !queue.empty() || stopping; });
+		if (queue.empty())
+		{
+			return;
+		}
+		// stays queued while it is written, so its bytes still count
+		QueuedFile& file = queue.front();
+		lock.unlock();
+		bool written = writeFile(file);
+		if (!written)
+		{
+			fprintf(stderr, "cannot write %s\n", file.fileName.c_str());
+		}
+		lock.lock();
+		failed = failed || !written;
+		queuedBytes -= file.contents.size();
+		queue.pop_front();
+		queueShrunk.notify_all();
+	}
+}
+
+static void finishWritesAtExit()
+{
+	finishWrites();
+}
+
+void writeFileAsync(std::string fileName, std::string contents, bool executable)
+{
+	std::unique_lock<std::mutex> lock(queueMutex);
+	if (!writer.joinable())
+	{
+		static bool registered = false;
+		if (!registered)
+		{
+			// runs before writer is destroyed
+			atexit(finishWritesAtExit);
+			registered = true;
+		}
+		stopping = false;
+		writer = std::thread(writeFiles);
+	}
+	queueShrunk.wait(lock, [&]() { return queue.empty() || queuedBytes + contents.size() <= MAX_QUEUED_BYTES; });
+	queuedBytes += contents.size();
+	queue.push_back({std::move(fileName), std::move(contents), executable});
+	queueChanged.notify_one();
+}
+
+void waitForWrites()
+{
+	std::unique_lock<std::mutex> lock(queueMutex);
+	if (writer.joinable())
+	{
+		stopping = true;
+		queueChanged.notify_one();
+		lock.unlock();
+		writer.join();
+	}
+}
+
+bool finishWrites()
+{
+	waitForWrites();
+	std::lock_guard<std::mutex> lock(queueMutex);
+	bool ok = !failed;
+	failed = false;
+	return ok;
+}
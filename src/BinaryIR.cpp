@@ -0,0 +1,747 @@
+/*
+ * BinaryIR.cpp
+ * Author: Joshua Cao
+ */
+
+#include "BinaryIR.h"
+#include "RegAllocStructs.h"
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+
+static void putVarint(std::string& out, uint64_t value)
+{
+	while (value >= 0x80)
+	{
+		out += char(value | 0x80);
+		value >>= 7;
+	}
+	out += char(value);
+}
+
+static void putSigned(std::string& out, int64_t value)
+{
+	putVarint(out, (uint64_t(value) << 1) ^ uint64_t(value >> 63));
+}
+
+// the strings, functions, blocks and instructions of a module by index
+class Encoder
+{
+private:
+	std::string body;
+	std::vector<std::string> strings;
+	std::unordered_map<std::string, uint64_t> stringIds;
+	std::unordered_map<SSA::Function*, uint64_t> funcIds;
+	std::unordered_map<SSA::BasicBlock*, uint64_t> blockIds;
+	// block and position of every instruction
+	std::unordered_map<SSA::Instruction*, std::pair<uint64_t, uint64_t>> positions;
+	// when encoding a single function, the instructions outside of it by their ids
+	const std::unordered_map<SSA::Instruction*, uint64_t>* foreign;
+	// false if a single function refers to an instruction that has no id
+	bool complete;
+
+	uint64_t string(const std::string& s);
+	void operand(SSA::Function* f, SSA::Operand* o);
+	void layout(std::string& out, SSA::Function* f);
+	void blocks(SSA::Function* f);
+	std::string finish(std::string header, const std::string& functions);
+public:
+	Encoder() : foreign(nullptr), complete(true) {}
+	std::string encode(SSA::Module* ir, bool allocated);
+	std::string encodeFunction(SSA::Function* f, const std::unordered_map<SSA::Instruction*, uint64_t>& foreignIds);
+};
+
+uint64_t Encoder::string(const std::string& s)
+{
+	auto id = stringIds.find(s);
+	if (id != stringIds.cend())
+	{
+		return id->second;
+	}
+	stringIds[s] = strings.size();
+	strings.push_back(s);
+	return strings.size() - 1;
+}
+
+void Encoder::operand(SSA::Function* f, SSA::Operand* o)
+{
+	if (!o)
+	{
+		putVarint(body, 0);
+		return;
+	}
+	putVarint(body, o->getType() + 1);
+	switch (o->getType())
+	{
+	case SSA::Operand::val:
+	{
+		SSA::Instruction* i = o->getInstruction();
+		if (foreign)
+		{
+			auto position = positions.find(i);
+			auto id = foreign->find(i);
+			if (position != positions.cend())
+			{
+				putVarint(body, position->second.first << 1);
+				putVarint(body, position->second.second);
+			}
+			else if (id != foreign->cend())
+			{
+				putVarint(body, id->second << 1 | 1);
+			}
+			else
+			{
+				complete = false;
+			}
+			break;
+		}
+		SSA::Function* owner = i->getParent()->getParent();
+		std::pair<uint64_t, uint64_t> position = positions[i];
+		putVarint(body, position.first << 1 | (owner != f));
+		if (owner != f)
+		{
+			putVarint(body, funcIds[owner]);
+		}
+		putVarint(body, position.second);
+		break;
+	}
+	case SSA::Operand::call:
+	{
+		SSA::Operand::FunctionCall* call = o->getFunctionCall();
+		putVarint(body, foreign ? string(call->function->getName()) : funcIds[call->function]);
+		putVarint(body, call->args.size());
+		for (SSA::Operand* arg : call->args)
+		{
+			operand(f, arg);
+		}
+		break;
+	}
+	case SSA::Operand::phi:
+	{
+		auto args = o->getPhiArgs();
+		putVarint(body, string(o->getVarName()));
+		putVarint(body, args.size());
+		for (auto arg : args)
+		{
+			putVarint(body, blockIds[arg.first]);
+			operand(f, arg.second);
+		}
+		break;
+	}
+	case SSA::Operand::constant:
+		putSigned(body, o->getConst());
+		break;
+	case SSA::Operand::globalReg:
+		break;
+	}
+}
+
+void Encoder::layout(std::string& out, SSA::Function* f)
+{
+	std::list<SSA::BasicBlock*> BBs = f->getBBs();
+	putVarint(out, string(f->getName()));
+	putVarint(out, f->isVoid());
+	putSigned(out, f->getLocalVariableOffset());
+	putSigned(out, f->getFrameSize());
+	putVarint(out, BBs.size());
+	uint64_t blockId = 0;
+	for (SSA::BasicBlock* b : BBs)
+	{
+		blockIds[b] = blockId;
+		uint64_t position = 0;
+		for (SSA::Instruction* i : b->getInstructions())
+		{
+			positions[i] = {blockId, position++};
+		}
+		putVarint(out, position);
+		putVarint(out, b->isLoopHeader());
+		putSigned(out, b->getCount());
+		++blockId;
+	}
+}
+
+void Encoder::blocks(SSA::Function* f)
+{
+	for (SSA::BasicBlock* b : f->getBBs())
+	{
+		std::list<SSA::BasicBlock*> preds = b->getPredecessors();
+		putVarint(body, preds.size());
+		for (SSA::BasicBlock* pred : preds)
+		{
+			putVarint(body, blockIds[pred]);
+		}
+		std::list<SSA::BasicBlock*> succs = b->getSuccessors();
+		putVarint(body, succs.size());
+		for (SSA::BasicBlock* succ : succs)
+		{
+			putVarint(body, blockIds[succ]);
+			putSigned(body, b->getEdgeCount(succ));
+		}
+		for (SSA::Instruction* i : b->getInstructions())
+		{
+			putVarint(body, i->getOpcode());
+			putVarint(body, i->getId());
+			putSigned(body, i->getReg());
+			operand(f, i->getOperand1());
+			operand(f, i->getOperand2());
+		}
+	}
+}
+
+// the strings go between the header and the functions, since both add to them
+std::string Encoder::finish(std::string header, const std::string& functions)
+{
+	putVarint(header, strings.size());
+	for (const std::string& s : strings)
+	{
+		putVarint(header, s.size());
+		header += s;
+	}
+	return header + functions + body;
+}
+
+std::string Encoder::encode(SSA::Module* ir, bool allocated)
+{
+	std::string functions;
+	putVarint(functions, ir->getFuncs().size());
+	for (SSA::Function* f : ir->getFuncs())
+	{
+		uint64_t funcId = funcIds.size();
+		funcIds[f] = funcId;
+		layout(functions, f);
+	}
+	for (SSA::Function* f : ir->getFuncs())
+	{
+		blocks(f);
+	}
+
+	std::string header = BinaryIR::MAGIC;
+	putVarint(header, BinaryIR::VERSION);
+	putVarint(header, allocated);
+	return finish(header, functions);
+}
+
+std::string Encoder::encodeFunction(SSA::Function* f, const std::unordered_map<SSA::Instruction*, uint64_t>& foreignIds)
+{
+	foreign = &foreignIds;
+	std::string function;
+	layout(function, f);
+	blocks(f);
+	if (!complete)
+	{
+		return "";
+	}
+	std::string header = BinaryIR::FUNCTION_MAGIC;
+	putVarint(header, BinaryIR::VERSION);
+	return finish(header, function);
+}
+
+std::string BinaryIR::serialize(SSA::Module* ir, bool allocated)
+{
+	Encoder encoder;
+	return encoder.encode(ir, allocated);
+}
+
+std::string BinaryIR::serializeFunction(SSA::Function* f, const std::unordered_map<SSA::Instruction*, uint64_t>& foreign)
+{
+	Encoder encoder;
+	return encoder.encodeFunction(f, foreign);
+}
+
+/*
+ * reads a module, checking every index against what was read so far. after
+ * the first error every read returns 0 and the module is discarded
+ */
+class Decoder
+{
+private:
+	const uint8_t* p;
+	const uint8_t* end;
+	bool valid;
+	SSA::Module* ir;
+	std::vector<std::string> strings;
+	std::vector<SSA::Function*> funcs;
+	std::vector<std::vector<SSA::BasicBlock*>> blocks;
+	// the instructions of every block of every function, created before the bodies are read
+	std::vector<std::vector<std::vector<SSA::Instruction*>>> instructions;
+	// when decoding a single function, the instructions outside of it by their ids
+	const std::vector<SSA::Instruction*>* foreign;
+
+	uint64_t varint();
+	int64_t signedVarint();
+	// reads an index below size
+	uint64_t index(std::size_t size);
+	bool header(const char* magic);
+	void readStrings();
+	void layout(SSA::Function* func);
+	SSA::Operand* operand(uint64_t f);
+	bool block(uint64_t f, uint64_t b);
+	bool isWellFormed(uint64_t f) const;
+public:
+	Decoder(const char* data, std::size_t size);
+	SSA::Module* decode(bool& allocated);
+	bool decodeFunction(SSA::Function* target, const std::vector<SSA::Instruction*>& foreignIns);
+};
+
+Decoder::Decoder(const char* data, std::size_t size)
+	: p(reinterpret_cast<const uint8_t*>(data)), end(p + size), valid(true), ir(nullptr), foreign(nullptr)
+{
+}
+
+uint64_t Decoder::varint()
+{
+	uint64_t value = 0;
+	for (int shift = 0; valid && shift < 64; shift += 7)
+	{
+		if (p == end)
+		{
+			break;
+		}
+		uint8_t byte = *p++;
+		value |= uint64_t(byte & 0x7F) << shift;
+		if (!(byte & 0x80))
+		{
+			return value;
+		}
+	}
+	valid = false;
+	return 0;
+}
+
+int64_t Decoder::signedVarint()
+{
+	uint64_t value = varint();
+	return int64_t(value >> 1) ^ -int64_t(value & 1);
+}
+
+uint64_t Decoder::index(std::size_t size)
+{
+	uint64_t i = varint();
+	if (i >= size)
+	{
+		valid = false;
+		return 0;
+	}
+	return i;
+}
+
+SSA::Operand* Decoder::operand(uint64_t f)
+{
+	uint64_t kind = varint();
+	if (!valid || kind == 0)
+	{
+		return nullptr;
+	}
+	SSA::Operand* o = nullptr;
+	switch (kind - 1)
+	{
+	case SSA::Operand::val:
+	{
+		uint64_t reference = varint();
+		if (foreign && reference & 1)
+		{
+			uint64_t id = reference >> 1;
+			if (!valid || id >= foreign->size())
+			{
+				valid = false;
+				return nullptr;
+			}
+			o = new SSA::ValOperand((*foreign)[id]);
+			break;
+		}
+		uint64_t owner = reference & 1 ? index(funcs.size()) : f;
+		uint64_t block = reference >> 1;
+		if (!valid || block >= blocks[owner].size())
+		{
+			valid = false;
+			return nullptr;
+		}
+		uint64_t position = index(instructions[owner][block].size());
+		if (!valid)
+		{
+			return nullptr;
+		}
+		o = new SSA::ValOperand(instructions[owner][block][position]);
+		break;
+	}
+	case SSA::Operand::call:
+	{
+		SSA::Function* callee = nullptr;
+		if (foreign)
+		{
+			uint64_t name = index(strings.size());
+			callee = valid ? ir->getFunction(strings[name]) : nullptr;
+			valid = valid && callee;
+		}
+		else
+		{
+			uint64_t id = index(funcs.size());
+			callee = valid ? funcs[id] : nullptr;
+		}
+		uint64_t numArgs = varint();
+		std::list<SSA::Operand*> args;
+		for (uint64_t i = 0; valid && i < numArgs; ++i)
+		{
+			args.push_back(operand(f));
+		}
+		if (!valid)
+		{
+			return nullptr;
+		}
+		o = new SSA::CallOperand(callee, args);
+		break;
+	}
+	case SSA::Operand::phi:
+	{
+		uint64_t name = index(strings.size());
+		if (!valid)
+		{
+			return nullptr;
+		}
+		SSA::PhiOperand* phi = new SSA::PhiOperand(strings[name]);
+		ir->addOperand(phi);
+		uint64_t numArgs = varint();
+		for (uint64_t i = 0; valid && i < numArgs; ++i)
+		{
+			uint64_t b = index(blocks[f].size());
+			SSA::Operand* arg = operand(f);
+			if (valid)
+			{
+				phi->addPhiArg(blocks[f][b], arg);
+			}
+		}
+		return valid ? phi : nullptr;
+	}
+	case SSA::Operand::constant:
+		o = new SSA::ConstOperand(signedVarint());
+		break;
+	case SSA::Operand::globalReg:
+		o = new SSA::GlobalRegOperand();
+		break;
+	default:
+		valid = false;
+		return nullptr;
+	}
+	// owned by the module like every other operand
+	ir->addOperand(o);
+	return o;
+}
+
+// @return false if the block is invalid
+bool Decoder::block(uint64_t f, uint64_t b)
+{
+	SSA::BasicBlock* block = blocks[f][b];
+	uint64_t numPreds = varint();
+	for (uint64_t i = 0; valid && i < numPreds; ++i)
+	{
+		uint64_t pred = index(blocks[f].size());
+		if (valid)
+		{
+			block->addPredecessor(blocks[f][pred]);
+		}
+	}
+	uint64_t numSuccs = varint();
+	for (uint64_t i = 0; valid && i < numSuccs; ++i)
+	{
+		uint64_t succ = index(blocks[f].size());
+		long count = signedVarint();
+		if (valid)
+		{
+			block->addSuccessor(blocks[f][succ]);
+			if (count >= 0)
+			{
+				block->setEdgeCount(blocks[f][succ], count);
+			}
+		}
+	}
+	for (SSA::Instruction* i : instructions[f][b])
+	{
+		uint64_t opcode = varint();
+		if (opcode > SSA::constant)
+		{
+			valid = false;
+		}
+		i->setOpcode(SSA::Opcode(opcode));
+		i->setId(varint());
+		i->setReg(signedVarint());
+		i->setOperand1(operand(f));
+		i->setOperand2(operand(f));
+		if (!valid)
+		{
+			break;
+		}
+	}
+	return valid;
+}
+
+// whether o can be read as a value
+static bool isValue(SSA::Operand* o)
+{
+	return o && (o->getType() == SSA::Operand::val || o->getType() == SSA::Operand::constant
+			|| o->getType() == SSA::Operand::globalReg);
+}
+
+static bool areValues(const std::list<SSA::Operand*>& operands)
+{
+	for (SSA::Operand* o : operands)
+	{
+		if (!isValue(o))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// whether i has the operands its opcode reads, of the kinds it reads them as
+static bool isWellFormed(SSA::Instruction* i)
+{
+	SSA::Operand* x = i->getOperand1();
+	SSA::Operand* y = i->getOperand2();
+	switch (i->getOpcode())
+	{
+	case SSA::add:
+	case SSA::sub:
+	case SSA::mul:
+	case SSA::div:
+	case SSA::cmp:
+	case SSA::adda:
+	case SSA::store:
+		return isValue(x) && isValue(y);
+	case SSA::load:
+	case SSA::move:
+	case SSA::write:
+	case SSA::bne:
+	case SSA::beq:
+	case SSA::ble:
+	case SSA::blt:
+	case SSA::bge:
+	case SSA::bgt:
+		return isValue(x) && !y;
+	case SSA::constant:
+		return x && x->getType() == SSA::Operand::constant && !y;
+	case SSA::phi:
+		// allocation may leave a phi without args
+		return (!x || (x->getType() == SSA::Operand::phi && areValues(x->getArgs()))) && !y;
+	case SSA::call:
+		return x && x->getType() == SSA::Operand::call && areValues(x->getArgs()) && !y;
+	case SSA::ret:
+		return (!x || isValue(x)) && !y;
+	case SSA::bra:
+	case SSA::end:
+	case SSA::read:
+	case SSA::writeNL:
+	case SSA::pop:
+		return !x && !y;
+	}
+	return false;
+}
+
+/*
+ * indices were checked while reading. this checks what the backends rely on
+ * beyond them: a body for exactly the functions that are not builtins, the
+ * frame, registers below NUM_REG and operands that fit their instruction
+ */
+bool Decoder::isWellFormed(uint64_t f) const
+{
+	if (funcs[f]->isBuiltin() != blocks[f].empty() || funcs[f]->getFrameSize() < 0 || funcs[f]->getFrameSize() % 4 != 0
+			|| funcs[f]->getLocalVariableOffset() > 0 || funcs[f]->getLocalVariableOffset() % 4 != 0)
+	{
+		return false;
+	}
+	for (const std::vector<SSA::Instruction*>& block : instructions[f])
+	{
+		for (SSA::Instruction* i : block)
+		{
+			if (i->getReg() < -1 || i->getReg() >= NUM_REG || !::isWellFormed(i))
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+bool Decoder::header(const char* magic)
+{
+	std::size_t magicLength = strlen(magic);
+	if (std::size_t(end - p) < magicLength || memcmp(p, magic, magicLength) != 0)
+	{
+		return false;
+	}
+	p += magicLength;
+	return varint() == BinaryIR::VERSION;
+}
+
+void Decoder::readStrings()
+{
+	uint64_t numStrings = varint();
+	for (uint64_t i = 0; valid && i < numStrings; ++i)
+	{
+		uint64_t length = varint();
+		if (length > std::size_t(end - p))
+		{
+			valid = false;
+			break;
+		}
+		strings.push_back(std::string(reinterpret_cast<const char*>(p), length));
+		p += length;
+	}
+}
+
+// the frame of a function and its blocks, with their instructions to be filled in by the bodies
+void Decoder::layout(SSA::Function* func)
+{
+	func->setLocalVariableOffset(signedVarint());
+	func->setFrameSize(signedVarint());
+	funcs.push_back(func);
+	blocks.push_back({});
+	instructions.push_back({});
+	uint64_t numBlocks = varint();
+	for (uint64_t b = 0; valid && b < numBlocks; ++b)
+	{
+		uint64_t numInstructions = varint();
+		bool loopHeader = varint();
+		long count = signedVarint();
+		// every instruction takes at least 5 bytes, so this bounds allocations by the input size
+		if (!valid || numInstructions > std::size_t(end - p))
+		{
+			valid = false;
+			break;
+		}
+		SSA::BasicBlock* block = new SSA::BasicBlock(loopHeader);
+		block->setCount(count);
+		func->emit(block);
+		blocks.back().push_back(block);
+		instructions.back().push_back({});
+		for (uint64_t i = 0; i < numInstructions; ++i)
+		{
+			SSA::Instruction* ins = new SSA::Instruction(SSA::end);
+			block->emit(ins);
+			instructions.back().back().push_back(ins);
+		}
+	}
+}
+
+SSA::Module* Decoder::decode(bool& allocated)
+{
+	if (!header(BinaryIR::MAGIC))
+	{
+		return nullptr;
+	}
+	allocated = varint();
+	readStrings();
+
+	ir = new SSA::Module();
+	uint64_t numFuncs = varint();
+	for (uint64_t f = 0; valid && f < numFuncs; ++f)
+	{
+		uint64_t name = index(strings.size());
+		bool isVoid = varint();
+		if (!valid)
+		{
+			break;
+		}
+		SSA::Function* func = ir->getFunction(strings[name]);
+		// the builtins are created with the module, every other function once
+		if (func && !func->isBuiltin())
+		{
+			valid = false;
+			break;
+		}
+		if (!func)
+		{
+			func = new SSA::Function(ir, strings[name], isVoid);
+			ir->emit(func);
+		}
+		layout(func);
+	}
+
+	for (uint64_t f = 0; valid && f < funcs.size(); ++f)
+	{
+		for (uint64_t b = 0; valid && b < blocks[f].size(); ++b)
+		{
+			block(f, b);
+		}
+		valid = valid && isWellFormed(f);
+	}
+	if (!valid || p != end)
+	{
+		delete ir;
+		return nullptr;
+	}
+	return ir;
+}
+
+/*
+ * decodes into a function outside of the module, so target is only changed
+ * once the whole function was read
+ */
+bool Decoder::decodeFunction(SSA::Function* target, const std::vector<SSA::Instruction*>& foreignIns)
+{
+	if (!header(BinaryIR::FUNCTION_MAGIC))
+	{
+		return false;
+	}
+	foreign = &foreignIns;
+	ir = target->getParent();
+	readStrings();
+	uint64_t name = index(strings.size());
+	bool isVoid = varint();
+	if (!valid || strings[name] != target->getName())
+	{
+		return false;
+	}
+	SSA::Function* func = new SSA::Function(ir, strings[name], isVoid);
+	layout(func);
+	for (uint64_t b = 0; valid && b < blocks[0].size(); ++b)
+	{
+		block(0, b);
+	}
+	valid = valid && isWellFormed(0);
+	if (valid && p == end)
+	{
+		target->takeBody(func);
+	}
+	delete func;
+	return valid && p == end;
+}
+
+SSA::Module* BinaryIR::deserialize(const char* data, std::size_t size, bool& allocated)
+{
+	Decoder decoder(data, size);
+	return decoder.decode(allocated);
+}
+
+bool BinaryIR::deserializeFunction(const char* data, std::size_t size, SSA::Function* f,
+		const std::vector<SSA::Instruction*>& foreign)
+{
+	Decoder decoder(data, size);
+	return decoder.decodeFunction(f, foreign);
+}
+
+SSA::Module* BinaryIR::load(std::string fileName, bool& allocated)
+{
+	int fd = open(fileName.c_str(), O_RDONLY);
+	if (fd < 0)
+	{
+		return nullptr;
+	}
+	struct stat s;
+	SSA::Module* ir = nullptr;
+	if (fstat(fd, &s) == 0 && s.st_size > 0)
+	{
+		void* data = mmap(nullptr, s.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (data != MAP_FAILED)
+		{
+			ir = deserialize(static_cast<const char*>(data), s.st_size, allocated);
+			munmap(data, s.st_size);
+		}
+	}
+	close(fd);
+	return ir;
+}
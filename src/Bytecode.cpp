@@ -0,0 +1,466 @@
+/*
+ * Bytecode.cpp
+ * Author: Joshua Cao
+ */
+
+#include "Bytecode.h"
+#include "RegAlloc.h"
+#include "SSAutils.h"
+#include <iostream>
+
+Bytecode::Bytecode(SSA::Module* ir) : globalSize(0), f(nullptr), info(nullptr)
+{
+	// number functions first so calls can refer to functions lowered later
+	for (SSA::Function* func : ir->getFuncs())
+	{
+		globalSize = std::max(globalSize, -func->getLocalVariableOffset());
+		if (!func->isBuiltin())
+		{
+			functionIds[func] = functions.size();
+			functions.push_back(FunctionInfo());
+		}
+	}
+
+	// values of one function read by another are exported when defined
+	for (SSA::Function* func : ir->getFuncs())
+	{
+		for (SSA::BasicBlock* b : func->getBBs())
+		{
+			for (SSA::Instruction* i : b->getInstructions())
+			{
+				for (SSA::Instruction* value : SSA::getValues(i))
+				{
+					if (value->getParent()->getParent() != func && value->getOpcode() != SSA::constant
+							&& exports.find(value) == exports.cend())
+					{
+						int id = exports.size();
+						exports[value] = id;
+					}
+				}
+			}
+		}
+	}
+
+	for (SSA::Function* func : ir->getFuncs())
+	{
+		if (!func->isBuiltin())
+		{
+			lower(func);
+		}
+	}
+}
+
+void Bytecode::lower(SSA::Function* func)
+{
+	f = func;
+	info = &functions[functionIds[f]];
+	info->name = f->getName();
+	info->entry = code.size();
+	info->frameSize = f->getFrameSize() / 4;
+	constantCells.clear();
+	importCells.clear();
+	numUses.clear();
+
+	std::list<SSA::BasicBlock*> BBs = f->getBBs();
+	int numCells = BRANCH_SCRATCH + 1;
+	for (SSA::BasicBlock* b : BBs)
+	{
+		for (SSA::Instruction* i : b->getInstructions())
+		{
+			for (SSA::Instruction* value : SSA::getValues(i))
+			{
+				numUses[value] += 1;
+				if (exports.find(value) != exports.cend() && value->getParent()->getParent() != f
+						&& importCells.find(value) == importCells.cend())
+				{
+					importCells[value] = numCells;
+					info->imports.push_back(std::make_pair(numCells, exports[value]));
+					++numCells;
+				}
+			}
+		}
+	}
+	info->constantBase = numCells;
+
+	// branch targets are patched once every block has an offset
+	std::unordered_map<SSA::BasicBlock*, int> offsets;
+	std::list<std::pair<int, SSA::BasicBlock*>> targets;
+	for (auto bIter = BBs.begin(); bIter != BBs.end(); ++bIter)
+	{
+		SSA::BasicBlock* b = *bIter;
+		SSA::BasicBlock* next = std::next(bIter) == BBs.end() ? nullptr : *std::next(bIter);
+		offsets[b] = code.size();
+
+		std::list<SSA::Instruction*>& instructions = b->getInstructions();
+		std::vector<std::pair<int, int>> moves;
+		SSA::Instruction* branch = nullptr;
+		int condition = 0;
+		SSA::Instruction* prev = nullptr;
+		for (auto iter = instructions.begin(); iter != instructions.end(); ++iter)
+		{
+			SSA::Instruction* i = *iter;
+			SSA::Instruction* nextIns = std::next(iter) == instructions.end() ? nullptr : *std::next(iter);
+			if (i->getOpcode() == SSA::move)
+			{
+				moves.push_back(std::make_pair(dest(i), cell(i->getOperand1())));
+			}
+			else if (SSA::isBranch(i->getOpcode()))
+			{
+				// later moves could overwrite the condition
+				branch = i;
+				if (i->getOperand1())
+				{
+					condition = cell(i->getOperand1());
+					if (nextIns)
+					{
+						emit(MOV, BRANCH_SCRATCH, condition);
+						condition = BRANCH_SCRATCH;
+					}
+				}
+			}
+			else if (i->getOpcode() != SSA::phi)
+			{
+				lowerMoves(moves);
+				moves.clear();
+				lower(i, prev, nextIns);
+			}
+			prev = i;
+		}
+		lowerMoves(moves);
+
+		// the branch target is the second successor, otherwise fall through
+		// to the first
+		std::list<SSA::BasicBlock*> succs = b->getSuccessors();
+		if (succs.empty())
+		{
+			if (!prev || (prev->getOpcode() != SSA::ret && prev->getOpcode() != SSA::end))
+			{
+				emit(f->getName() == "main" ? END : RET, NO_CELL);
+			}
+			continue;
+		}
+		SSA::BasicBlock* fallThrough = succs.front();
+		if (branch && branch->getOpcode() == SSA::bra)
+		{
+			fallThrough = succs.back();
+		}
+		else if (branch && succs.size() > 1)
+		{
+			Op op;
+			switch (branch->getOpcode())
+			{
+			case SSA::bne: op = BNE; break;
+			case SSA::beq: op = BEQ; break;
+			case SSA::ble: op = BLE; break;
+			case SSA::blt: op = BLT; break;
+			case SSA::bge: op = BGE; break;
+			default: op = BGT; break;
+			}
+			targets.push_back(std::make_pair(code.size(), *std::next(succs.begin())));
+			emit(op, condition);
+		}
+		if (fallThrough != next)
+		{
+			targets.push_back(std::make_pair(code.size(), fallThrough));
+			emit(JMP, 0);
+		}
+	}
+	for (auto target : targets)
+	{
+		code[target.first].a = offsets[target.second];
+	}
+	info->numCells = info->constantBase + info->constants.size();
+}
+
+void Bytecode::lower(SSA::Instruction* i, SSA::Instruction* prev, SSA::Instruction* next)
+{
+	SSA::Operand* x = i->getOperand1();
+	SSA::Operand* y = i->getOperand2();
+	switch (i->getOpcode())
+	{
+	case SSA::add:
+		emit(ADD, dest(i), cell(x), cell(y));
+		break;
+	case SSA::sub:
+		emit(SUB, dest(i), cell(x), cell(y));
+		break;
+	case SSA::mul:
+		emit(MUL, dest(i), cell(x), cell(y));
+		break;
+	case SSA::div:
+		emit(DIV, dest(i), cell(x), cell(y));
+		break;
+	case SSA::cmp:
+		emit(CMP, dest(i), cell(x), cell(y));
+		break;
+	case SSA::adda:
+		if (!isFused(i, next))
+		{
+			emit(ADD, dest(i), cell(x), cell(y));
+		}
+		break;
+	case SSA::constant:
+		emit(MOV, dest(i), constantCell(x->getConst()));
+		break;
+	case SSA::load:
+	case SSA::store:
+		lowerMemoryAccess(i, prev);
+		break;
+	case SSA::read:
+		emit(IN, dest(i));
+		break;
+	case SSA::write:
+		emit(OUT, cell(x));
+		break;
+	case SSA::writeNL:
+		emit(NL, NO_CELL);
+		break;
+	case SSA::call:
+	{
+		SSA::Operand::FunctionCall* call = x->getFunctionCall();
+		std::string name = call->function->getName();
+		if (name == "InputNum")
+		{
+			emit(IN, dest(i));
+		}
+		else if (name == "OutputNum")
+		{
+			emit(OUT, call->args.empty() ? constantCell(0) : cell(call->args.front()));
+		}
+		else if (name == "OutputNewLine")
+		{
+			emit(NL, NO_CELL);
+		}
+		else
+		{
+			for (SSA::Operand* arg : call->args)
+			{
+				emit(ARG, cell(arg));
+			}
+			emit(CALL, i->hasOutput() ? dest(i) : NO_CELL, functionIds[call->function],
+					call->args.size());
+		}
+		break;
+	}
+	case SSA::pop:
+		emit(POP, dest(i));
+		break;
+	case SSA::ret:
+		emit(f->getName() == "main" ? END : RET, x ? cell(x) : NO_CELL);
+		break;
+	case SSA::end:
+		emit(END, NO_CELL);
+		break;
+	}
+
+	if (exports.find(i) != exports.cend())
+	{
+		emit(EXP, dest(i), exports[i]);
+	}
+}
+
+// moves are a parallel copy, see insertMoveBeforePhi
+void Bytecode::lowerMoves(std::vector<std::pair<int, int>> moves)
+{
+	std::list<std::pair<int, int>> parallel(moves.begin(), moves.end());
+	for (auto move : sequentializeMoves(parallel, SCRATCH))
+	{
+		emit(MOV, move.first, move.second);
+	}
+}
+
+/*
+ * an adda only used by the load or store right after it is folded into the
+ * access, which then addresses a frame slot, a global word or the global
+ * register plus a cell
+ */
+bool Bytecode::isFused(SSA::Instruction* adda, SSA::Instruction* memAccess)
+{
+	if (!memAccess || (memAccess->getOpcode() != SSA::load && memAccess->getOpcode() != SSA::store)
+			|| numUses[adda] != 1 || exports.find(adda) != exports.cend())
+	{
+		return false;
+	}
+	SSA::Operand* address = memAccess->getOperand1();
+	if (!address || address->getType() != SSA::Operand::val || address->getInstruction() != adda)
+	{
+		return false;
+	}
+	return adda->getOperand1()->getType() == SSA::Operand::globalReg
+			|| adda->getOperand2()->getType() == SSA::Operand::globalReg;
+}
+
+void Bytecode::lowerMemoryAccess(SSA::Instruction* i, SSA::Instruction* prev)
+{
+	bool isLoad = i->getOpcode() == SSA::load;
+	int value = isLoad ? dest(i) : cell(i->getOperand2());
+	if (prev && prev->getOpcode() == SSA::adda && isFused(prev, i))
+	{
+		SSA::Operand* offset = prev->getOperand1();
+		if (offset->getType() == SSA::Operand::globalReg)
+		{
+			offset = prev->getOperand2();
+		}
+		if (offset->getType() == SSA::Operand::constant && offset->getConst() >= 0)
+		{
+			emit(isLoad ? LDS : STS, value, offset->getConst() / 4);
+		}
+		else if (offset->getType() == SSA::Operand::constant)
+		{
+			emit(isLoad ? LDG : STG, value, (globalSize + offset->getConst()) / 4);
+		}
+		else
+		{
+			emit(isLoad ? LDX : STX, value, cell(offset));
+		}
+		return;
+	}
+	emit(isLoad ? LD : ST, value, cell(i->getOperand1()));
+}
+
+void Bytecode::emit(Op op, int d, int a, int b)
+{
+	Instr instr;
+	instr.op = op;
+	instr.d = d;
+	instr.a = a;
+	instr.b = b;
+	code.push_back(instr);
+}
+
+int Bytecode::constantCell(int c)
+{
+	if (constantCells.find(c) == constantCells.cend())
+	{
+		constantCells[c] = info->constantBase + info->constants.size();
+		info->constants.push_back(c);
+	}
+	return constantCells[c];
+}
+
+int Bytecode::cell(SSA::Operand* o)
+{
+	switch (o->getType())
+	{
+	case SSA::Operand::constant:
+		return constantCell(o->getConst());
+	case SSA::Operand::globalReg:
+		return constantCell(globalSize);
+	case SSA::Operand::val:
+	{
+		SSA::Instruction* i = o->getInstruction();
+		if (i->getOpcode() == SSA::constant && (i->getParent()->getParent() != f || i->getReg() < 0))
+		{
+			return constantCell(i->getOperand1()->getConst());
+		}
+		if (importCells.find(i) != importCells.cend())
+		{
+			return importCells[i];
+		}
+		if (i->getReg() < 0)
+		{
+			std::cerr << "no register for {" << i->toStr() << "}" << std::endl;
+			exit(1);
+		}
+		return i->getReg();
+	}
+	}
+	std::cerr << "cannot lower operand " << o->toStr() << std::endl;
+	exit(1);
+}
+
+// dead values may not have a register
+int Bytecode::dest(SSA::Instruction* i)
+{
+	return i->getReg() < 0 ? SCRATCH : i->getReg();
+}
+
+const std::vector<Bytecode::Instr>& Bytecode::getCode() const
+{
+	return code;
+}
+
+const std::vector<Bytecode::FunctionInfo>& Bytecode::getFunctions() const
+{
+	return functions;
+}
+
+int Bytecode::getMainId() const
+{
+	for (int i = 0; i < functions.size(); ++i)
+	{
+		if (functions[i].name == "main")
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+int Bytecode::getGlobalSize() const
+{
+	return globalSize;
+}
+
+int Bytecode::getNumExports() const
+{
+	return exports.size();
+}
+
+std::string Bytecode::opToStr(Op op)
+{
+	switch (op)
+	{
+	case ADD:	return "add";
+	case SUB:	return "sub";
+	case MUL:	return "mul";
+	case DIV:	return "div";
+	case CMP:	return "cmp";
+	case MOV:	return "mov";
+	case LD:	return "ld";
+	case ST:	return "st";
+	case LDS:	return "lds";
+	case STS:	return "sts";
+	case LDG:	return "ldg";
+	case STG:	return "stg";
+	case LDX:	return "ldx";
+	case STX:	return "stx";
+	case JMP:	return "jmp";
+	case BNE:	return "bne";
+	case BEQ:	return "beq";
+	case BLE:	return "ble";
+	case BLT:	return "blt";
+	case BGE:	return "bge";
+	case BGT:	return "bgt";
+	case ARG:	return "arg";
+	case CALL:	return "call";
+	case POP:	return "pop";
+	case RET:	return "ret";
+	case EXP:	return "exp";
+	case IN:	return "in";
+	case OUT:	return "out";
+	case NL:	return "nl";
+	case END:	return "end";
+	}
+	return "";
+}
+
+std::string Bytecode::toStr() const
+{
+	std::string s = "";
+	for (int id = 0; id < functions.size(); ++id)
+	{
+		const FunctionInfo& func = functions[id];
+		int end = id + 1 < functions.size() ? functions[id + 1].entry : code.size();
+		s += func.name + ": cells " + std::to_string(func.numCells) + ", frame "
+				+ std::to_string(func.frameSize) + '\n';
+		for (int pc = func.entry; pc < end; ++pc)
+		{
+			const Instr& instr = code[pc];
+			s += '\t' + std::to_string(pc) + ": " + opToStr(instr.op) + ' '
+					+ (instr.d == NO_CELL ? "-" : std::to_string(instr.d)) + ' '
+					+ std::to_string(instr.a) + ' ' + std::to_string(instr.b) + '\n';
+		}
+	}
+	return s;
+}
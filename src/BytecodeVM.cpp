@@ -0,0 +1,273 @@
+/*
+ * BytecodeVM.cpp
+ * Author: Joshua Cao
+ */
+
+#include "BytecodeVM.h"
+#include <iostream>
+
+BytecodeVM::BytecodeVM(const Bytecode& bytecode, FILE* in, FILE* out)
+	: bytecode(bytecode), in(in), out(out), instructionCount(0)
+{
+}
+
+/*
+ * pushes a frame for functionId with numArgs values on top of args. cells
+ * start with the constant pool and imported values filled in
+ */
+void BytecodeVM::enter(int functionId, int returnPc, int dest, int numArgs)
+{
+	const Bytecode::FunctionInfo& info = bytecode.getFunctions()[functionId];
+	Frame frame;
+	frame.returnPc = returnPc;
+	frame.cellBase = cellStack.size();
+	frame.memBase = memory.size();
+	frame.frameSize = info.frameSize;
+	frame.dest = dest;
+	frame.argBase = args.size() - numArgs;
+	frame.numArgs = numArgs;
+	frame.popIndex = 0;
+	frames.push_back(frame);
+
+	cellStack.resize(frame.cellBase + info.numCells, 0);
+	std::copy(info.constants.begin(), info.constants.end(),
+			cellStack.begin() + frame.cellBase + info.constantBase);
+	for (auto import : info.imports)
+	{
+		cellStack[frame.cellBase + import.first] = exports[import.second];
+	}
+	memory.resize(frame.memBase + frame.frameSize);
+	std::fill(memory.begin() + frame.memBase, memory.end(), 0);
+}
+
+int& BytecodeVM::address(int addr)
+{
+	int globalSize = bytecode.getGlobalSize();
+	if (addr % 4 != 0 || addr < 0)
+	{
+		std::cerr << "invalid memory address " << addr << std::endl;
+		exit(1);
+	}
+	if (addr < globalSize)
+	{
+		return memory[addr / 4];
+	}
+	int slot = (addr - globalSize) / 4;
+	if (slot >= frames.back().frameSize)
+	{
+		std::cerr << "memory access out of bounds at " << addr << std::endl;
+		exit(1);
+	}
+	return memory[frames.back().memBase + slot];
+}
+
+void BytecodeVM::error(int pc, std::string msg) const
+{
+	std::cerr << msg << " at bytecode " << pc << std::endl;
+	exit(1);
+}
+
+void BytecodeVM::run()
+{
+	static const void* handlers[Bytecode::NUM_OPS] = {
+		&&op_ADD, &&op_SUB, &&op_MUL, &&op_DIV, &&op_CMP, &&op_MOV,
+		&&op_LD, &&op_ST, &&op_LDS, &&op_STS, &&op_LDG, &&op_STG, &&op_LDX, &&op_STX,
+		&&op_JMP, &&op_BNE, &&op_BEQ, &&op_BLE, &&op_BLT, &&op_BGE, &&op_BGT,
+		&&op_ARG, &&op_CALL, &&op_POP, &&op_RET, &&op_EXP,
+		&&op_IN, &&op_OUT, &&op_NL, &&op_END
+	};
+
+	int mainId = bytecode.getMainId();
+	if (mainId < 0)
+	{
+		std::cerr << "no main function" << std::endl;
+		exit(1);
+	}
+
+	const std::vector<Bytecode::Instr>& code = bytecode.getCode();
+	threaded.clear();
+	for (const Bytecode::Instr& instr : code)
+	{
+		threaded.push_back({handlers[instr.op], instr.d, instr.a, instr.b});
+	}
+	cellStack.clear();
+	memory.assign(bytecode.getGlobalSize() / 4, 0);
+	args.clear();
+	exports.assign(bytecode.getNumExports(), 0);
+	frames.clear();
+	instructionCount = 0;
+
+	enter(mainId, -1, Bytecode::NO_CELL, 0);
+	const Threaded* base = threaded.data();
+	const Threaded* ip = base + bytecode.getFunctions()[mainId].entry;
+	int* cells = cellStack.data();
+	int* mem = memory.data();
+	unsigned long count = 0;
+
+// the stacks may move when a frame is pushed
+#define RELOAD() (cells = cellStack.data() + frames.back().cellBase, mem = memory.data())
+#define NEXT() do { ++count; goto *ip->handler; } while (0)
+#define D cells[ip->d]
+#define A cells[ip->a]
+#define B cells[ip->b]
+
+	NEXT();
+
+op_ADD:
+	D = A + B;
+	++ip;
+	NEXT();
+op_SUB:
+	D = A - B;
+	++ip;
+	NEXT();
+op_MUL:
+	D = A * B;
+	++ip;
+	NEXT();
+op_DIV:
+	if (B == 0)
+	{
+		error(ip - base, "division by zero");
+	}
+	D = A / B;
+	++ip;
+	NEXT();
+op_CMP:
+	D = (A > B) - (A < B);
+	++ip;
+	NEXT();
+op_MOV:
+	D = A;
+	++ip;
+	NEXT();
+op_LD:
+	D = address(A);
+	++ip;
+	NEXT();
+op_ST:
+	address(A) = D;
+	++ip;
+	NEXT();
+op_LDS:
+	D = mem[frames.back().memBase + ip->a];
+	++ip;
+	NEXT();
+op_STS:
+	mem[frames.back().memBase + ip->a] = D;
+	++ip;
+	NEXT();
+op_LDG:
+	D = mem[ip->a];
+	++ip;
+	NEXT();
+op_STG:
+	mem[ip->a] = D;
+	++ip;
+	NEXT();
+op_LDX:
+	D = address(bytecode.getGlobalSize() + A);
+	++ip;
+	NEXT();
+op_STX:
+	address(bytecode.getGlobalSize() + A) = D;
+	++ip;
+	NEXT();
+op_JMP:
+	ip = base + ip->a;
+	NEXT();
+op_BNE:
+	ip = D != 0 ? base + ip->a : ip + 1;
+	NEXT();
+op_BEQ:
+	ip = D == 0 ? base + ip->a : ip + 1;
+	NEXT();
+op_BLE:
+	ip = D <= 0 ? base + ip->a : ip + 1;
+	NEXT();
+op_BLT:
+	ip = D < 0 ? base + ip->a : ip + 1;
+	NEXT();
+op_BGE:
+	ip = D >= 0 ? base + ip->a : ip + 1;
+	NEXT();
+op_BGT:
+	ip = D > 0 ? base + ip->a : ip + 1;
+	NEXT();
+op_ARG:
+	args.push_back(D);
+	++ip;
+	NEXT();
+op_CALL:
+	enter(ip->a, ip + 1 - base, ip->d, ip->b);
+	ip = base + bytecode.getFunctions()[ip->a].entry;
+	RELOAD();
+	NEXT();
+op_POP:
+	if (frames.back().popIndex >= frames.back().numArgs)
+	{
+		error(ip - base, "missing argument");
+	}
+	D = args[frames.back().argBase + frames.back().popIndex++];
+	++ip;
+	NEXT();
+op_RET:
+{
+	int ret = ip->d == Bytecode::NO_CELL ? 0 : D;
+	Frame frame = frames.back();
+	frames.pop_back();
+	args.resize(frame.argBase);
+	if (frames.empty())
+	{
+		goto done;
+	}
+	cellStack.resize(frame.cellBase);
+	memory.resize(frame.memBase);
+	RELOAD();
+	if (frame.dest != Bytecode::NO_CELL)
+	{
+		cells[frame.dest] = ret;
+	}
+	ip = base + frame.returnPc;
+	NEXT();
+}
+op_EXP:
+	exports[ip->a] = D;
+	++ip;
+	NEXT();
+op_IN:
+{
+	int num;
+	if (fscanf(in, "%d", &num) != 1)
+	{
+		std::cerr << "InputNum: expected a number" << std::endl;
+		exit(1);
+	}
+	D = num;
+	++ip;
+	NEXT();
+}
+op_OUT:
+	fprintf(out, "%d ", D);
+	++ip;
+	NEXT();
+op_NL:
+	fprintf(out, "\n");
+	++ip;
+	NEXT();
+op_END:
+done:
+	instructionCount = count;
+	fflush(out);
+
+#undef RELOAD
+#undef NEXT
+#undef D
+#undef A
+#undef B
+}
+
+unsigned long BytecodeVM::getInstructionCount() const
+{
+	return instructionCount;
+}
@@ -0,0 +1,197 @@
+/*
+ * CFGLayout.cpp
+ * Author: Joshua Cao
+ */
+
+#include "CFGLayout.h"
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
+
+int splitCriticalEdges(SSA::Function* f)
+{
+	int numSplit = 0;
+	for (SSA::BasicBlock* b : f->getBBs())
+	{
+		std::list<SSA::BasicBlock*> succs = b->getSuccessors();
+		if (succs.size() < 2)
+		{
+			continue;
+		}
+		for (SSA::BasicBlock* succ : succs)
+		{
+			if (succ->getPredecessors().size() < 2)
+			{
+				continue;
+			}
+
+			// successor order decides the branch target, so edges are
+			// replaced in place
+			SSA::BasicBlock* edge = new SSA::BasicBlock();
+			f->emitAfter(edge, b);
+			b->replaceSuccessor(succ, edge);
+			edge->addPredecessor(b);
+			edge->addSuccessor(succ);
+			succ->replacePredecessor(b, edge);
+			long count = b->getEdgeCount(edge);
+			if (count >= 0)
+			{
+				edge->setCount(count);
+				edge->setEdgeCount(succ, count);
+			}
+			for (SSA::Instruction* i : succ->getInstructions())
+			{
+				if (i->getOpcode() == SSA::phi && i->getOperand1())
+				{
+					i->getOperand1()->replacePhiBlock(b, edge);
+				}
+			}
+			++numSplit;
+		}
+	}
+	return numSplit;
+}
+
+static void postOrder(SSA::BasicBlock* b, std::unordered_set<SSA::BasicBlock*>& visited,
+		std::list<SSA::BasicBlock*>& order)
+{
+	visited.insert(b);
+	std::list<SSA::BasicBlock*> succs = b->getSuccessors();
+	for (auto iter = succs.rbegin(); iter != succs.rend(); ++iter)
+	{
+		if (visited.find(*iter) == visited.cend())
+		{
+			postOrder(*iter, visited, order);
+		}
+	}
+	order.push_front(b);
+}
+
+static SSA::Opcode invertBranch(SSA::Opcode op)
+{
+	switch (op)
+	{
+	case SSA::bne: return SSA::beq;
+	case SSA::beq: return SSA::bne;
+	case SSA::blt: return SSA::bge;
+	case SSA::bge: return SSA::blt;
+	case SSA::ble: return SSA::bgt;
+	case SSA::bgt: return SSA::ble;
+	}
+	return op;
+}
+
+// with a profile, make the more frequent successor the fall through
+static void orientBranches(SSA::Function* f)
+{
+	for (SSA::BasicBlock* b : f->getBBs())
+	{
+		std::list<SSA::BasicBlock*> succs = b->getSuccessors();
+		if (succs.size() != 2 || b->getInstructions().empty())
+		{
+			continue;
+		}
+		SSA::Instruction* branch = b->getInstructions().back();
+		if (invertBranch(branch->getOpcode()) == branch->getOpcode())
+		{
+			continue;
+		}
+		if (b->getEdgeCount(succs.back()) > std::max(b->getEdgeCount(succs.front()), 0L))
+		{
+			branch->setOpcode(invertBranch(branch->getOpcode()));
+			b->swapSuccessors();
+		}
+	}
+}
+
+/*
+ * place blocks of loop in rpo. a block in a nested loop places the whole
+ * nested loop, which starts at its header since the header comes first in rpo
+ */
+static void layoutLoop(SSA::LoopForest* loops, SSA::LoopForest::Loop* loop,
+		const std::list<SSA::BasicBlock*>& rpo, std::unordered_set<SSA::BasicBlock*>& placed,
+		std::list<SSA::BasicBlock*>& layout)
+{
+	for (SSA::BasicBlock* b : rpo)
+	{
+		if (placed.find(b) != placed.cend() || (loop && !loop->contains(b)))
+		{
+			continue;
+		}
+		SSA::LoopForest::Loop* inner = loops->getLoopFor(b);
+		while (inner && inner != loop && inner->parent != loop)
+		{
+			inner = inner->parent;
+		}
+		if (inner && inner != loop)
+		{
+			layoutLoop(loops, inner, rpo, placed, layout);
+		}
+		else
+		{
+			placed.insert(b);
+			layout.push_back(b);
+		}
+	}
+}
+
+void layoutBlocks(SSA::Function* f)
+{
+	std::list<SSA::BasicBlock*> BBs = f->getBBs();
+	if (BBs.empty())
+	{
+		return;
+	}
+
+	orientBranches(f);
+	std::unordered_set<SSA::BasicBlock*> visited;
+	std::list<SSA::BasicBlock*> rpo;
+	postOrder(BBs.front(), visited, rpo);
+
+	// with a profile, blocks that ran at most 1% as often as the hottest one
+	// go after the rest of the function, even out of their loops
+	long maxCount = 0;
+	for (SSA::BasicBlock* b : rpo)
+	{
+		maxCount = std::max(maxCount, b->getCount());
+	}
+	std::unordered_set<SSA::BasicBlock*> placed;
+	std::list<SSA::BasicBlock*> cold;
+	for (SSA::BasicBlock* b : rpo)
+	{
+		if (b != rpo.front() && b->getCount() >= 0 && b->getCount() * 100 <= maxCount)
+		{
+			placed.insert(b);
+			cold.push_back(b);
+		}
+	}
+
+	std::list<SSA::BasicBlock*> layout;
+	layoutLoop(f->getAnalyses().getLoopForest(), nullptr, rpo, placed, layout);
+	layout.splice(layout.end(), cold);
+
+	// keep unreachable blocks at the end in their original order
+	for (SSA::BasicBlock* b : BBs)
+	{
+		if (placed.find(b) == placed.cend())
+		{
+			layout.push_back(b);
+		}
+	}
+	f->setBBs(layout);
+}
+
+void canonicalizeCFG(SSA::Function* f)
+{
+	splitCriticalEdges(f);
+	layoutBlocks(f);
+	f->resetLineIds();
+}
+
+void canonicalizeCFG(SSA::Module* ir)
+{
+	for (SSA::Function* f : ir->getFuncs())
+	{
+		canonicalizeCFG(f);
+	}
+}
@@ -0,0 +1,639 @@
+/*
+ * CodeGen.cpp
+ * Author: Joshua Cao
+ */
+
+#include "CodeGen.h"
+#include "AsyncWriter.h"
+#include "Liveness.h"
+#include "RegAlloc.h"
+#include "SSAutils.h"
+#include <iostream>
+
+CodeGen::CodeGen(SSA::Module* ir)
+	: globalSize(0), f(nullptr), frameSize(0), numPops(0), currentIns(nullptr), currentBB(nullptr)
+{
+	for (SSA::Function* func : ir->getFuncs())
+	{
+		globalSize = std::max(globalSize, -func->getLocalVariableOffset());
+	}
+
+	// values of one function read by another get a word below the arrays
+	for (SSA::Function* func : ir->getFuncs())
+	{
+		for (SSA::BasicBlock* b : func->getBBs())
+		{
+			for (SSA::Instruction* i : b->getInstructions())
+			{
+				for (SSA::Instruction* value : SSA::getValues(i))
+				{
+					if (value->getParent()->getParent() != func && value->getOpcode() != SSA::constant
+							&& exports.find(value) == exports.cend())
+					{
+						globalSize += 4;
+						exports[value] = -globalSize;
+					}
+				}
+			}
+		}
+	}
+
+	SSA::Function* main = ir->getFunction("main");
+	if (!main)
+	{
+		std::cerr << "no main function" << std::endl;
+		exit(1);
+	}
+	clobbers = getClobberedRegs(ir);
+	loadConst(DLX::SCRATCH1, globalSize);
+	emit(DLX::SUB, DLX::SP, DLX::GP, DLX::SCRATCH1);
+	generate(main);
+	for (SSA::Function* func : ir->getFuncs())
+	{
+		if (func != main && !func->isBuiltin())
+		{
+			generate(func);
+		}
+	}
+
+	for (auto call : calls)
+	{
+		program[call.first] = DLX::encode({DLX::JSR, 0, 0, entries[call.second] * 4});
+	}
+}
+
+void CodeGen::generate(SSA::Function* func)
+{
+	f = func;
+	frameSize = f->getFrameSize();
+	numPops = 0;
+	numUses.clear();
+	entries[f] = program.size();
+
+	std::list<SSA::BasicBlock*> BBs = f->getBBs();
+	for (SSA::BasicBlock* b : BBs)
+	{
+		for (SSA::Instruction* i : b->getInstructions())
+		{
+			for (SSA::Instruction* value : SSA::getValues(i))
+			{
+				numUses[value] += 1;
+			}
+		}
+	}
+	computeSavedRegs();
+	currentIns = nullptr;
+	currentBB = nullptr;
+
+	if (f->getName() != "main")
+	{
+		emit(DLX::PSH, DLX::RA, DLX::SP, -4);
+		emit(DLX::PSH, DLX::FP, DLX::SP, -4);
+	}
+	emit(DLX::ADD, DLX::FP, DLX::ZERO, DLX::SP);
+	if (frameSize)
+	{
+		loadConst(DLX::SCRATCH1, frameSize);
+		emit(DLX::SUB, DLX::SP, DLX::SP, DLX::SCRATCH1);
+	}
+
+	// branch offsets are patched once every block has an address
+	std::unordered_map<SSA::BasicBlock*, int> addresses;
+	std::list<std::pair<int, SSA::BasicBlock*>> targets;
+	for (auto bIter = BBs.begin(); bIter != BBs.end(); ++bIter)
+	{
+		SSA::BasicBlock* b = *bIter;
+		SSA::BasicBlock* next = std::next(bIter) == BBs.end() ? nullptr : *std::next(bIter);
+		addresses[b] = program.size();
+		currentBB = b;
+
+		std::list<SSA::Instruction*>& instructions = b->getInstructions();
+		std::list<SSA::Instruction*> moves;
+		SSA::Instruction* branch = nullptr;
+		int condition = DLX::ZERO;
+		SSA::Instruction* prev = nullptr;
+		for (auto iter = instructions.begin(); iter != instructions.end(); ++iter)
+		{
+			SSA::Instruction* i = *iter;
+			SSA::Instruction* nextIns = std::next(iter) == instructions.end() ? nullptr : *std::next(iter);
+			currentIns = i;
+			if (i->getOpcode() == SSA::move)
+			{
+				moves.push_back(i);
+			}
+			else if (SSA::isBranch(i->getOpcode()))
+			{
+				// later moves could overwrite the condition
+				branch = i;
+				if (i->getOperand1())
+				{
+					condition = use(i->getOperand1(), DLX::BRANCH_SCRATCH);
+					if (nextIns && condition != DLX::BRANCH_SCRATCH)
+					{
+						emit(DLX::ADD, DLX::BRANCH_SCRATCH, DLX::ZERO, condition);
+						condition = DLX::BRANCH_SCRATCH;
+					}
+				}
+			}
+			else if (i->getOpcode() != SSA::phi)
+			{
+				generateMoves(moves);
+				moves.clear();
+				currentIns = i;
+				generate(i, prev, nextIns);
+			}
+			prev = i;
+		}
+		generateMoves(moves);
+		currentIns = branch ? branch : prev;
+
+		// the branch target is the second successor, otherwise fall through
+		// to the first
+		std::list<SSA::BasicBlock*> succs = b->getSuccessors();
+		if (succs.empty())
+		{
+			if (!prev || (prev->getOpcode() != SSA::ret && prev->getOpcode() != SSA::end))
+			{
+				generateReturn(nullptr);
+			}
+			continue;
+		}
+		SSA::BasicBlock* fallThrough = succs.front();
+		if (branch && branch->getOpcode() == SSA::bra)
+		{
+			fallThrough = succs.back();
+		}
+		else if (branch && succs.size() > 1)
+		{
+			DLX::Opcode op;
+			switch (branch->getOpcode())
+			{
+			case SSA::bne: op = DLX::BNE; break;
+			case SSA::beq: op = DLX::BEQ; break;
+			case SSA::ble: op = DLX::BLE; break;
+			case SSA::blt: op = DLX::BLT; break;
+			case SSA::bge: op = DLX::BGE; break;
+			default: op = DLX::BGT; break;
+			}
+			targets.push_back(std::make_pair(program.size(), *std::next(succs.begin())));
+			emit(op, condition, 0, 0);
+		}
+		if (fallThrough != next)
+		{
+			targets.push_back(std::make_pair(program.size(), fallThrough));
+			emit(DLX::BEQ, DLX::ZERO, 0, 0);
+		}
+	}
+
+	for (auto target : targets)
+	{
+		DLX::Instruction instr = DLX::decode(program[target.first]);
+		instr.c = addresses[target.second] - target.first;
+		if (!DLX::fitsImmediate(instr.c))
+		{
+			std::cerr << "branch out of range in " << f->getName() << std::endl;
+			exit(1);
+		}
+		program[target.first] = DLX::encode(instr);
+	}
+}
+
+void CodeGen::generate(SSA::Instruction* i, SSA::Instruction* prev, SSA::Instruction* next)
+{
+	SSA::Operand* x = i->getOperand1();
+	SSA::Operand* y = i->getOperand2();
+	switch (i->getOpcode())
+	{
+	case SSA::add:
+		generateArithmetic(i, DLX::ADD, DLX::ADDI);
+		break;
+	case SSA::sub:
+		generateArithmetic(i, DLX::SUB, DLX::SUBI);
+		break;
+	case SSA::mul:
+		generateArithmetic(i, DLX::MUL, DLX::MULI);
+		break;
+	case SSA::div:
+		generateArithmetic(i, DLX::DIV, DLX::DIVI);
+		break;
+	case SSA::cmp:
+		generateArithmetic(i, DLX::CMP, DLX::CMPI);
+		break;
+	case SSA::adda:
+	{
+		if (isFused(i, next))
+		{
+			break;
+		}
+		SSA::Operand* offset = x->getType() == SSA::Operand::globalReg ? y : x;
+		int c;
+		if (offset->getType() == SSA::Operand::globalReg || (x->getType() != SSA::Operand::globalReg
+				&& y->getType() != SSA::Operand::globalReg))
+		{
+			generateArithmetic(i, DLX::ADD, DLX::ADDI);
+		}
+		else if (getConst(offset, c))
+		{
+			// spill slots are at non negative offsets, arrays at negative ones
+			int base = c >= 0 ? DLX::FP : DLX::GP;
+			loadConst(DLX::SCRATCH1, c >= 0 ? c - frameSize : c);
+			emit(DLX::ADD, dest(i), base, DLX::SCRATCH1);
+		}
+		else
+		{
+			emit(DLX::ADD, dest(i), DLX::GP, use(offset, DLX::SCRATCH1));
+		}
+		break;
+	}
+	case SSA::constant:
+		if (i->getReg() < 0 && exports.find(i) == exports.cend())
+		{
+			return;
+		}
+		loadConst(dest(i), x->getConst());
+		break;
+	case SSA::load:
+	case SSA::store:
+		generateMemoryAccess(i, prev);
+		break;
+	case SSA::read:
+		emit(DLX::RDD, dest(i), 0, 0);
+		break;
+	case SSA::write:
+		emit(DLX::WRD, 0, use(x, DLX::SCRATCH1), 0);
+		break;
+	case SSA::writeNL:
+		emit(DLX::WRL, 0, 0, 0);
+		break;
+	case SSA::call:
+		generateCall(i);
+		break;
+	case SSA::pop:
+		if (i->getReg() >= 0 || exports.find(i) != exports.cend())
+		{
+			emit(DLX::LDW, dest(i), DLX::FP, 8 + 4 * numPops);
+		}
+		++numPops;
+		break;
+	case SSA::ret:
+		generateReturn(x);
+		break;
+	case SSA::end:
+		emit(DLX::RET, 0, 0, DLX::ZERO);
+		break;
+	}
+
+	if (exports.find(i) != exports.cend())
+	{
+		emit(DLX::STW, dest(i), DLX::GP, exports[i]);
+	}
+}
+
+/*
+ * moves are a parallel copy, see insertMoveBeforePhi. moves between
+ * registers are ordered first, then the rest, which only write registers
+ */
+void CodeGen::generateMoves(std::list<SSA::Instruction*> moves)
+{
+	std::list<std::pair<int, int>> parallel;
+	std::list<SSA::Instruction*> rest;
+	if (!moves.empty())
+	{
+		currentIns = moves.front();
+	}
+	for (SSA::Instruction* move : moves)
+	{
+		SSA::Operand* src = move->getOperand1();
+		int c;
+		if (move->getReg() < 0)
+		{
+			continue;
+		}
+		if (src->getType() == SSA::Operand::val && !getConst(src, c)
+				&& src->getInstruction()->getParent()->getParent() == f)
+		{
+			parallel.push_back(std::make_pair(dest(move), reg(src->getInstruction())));
+		}
+		else
+		{
+			rest.push_back(move);
+		}
+	}
+	for (auto move : sequentializeMoves(parallel, DLX::MOVE_SCRATCH))
+	{
+		emit(DLX::ADD, move.first, DLX::ZERO, move.second);
+	}
+	for (SSA::Instruction* move : rest)
+	{
+		int src = use(move->getOperand1(), dest(move));
+		if (src != dest(move))
+		{
+			emit(DLX::ADD, dest(move), DLX::ZERO, src);
+		}
+	}
+}
+
+void CodeGen::generateArithmetic(SSA::Instruction* i, DLX::Opcode op, DLX::Opcode opi)
+{
+	SSA::Operand* x = i->getOperand1();
+	SSA::Operand* y = i->getOperand2();
+	bool commutative = op == DLX::ADD || op == DLX::MUL;
+	int c;
+	if (getConst(y, c) && DLX::fitsImmediate(c))
+	{
+		emit(opi, dest(i), use(x, DLX::SCRATCH1), c);
+	}
+	else if (commutative && getConst(x, c) && DLX::fitsImmediate(c))
+	{
+		emit(opi, dest(i), use(y, DLX::SCRATCH1), c);
+	}
+	else
+	{
+		emit(op, dest(i), use(x, DLX::SCRATCH1), use(y, DLX::SCRATCH2));
+	}
+}
+
+/*
+ * an adda only used by the load or store right after it is folded into the
+ * access, addressing a spill slot from FP or an array element from GP
+ */
+bool CodeGen::isFused(SSA::Instruction* adda, SSA::Instruction* memAccess)
+{
+	if (!memAccess || (memAccess->getOpcode() != SSA::load && memAccess->getOpcode() != SSA::store)
+			|| numUses[adda] != 1 || exports.find(adda) != exports.cend())
+	{
+		return false;
+	}
+	SSA::Operand* address = memAccess->getOperand1();
+	if (!address || address->getType() != SSA::Operand::val || address->getInstruction() != adda)
+	{
+		return false;
+	}
+	return (adda->getOperand1()->getType() == SSA::Operand::globalReg)
+			!= (adda->getOperand2()->getType() == SSA::Operand::globalReg);
+}
+
+void CodeGen::generateMemoryAccess(SSA::Instruction* i, SSA::Instruction* prev)
+{
+	bool isLoad = i->getOpcode() == SSA::load;
+	int value = isLoad ? dest(i) : use(i->getOperand2(), DLX::SCRATCH2);
+	if (prev && prev->getOpcode() == SSA::adda && isFused(prev, i))
+	{
+		SSA::Operand* offset = SSA::getMemoryAccessOffset(i);
+		int c;
+		if (getConst(offset, c))
+		{
+			int base = c >= 0 ? DLX::FP : DLX::GP;
+			c = c >= 0 ? c - frameSize : c;
+			if (DLX::fitsImmediate(c))
+			{
+				emit(isLoad ? DLX::LDW : DLX::STW, value, base, c);
+			}
+			else
+			{
+				loadConst(DLX::SCRATCH1, c);
+				emit(isLoad ? DLX::LDX : DLX::STX, value, base, DLX::SCRATCH1);
+			}
+		}
+		else
+		{
+			emit(isLoad ? DLX::LDX : DLX::STX, value, DLX::GP, use(offset, DLX::SCRATCH1));
+		}
+		return;
+	}
+	emit(isLoad ? DLX::LDW : DLX::STW, value, use(i->getOperand1(), DLX::SCRATCH1), 0);
+}
+
+void CodeGen::generateCall(SSA::Instruction* i)
+{
+	SSA::Operand::FunctionCall* call = i->getOperand1()->getFunctionCall();
+	std::string name = call->function->getName();
+	if (name == "InputNum")
+	{
+		emit(DLX::RDD, dest(i), 0, 0);
+		return;
+	}
+	if (name == "OutputNum")
+	{
+		emit(DLX::WRD, 0, call->args.empty() ? DLX::ZERO : use(call->args.front(), DLX::SCRATCH1), 0);
+		return;
+	}
+	if (name == "OutputNewLine")
+	{
+		emit(DLX::WRL, 0, 0, 0);
+		return;
+	}
+
+	std::vector<int>& saved = savedRegs[i];
+	for (int r : saved)
+	{
+		emit(DLX::PSH, r, DLX::SP, -4);
+	}
+	for (auto iter = call->args.rbegin(); iter != call->args.rend(); ++iter)
+	{
+		emit(DLX::PSH, use(*iter, DLX::SCRATCH1), DLX::SP, -4);
+	}
+	calls.push_back(std::make_pair(program.size(), call->function));
+	emit(DLX::JSR, 0, 0, 0);
+	if (!call->args.empty())
+	{
+		emit(DLX::ADDI, DLX::SP, DLX::SP, 4 * call->args.size());
+	}
+	for (auto iter = saved.rbegin(); iter != saved.rend(); ++iter)
+	{
+		emit(DLX::POP, *iter, DLX::SP, 4);
+	}
+	if (i->hasOutput() && (i->getReg() >= 0 || exports.find(i) != exports.cend()))
+	{
+		emit(DLX::ADD, dest(i), DLX::ZERO, DLX::RV);
+	}
+}
+
+void CodeGen::generateReturn(SSA::Operand* value)
+{
+	if (f->getName() == "main")
+	{
+		emit(DLX::RET, 0, 0, DLX::ZERO);
+		return;
+	}
+	if (value)
+	{
+		int r = use(value, DLX::RV);
+		if (r != DLX::RV)
+		{
+			emit(DLX::ADD, DLX::RV, DLX::ZERO, r);
+		}
+	}
+	emit(DLX::ADD, DLX::SP, DLX::ZERO, DLX::FP);
+	emit(DLX::POP, DLX::FP, DLX::SP, 4);
+	emit(DLX::POP, DLX::RA, DLX::SP, 4);
+	emit(DLX::RET, 0, 0, DLX::RA);
+}
+
+// DLX registers of the values live across each call
+void CodeGen::computeSavedRegs()
+{
+	savedRegs.clear();
+	for (auto call : getRegsLiveAcrossCalls(f, clobbers))
+	{
+		for (int r : call.second)
+		{
+			savedRegs[call.first].push_back(DLX::FIRST_ALLOC_REG + r);
+		}
+	}
+}
+
+// constants, including constant instructions of other functions
+bool CodeGen::getConst(SSA::Operand* o, int& c)
+{
+	if (o->getType() == SSA::Operand::constant)
+	{
+		c = o->getConst();
+		return true;
+	}
+	if (o->getType() == SSA::Operand::val && o->getInstruction()->getOpcode() == SSA::constant)
+	{
+		c = o->getInstruction()->getOperand1()->getConst();
+		return true;
+	}
+	return false;
+}
+
+// @return register holding o, which is loaded into scratch if needed
+int CodeGen::use(SSA::Operand* o, int scratch)
+{
+	int c;
+	if (getConst(o, c))
+	{
+		if (c == 0)
+		{
+			return DLX::ZERO;
+		}
+		loadConst(scratch, c);
+		return scratch;
+	}
+	switch (o->getType())
+	{
+	case SSA::Operand::globalReg:
+		return DLX::GP;
+	case SSA::Operand::val:
+	{
+		SSA::Instruction* i = o->getInstruction();
+		if (i->getParent()->getParent() != f)
+		{
+			if (exports.find(i) == exports.cend())
+			{
+				std::cerr << "no export for {" << i->toStr() << "}" << std::endl;
+				exit(1);
+			}
+			emit(DLX::LDW, scratch, DLX::GP, exports[i]);
+			return scratch;
+		}
+		if (i->getReg() < 0)
+		{
+			std::cerr << "no register for {" << i->toStr() << "}" << std::endl;
+			exit(1);
+		}
+		return reg(i);
+	}
+	}
+	std::cerr << "cannot generate operand " << o->toStr() << std::endl;
+	exit(1);
+}
+
+// dead values are written to scratch
+int CodeGen::dest(SSA::Instruction* i)
+{
+	return i->getReg() < 0 ? DLX::SCRATCH1 : reg(i);
+}
+
+int CodeGen::reg(SSA::Instruction* i)
+{
+	return DLX::FIRST_ALLOC_REG + i->getReg();
+}
+
+/*
+ * immediates are sign extended 16 bits, so larger constants are built from
+ * the upper half shifted into place plus the lower half
+ */
+void CodeGen::loadConst(int r, int c)
+{
+	if (DLX::fitsImmediate(c))
+	{
+		emit(DLX::ADDI, r, DLX::ZERO, c);
+		return;
+	}
+	int low = int16_t(c & 0xFFFF);
+	int high = (int64_t(c) - low) >> 16;
+	emit(DLX::ADDI, r, DLX::ZERO, high);
+	emit(DLX::LSHI, r, r, 16);
+	if (low)
+	{
+		emit(DLX::ADDI, r, r, low);
+	}
+}
+
+void CodeGen::emit(DLX::Opcode op, int a, int b, int c)
+{
+	program.push_back(DLX::encode({op, a, b, c}));
+	origins.push_back(currentIns);
+	originBlocks.push_back(currentBB);
+}
+
+const std::vector<uint32_t>& CodeGen::getProgram() const
+{
+	return program;
+}
+
+int CodeGen::getEntry(SSA::Function* func) const
+{
+	return entries.at(func);
+}
+
+int CodeGen::getGlobalSize() const
+{
+	return globalSize;
+}
+
+SSA::Instruction* CodeGen::getOrigin(int pc) const
+{
+	return origins[pc];
+}
+
+SSA::BasicBlock* CodeGen::getOriginBlock(int pc) const
+{
+	return originBlocks[pc];
+}
+
+void CodeGen::write(std::string fileName) const
+{
+	std::string bytes;
+	bytes.reserve(program.size() * 4);
+	for (uint32_t word : program)
+	{
+		bytes += char(word);
+		bytes += char(word >> 8);
+		bytes += char(word >> 16);
+		bytes += char(word >> 24);
+	}
+	writeFileAsync(fileName, std::move(bytes));
+}
+
+std::string CodeGen::toStr() const
+{
+	std::unordered_map<int, std::string> labels;
+	for (auto entry : entries)
+	{
+		labels[entry.second] = entry.first->getName();
+	}
+	std::string s = "";
+	for (int pc = 0; pc < program.size(); ++pc)
+	{
+		if (labels.find(pc) != labels.cend())
+		{
+			s += labels[pc] + ":\n";
+		}
+		s += '\t' + std::to_string(pc * 4) + ": " + DLX::toStr(DLX::decode(program[pc])) + '\n';
+	}
+	return s;
+}
@@ -0,0 +1,181 @@
+/*
+ * CompileCache.cpp
+ * Author: Joshua Cao
+ */
+
+#include "CompileCache.h"
+#include "AsyncWriter.h"
+#include "BinaryIR.h"
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utime.h>
+#include <vector>
+
+// entries of other builds are never hit, every rebuild starts a new cache
+static const char* const BUILD = __DATE__ " " __TIME__;
+static const char* const ENTRY_EXTENSION = ".entry";
+// temporary files of AsyncWriter older than this are left by dead processes
+static const time_t STALE_SECONDS = 600;
+
+// 64 bit FNV-1a
+static uint64_t hash(const std::string& s)
+{
+	uint64_t h = 14695981039346656037ull;
+	for (char c : s)
+	{
+		h = (h ^ uint8_t(c)) * 1099511628211ull;
+	}
+	return h;
+}
+
+CompileCache::CompileCache(std::string dir, std::size_t maxBytes) : dir(dir), maxBytes(maxBytes)
+{
+	if (!this->dir.empty() && this->dir.back() != '/')
+	{
+		this->dir += '/';
+	}
+}
+
+std::string CompileCache::key(const std::string& options, const std::string& source)
+{
+	return std::string(BUILD) + " ir " + std::to_string(BinaryIR::VERSION) + '\0' + options + '\0' + source;
+}
+
+std::string CompileCache::entryName(const std::string& key) const
+{
+	char name[17];
+	snprintf(name, sizeof(name), "%016lx", (unsigned long) hash(key));
+	return dir + name + ENTRY_EXTENSION;
+}
+
+/*
+ * an entry is the length of its key as 8 little endian bytes, the key and
+ * the data
+ */
+bool CompileCache::lookupData(const std::string& key, const std::function<bool(const char*, std::size_t)>& read)
+{
+	std::string fileName = entryName(key);
+	int fd = open(fileName.c_str(), O_RDONLY);
+	if (fd < 0)
+	{
+		return false;
+	}
+	struct stat s;
+	bool hit = false;
+	if (fstat(fd, &s) == 0 && std::size_t(s.st_size) >= 8 + key.size())
+	{
+		void* map = mmap(nullptr, s.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (map != MAP_FAILED)
+		{
+			const char* data = static_cast<const char*>(map);
+			uint64_t keySize = 0;
+			for (int i = 0; i < 8; ++i)
+			{
+				keySize |= uint64_t(uint8_t(data[i])) << (8 * i);
+			}
+			if (keySize == key.size() && memcmp(data + 8, key.data(), key.size()) == 0)
+			{
+				hit = read(data + 8 + keySize, s.st_size - 8 - keySize);
+			}
+			munmap(map, s.st_size);
+		}
+	}
+	close(fd);
+	if (hit)
+	{
+		utime(fileName.c_str(), nullptr);
+	}
+	return hit;
+}
+
+void CompileCache::storeData(const std::string& key, const std::string& data)
+{
+	std::string entry;
+	for (int i = 0; i < 8; ++i)
+	{
+		entry += char(uint64_t(key.size()) >> (8 * i));
+	}
+	entry += key;
+	entry += data;
+	writeFileAsync(entryName(key), std::move(entry));
+}
+
+SSA::Module* CompileCache::lookup(const std::string& key, bool& allocated)
+{
+	SSA::Module* ir = nullptr;
+	lookupData(key, [&](const char* data, std::size_t size)
+	{
+		bool entryAllocated;
+		ir = BinaryIR::deserialize(data, size, entryAllocated);
+		allocated = ir ? entryAllocated : allocated;
+		return ir != nullptr;
+	});
+	return ir;
+}
+
+void CompileCache::store(const std::string& key, SSA::Module* ir, bool allocated)
+{
+	storeData(key, BinaryIR::serialize(ir, allocated));
+}
+
+void CompileCache::evict()
+{
+	DIR* d = opendir(dir.c_str());
+	if (!d)
+	{
+		return;
+	}
+	struct Entry
+	{
+		std::string fileName;
+		time_t modified;
+		std::size_t size;
+	};
+	std::vector<Entry> entries;
+	std::size_t total = 0;
+	time_t now = time(nullptr);
+	while (dirent* file = readdir(d))
+	{
+		std::string fileName = dir + file->d_name;
+		struct stat s;
+		if (stat(fileName.c_str(), &s) != 0 || !S_ISREG(s.st_mode))
+		{
+			continue;
+		}
+		std::string name = file->d_name;
+		// other files are not the cache's to delete
+		if (name.find(ENTRY_EXTENSION) == std::string::npos)
+		{
+			continue;
+		}
+		if (name.size() > 4 && name.compare(name.size() - 4, 4, ".tmp") == 0)
+		{
+			// may still be written by another process
+			if (now - s.st_mtime > STALE_SECONDS)
+			{
+				unlink(fileName.c_str());
+			}
+			continue;
+		}
+		entries.push_back({fileName, s.st_mtime, std::size_t(s.st_size)});
+		total += s.st_size;
+	}
+	closedir(d);
+
+	std::sort(entries.begin(), entries.end(), [](const Entry& x, const Entry& y) { return x.modified < y.modified; });
+	for (const Entry& entry : entries)
+	{
+		if (total <= maxBytes)
+		{
+			break;
+		}
+		unlink(entry.fileName.c_str());
+		total -= entry.size;
+	}
+}
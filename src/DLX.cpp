@@ -0,0 +1,145 @@
+/*
+ * DLX.cpp
+ * Author: Joshua Cao
+ */
+
+#include "DLX.h"
+
+DLX::Format DLX::getFormat(Opcode op)
+{
+	if (op == JSR)
+	{
+		return F3;
+	}
+	if (op <= CHK || op == LDX || op == STX || op == RET || (op >= RDD && op <= WRL))
+	{
+		return F2;
+	}
+	return F1;
+}
+
+bool DLX::fitsImmediate(int64_t c)
+{
+	return c >= INT16_MIN && c <= INT16_MAX;
+}
+
+uint32_t DLX::encode(Instruction instr)
+{
+	uint32_t word = uint32_t(instr.op) << 26;
+	switch (getFormat(instr.op))
+	{
+	case F1:
+		return word | (instr.a & 0x1F) << 21 | (instr.b & 0x1F) << 16 | (instr.c & 0xFFFF);
+	case F2:
+		return word | (instr.a & 0x1F) << 21 | (instr.b & 0x1F) << 16 | (instr.c & 0x1F);
+	case F3:
+		return word | (instr.c & 0x3FFFFFF);
+	}
+	return word;
+}
+
+DLX::Instruction DLX::decode(uint32_t word)
+{
+	Instruction instr;
+	instr.op = Opcode(word >> 26);
+	instr.a = (word >> 21) & 0x1F;
+	instr.b = (word >> 16) & 0x1F;
+	switch (getFormat(instr.op))
+	{
+	case F1:
+		instr.c = int16_t(word & 0xFFFF);
+		break;
+	case F2:
+		instr.c = word & 0x1F;
+		break;
+	case F3:
+		instr.a = 0;
+		instr.b = 0;
+		instr.c = word & 0x3FFFFFF;
+		break;
+	}
+	return instr;
+}
+
+std::string DLX::opToStr(Opcode op)
+{
+	switch (op)
+	{
+	case ADD:	return "ADD";
+	case SUB:	return "SUB";
+	case MUL:	return "MUL";
+	case DIV:	return "DIV";
+	case MOD:	return "MOD";
+	case CMP:	return "CMP";
+	case OR:	return "OR";
+	case AND:	return "AND";
+	case BIC:	return "BIC";
+	case XOR:	return "XOR";
+	case LSH:	return "LSH";
+	case ASH:	return "ASH";
+	case CHK:	return "CHK";
+	case ADDI:	return "ADDI";
+	case SUBI:	return "SUBI";
+	case MULI:	return "MULI";
+	case DIVI:	return "DIVI";
+	case MODI:	return "MODI";
+	case CMPI:	return "CMPI";
+	case ORI:	return "ORI";
+	case ANDI:	return "ANDI";
+	case BICI:	return "BICI";
+	case XORI:	return "XORI";
+	case LSHI:	return "LSHI";
+	case ASHI:	return "ASHI";
+	case CHKI:	return "CHKI";
+	case LDW:	return "LDW";
+	case LDX:	return "LDX";
+	case POP:	return "POP";
+	case STW:	return "STW";
+	case STX:	return "STX";
+	case PSH:	return "PSH";
+	case BEQ:	return "BEQ";
+	case BNE:	return "BNE";
+	case BLT:	return "BLT";
+	case BGE:	return "BGE";
+	case BLE:	return "BLE";
+	case BGT:	return "BGT";
+	case BSR:	return "BSR";
+	case JSR:	return "JSR";
+	case RET:	return "RET";
+	case RDD:	return "RDD";
+	case WRD:	return "WRD";
+	case WRH:	return "WRH";
+	case WRL:	return "WRL";
+	case ERR:	return "ERR";
+	}
+	return "???";
+}
+
+std::string DLX::toStr(Instruction instr)
+{
+	std::string s = opToStr(instr.op);
+	switch (instr.op)
+	{
+	case BEQ:
+	case BNE:
+	case BLT:
+	case BGE:
+	case BLE:
+	case BGT:
+		return s + " R" + std::to_string(instr.a) + ' ' + std::to_string(instr.c);
+	case BSR:
+	case JSR:
+		return s + ' ' + std::to_string(instr.c);
+	case RET:
+		return s + " R" + std::to_string(instr.c);
+	case RDD:
+		return s + " R" + std::to_string(instr.a);
+	case WRD:
+	case WRH:
+		return s + " R" + std::to_string(instr.b);
+	case WRL:
+		return s;
+	}
+	std::string c = getFormat(instr.op) == F2 ? "R" + std::to_string(instr.c) : std::to_string(instr.c);
+	return s + " R" + std::to_string(instr.a) + " R" + std::to_string(instr.b) + ' ' + c;
+}
@@ -0,0 +1,351 @@
+/*
+ * DLXSimulator.cpp
+ * Author: Joshua Cao
+ */
+
+#include "DLXSimulator.h"
+#include <algorithm>
+#include <iostream>
+#include <map>
+
+DLXSimulator::DLXSimulator(const std::vector<uint32_t>& program, int memorySize, FILE* in, FILE* out)
+	: memory(memorySize / 4, 0), in(in), out(out), cycles(0), instructionCount(0), loads(0),
+	  stores(0), branches(0), takenBranches(0), counts(program.size(), 0), pcCycles(program.size(), 0)
+{
+	if (program.size() > memory.size())
+	{
+		std::cerr << "program does not fit in memory" << std::endl;
+		exit(1);
+	}
+	for (int pc = 0; pc < program.size(); ++pc)
+	{
+		code.push_back(DLX::decode(program[pc]));
+		memory[pc] = program[pc];
+	}
+
+	// rough costs of a simple in order pipeline
+	std::fill(latencies, latencies + DLX::ERR + 1, 1);
+	setLatency(DLX::MUL, 4);
+	setLatency(DLX::MULI, 4);
+	setLatency(DLX::DIV, 20);
+	setLatency(DLX::DIVI, 20);
+	setLatency(DLX::MOD, 20);
+	setLatency(DLX::MODI, 20);
+	setLatency(DLX::LDW, 3);
+	setLatency(DLX::LDX, 3);
+	setLatency(DLX::POP, 3);
+	setLatency(DLX::STW, 2);
+	setLatency(DLX::STX, 2);
+	setLatency(DLX::PSH, 2);
+	setLatency(DLX::JSR, 2);
+	setLatency(DLX::RET, 2);
+}
+
+void DLXSimulator::setLatency(DLX::Opcode op, int latency)
+{
+	latencies[op] = latency;
+}
+
+bool DLXSimulator::setLatencies(std::string spec)
+{
+	std::size_t start = 0;
+	while (start < spec.size())
+	{
+		std::size_t end = spec.find(',', start);
+		if (end == std::string::npos)
+		{
+			end = spec.size();
+		}
+		std::string entry = spec.substr(start, end - start);
+		std::size_t equals = entry.find('=');
+		if (equals == std::string::npos)
+		{
+			return false;
+		}
+		std::string name = entry.substr(0, equals);
+		int op = 0;
+		while (op <= DLX::ERR && DLX::opToStr(DLX::Opcode(op)) != name)
+		{
+			++op;
+		}
+		if (op > DLX::ERR)
+		{
+			return false;
+		}
+		setLatency(DLX::Opcode(op), atoi(entry.c_str() + equals + 1));
+		start = end + 1;
+	}
+	return true;
+}
+
+void DLXSimulator::run()
+{
+	std::fill(regs, regs + DLX::NUM_REGS, 0);
+	regs[DLX::GP] = memory.size() * 4;
+	int pc = 0;
+	while (true)
+	{
+		if (pc < 0 || pc >= code.size())
+		{
+			error(pc, "jump outside of the program");
+		}
+		const DLX::Instruction& instr = code[pc];
+		int a = instr.a;
+		int b = instr.b;
+		int c = instr.c;
+		// F2 arithmetic reads its second operand from register c
+		int operand = DLX::getFormat(instr.op) == DLX::F2 ? regs[c] : c;
+		int next = pc + 1;
+
+		++counts[pc];
+		++instructionCount;
+		cycles += latencies[instr.op];
+		pcCycles[pc] += latencies[instr.op];
+
+		switch (instr.op)
+		{
+		case DLX::ADD:
+		case DLX::ADDI:
+			regs[a] = uint32_t(regs[b]) + uint32_t(operand);
+			break;
+		case DLX::SUB:
+		case DLX::SUBI:
+			regs[a] = uint32_t(regs[b]) - uint32_t(operand);
+			break;
+		case DLX::MUL:
+		case DLX::MULI:
+			regs[a] = uint32_t(regs[b]) * uint32_t(operand);
+			break;
+		case DLX::DIV:
+		case DLX::DIVI:
+			if (operand == 0)
+			{
+				error(pc, "division by zero");
+			}
+			regs[a] = regs[b] / operand;
+			break;
+		case DLX::MOD:
+		case DLX::MODI:
+			if (operand == 0)
+			{
+				error(pc, "division by zero");
+			}
+			regs[a] = regs[b] % operand;
+			break;
+		case DLX::CMP:
+		case DLX::CMPI:
+			regs[a] = (regs[b] > operand) - (regs[b] < operand);
+			break;
+		case DLX::OR:
+		case DLX::ORI:
+			regs[a] = regs[b] | operand;
+			break;
+		case DLX::AND:
+		case DLX::ANDI:
+			regs[a] = regs[b] & operand;
+			break;
+		case DLX::BIC:
+		case DLX::BICI:
+			regs[a] = regs[b] & ~operand;
+			break;
+		case DLX::XOR:
+		case DLX::XORI:
+			regs[a] = regs[b] ^ operand;
+			break;
+		case DLX::LSH:
+		case DLX::LSHI:
+			regs[a] = operand >= 0 ? uint32_t(regs[b]) << operand : uint32_t(regs[b]) >> -operand;
+			break;
+		case DLX::ASH:
+		case DLX::ASHI:
+			regs[a] = operand >= 0 ? uint32_t(regs[b]) << operand : regs[b] >> -operand;
+			break;
+		case DLX::CHK:
+		case DLX::CHKI:
+			if (regs[a] < 0 || regs[a] >= operand)
+			{
+				error(pc, "index " + std::to_string(regs[a]) + " out of bounds");
+			}
+			break;
+		case DLX::LDW:
+			++loads;
+			regs[a] = word(regs[b] + c, pc);
+			break;
+		case DLX::LDX:
+			++loads;
+			regs[a] = word(regs[b] + regs[c], pc);
+			break;
+		case DLX::POP:
+			++loads;
+			regs[a] = word(regs[b], pc);
+			regs[b] += c;
+			break;
+		case DLX::STW:
+			++stores;
+			word(regs[b] + c, pc) = regs[a];
+			break;
+		case DLX::STX:
+			++stores;
+			word(regs[b] + regs[c], pc) = regs[a];
+			break;
+		case DLX::PSH:
+			++stores;
+			regs[b] += c;
+			word(regs[b], pc) = regs[a];
+			break;
+		case DLX::BEQ:
+		case DLX::BNE:
+		case DLX::BLT:
+		case DLX::BGE:
+		case DLX::BLE:
+		case DLX::BGT:
+		{
+			bool taken;
+			switch (instr.op)
+			{
+			case DLX::BEQ: taken = regs[a] == 0; break;
+			case DLX::BNE: taken = regs[a] != 0; break;
+			case DLX::BLT: taken = regs[a] < 0; break;
+			case DLX::BGE: taken = regs[a] >= 0; break;
+			case DLX::BLE: taken = regs[a] <= 0; break;
+			default: taken = regs[a] > 0; break;
+			}
+			++branches;
+			if (taken)
+			{
+				++takenBranches;
+				next = pc + c;
+			}
+			break;
+		}
+		case DLX::BSR:
+			regs[DLX::RA] = (pc + 1) * 4;
+			next = pc + c;
+			break;
+		case DLX::JSR:
+			regs[DLX::RA] = (pc + 1) * 4;
+			next = c / 4;
+			break;
+		case DLX::RET:
+			if (c == 0)
+			{
+				fflush(out);
+				return;
+			}
+			next = regs[c] / 4;
+			break;
+		case DLX::RDD:
+			if (fscanf(in, "%d", &regs[a]) != 1)
+			{
+				std::cerr << "InputNum: expected a number" << std::endl;
+				exit(1);
+			}
+			break;
+		case DLX::WRD:
+			fprintf(out, "%d ", regs[b]);
+			break;
+		case DLX::WRH:
+			fprintf(out, "0x%x ", regs[b]);
+			break;
+		case DLX::WRL:
+			fprintf(out, "\n");
+			break;
+		default:
+			error(pc, "illegal instruction " + DLX::opToStr(instr.op));
+		}
+		regs[DLX::ZERO] = 0;
+		pc = next;
+	}
+}
+
+int& DLXSimulator::word(int address, int pc)
+{
+	if (address % 4 != 0 || address < 0 || address / 4 >= memory.size())
+	{
+		error(pc, "invalid memory address " + std::to_string(address));
+	}
+	if (address / 4 < code.size())
+	{
+		error(pc, "access to program memory at " + std::to_string(address));
+	}
+	return memory[address / 4];
+}
+
+void DLXSimulator::error(int pc, std::string msg) const
+{
+	std::cerr << msg << " at " << pc * 4 << std::endl;
+	exit(1);
+}
+
+unsigned long DLXSimulator::getCycles() const
+{
+	return cycles;
+}
+
+unsigned long DLXSimulator::getInstructionCount() const
+{
+	return instructionCount;
+}
+
+unsigned long DLXSimulator::getCount(int pc) const
+{
+	return counts[pc];
+}
+
+std::string DLXSimulator::statsToStr() const
+{
+	return "cycles: " + std::to_string(cycles) + '\n'
+			+ "instructions: " + std::to_string(instructionCount) + '\n'
+			+ "loads: " + std::to_string(loads) + '\n'
+			+ "stores: " + std::to_string(stores) + '\n'
+			+ "branches: " + std::to_string(branches) + " (" + std::to_string(takenBranches) + " taken)\n";
+}
+
+std::string DLXSimulator::profileToStr(const CodeGen& codeGen, int numHottest) const
+{
+	std::string s = "basic blocks:\n";
+	std::map<SSA::BasicBlock*, bool> seen;
+	for (int pc = 0; pc < counts.size(); ++pc)
+	{
+		SSA::BasicBlock* b = codeGen.getOriginBlock(pc);
+		if (!b || seen[b])
+		{
+			continue;
+		}
+		seen[b] = true;
+
+		// blocks are named by their position, as in GraphML
+		SSA::Function* f = b->getParent();
+		std::list<SSA::BasicBlock*> BBs = f->getBBs();
+		int index = std::distance(BBs.begin(), std::find(BBs.begin(), BBs.end(), b));
+		s += '\t' + f->getName() + std::to_string(index) + ": " + std::to_string(counts[pc]) + '\n';
+	}
+
+	std::map<SSA::Instruction*, std::pair<unsigned long, unsigned long>> totals;
+	for (int pc = 0; pc < counts.size(); ++pc)
+	{
+		SSA::Instruction* i = codeGen.getOrigin(pc);
+		if (i && counts[pc])
+		{
+			totals[i].first += pcCycles[pc];
+			totals[i].second += counts[pc];
+		}
+	}
+	std::vector<std::pair<SSA::Instruction*, std::pair<unsigned long, unsigned long>>> hottest(
+			totals.begin(), totals.end());
+	std::sort(hottest.begin(), hottest.end(), [](const auto& x, const auto& y) {
+		return x.second.first > y.second.first;
+	});
+	if (hottest.size() > numHottest)
+	{
+		hottest.resize(numHottest);
+	}
+	s += "hottest instructions: cycles, DLX instructions\n";
+	for (auto hot : hottest)
+	{
+		SSA::Instruction* i = hot.first;
+		s += '\t' + std::to_string(hot.second.first) + ' ' + std::to_string(hot.second.second) + ' '
+				+ i->getParent()->getParent()->getName() + " {" + i->toStr() + "}\n";
+	}
+	return s;
+}
@@ -0,0 +1,60 @@
+/*
+ * Directory.cpp
+ * Author: Joshua Cao
+ */
+
+#include "Directory.h"
+#include <cerrno>
+#include <mutex>
+#include <unordered_set>
+#include <sys/stat.h>
+
+static std::unordered_set<std::string> created;
+static std::mutex createdMutex;
+
+// creates one directory, whose parent exists
+static bool makeDirectory(const std::string& path)
+{
+	if (mkdir(path.c_str(), 0777) == 0)
+	{
+		return true;
+	}
+	struct stat s;
+	return errno == EEXIST && stat(path.c_str(), &s) == 0 && S_ISDIR(s.st_mode);
+}
+
+bool makeDirectories(std::string path)
+{
+	while (path.size() > 1 && path.back() == '/')
+	{
+		path.pop_back();
+	}
+	if (path.empty())
+	{
+		return true;
+	}
+	std::lock_guard<std::mutex> lock(createdMutex);
+	if (created.count(path))
+	{
+		return true;
+	}
+	// parents first, skipping the ones already known
+	std::size_t end = path.find('/', 1);
+	while (true)
+	{
+		std::string prefix = path.substr(0, end);
+		if (!created.count(prefix))
+		{
+			if (!makeDirectory(prefix))
+			{
+				return false;
+			}
+			created.insert(prefix);
+		}
+		if (end == std::string::npos)
+		{
+			return true;
+		}
+		end = path.find('/', end + 1);
+	}
+}
@@ -0,0 +1,323 @@
+/*
+ * ELFWriter.cpp
+ * Author: Joshua Cao
+ */
+
+#include "ELFWriter.h"
+#include "AsyncWriter.h"
+#include "X86Gen.h"
+#include <cstring>
+#include <iostream>
+
+static const int ELF_HEADER_SIZE = 64;
+static const int PROGRAM_HEADER_SIZE = 56;
+static const int HEADERS_SIZE = ELF_HEADER_SIZE + 2 * PROGRAM_HEADER_SIZE;
+
+/*
+ * data segment: the output length and buffer, the input position, end and
+ * buffer, then the globals
+ */
+static const uint64_t OUT_STATE = ELF::DATA_ADDRESS;
+static const uint64_t IN_STATE = OUT_STATE + 8 + ELF::BUFFER_SIZE;
+static const uint64_t GLOBALS = IN_STATE + 8 + ELF::BUFFER_SIZE;
+
+static const int SYS_READ = 0;
+static const int SYS_WRITE = 1;
+static const int SYS_EXIT = 60;
+
+static const char* const INPUT_ERROR = "InputNum: expected a number\n";
+static const char* const DIVISION_ERROR = "division by zero\n";
+static const char* const BOUNDS_ERROR = "memory access out of bounds\n";
+
+static void put(std::vector<uint8_t>& bytes, uint64_t value, int size)
+{
+	for (int k = 0; k < size; ++k)
+	{
+		bytes.push_back(value >> (8 * k));
+	}
+}
+
+static void syscall(X86::Assembler& as, int number)
+{
+	as.emitMovImm(X86::RAX, number);
+	as.emitByte(0x0F);
+	as.emitByte(0x05);
+}
+
+static void call(X86::Assembler& as, int target)
+{
+	as.patch(as.emitJump({0xE8}), target);
+}
+
+static void cmpImm(X86::Assembler& as, int r, int32_t imm)
+{
+	as.emitRegOp({0x81}, 7, r);
+	as.emitImm32(imm);
+}
+
+static void addImm(X86::Assembler& as, int r, int32_t imm, bool w = false)
+{
+	as.emitRegOp({0x81}, 0, r, w);
+	as.emitImm32(imm);
+}
+
+// flushes the output buffer if fewer than 16 bytes are free, leaves r8 at OUT_STATE
+static void reserveOutput(X86::Assembler& as, int flush)
+{
+	as.emitMovImm64(X86::R8, OUT_STATE);
+	as.emitMemOp({0x81}, 7, X86::R8, -1, 0);
+	as.emitImm32(ELF::BUFFER_SIZE - 16);
+	int room = as.emitJump({0x0F, X86::JL});
+	call(as, flush);
+	as.patch(room, as.size());
+}
+
+// appends the byte c to the output buffer, r8 at OUT_STATE
+static void appendOutput(X86::Assembler& as, char c)
+{
+	as.emitMemOp({0x8B}, X86::RAX, X86::R8, -1, 0);
+	as.emitMemOp({0xC6}, 0, X86::R8, X86::RAX, 8);
+	as.emitByte(c);
+	addImm(as, X86::RAX, 1);
+	as.emitMemOp({0x89}, X86::RAX, X86::R8, -1, 0);
+}
+
+/*
+ * emits the builtins of X86Gen::Runtime, and _start, which calls entry,
+ * flushes the output and exits with 0
+ *
+ * the helpers only use registers a C call may clobber. inputNum reads like
+ * scanf("%d"), outputNum writes like printf("%d ")
+ */
+static int generateRuntime(X86::Assembler& as, uint64_t base, X86Gen::Runtime& runtime, int& entryCall)
+{
+	int inputError = as.size();
+	for (const char* c = INPUT_ERROR; *c; ++c)
+	{
+		as.emitByte(*c);
+	}
+	int divisionError = as.size();
+	for (const char* c = DIVISION_ERROR; *c; ++c)
+	{
+		as.emitByte(*c);
+	}
+	int boundsError = as.size();
+	for (const char* c = BOUNDS_ERROR; *c; ++c)
+	{
+		as.emitByte(*c);
+	}
+
+	// write(1, outBuffer, outLength)
+	int flush = as.size();
+	as.emitMovImm64(X86::R8, OUT_STATE);
+	as.emitMemOp({0x8B}, X86::RDX, X86::R8, -1, 0);
+	as.emitMemOp({0x8D}, X86::RSI, X86::R8, -1, 8, true);
+	as.emitMovImm(X86::RDI, 1);
+	syscall(as, SYS_WRITE);
+	as.emitMemOp({0xC7}, 0, X86::R8, -1, 0);
+	as.emitImm32(0);
+	as.emitByte(0xC3);
+
+	auto exitWithError = [&](int message, int length)
+	{
+		call(as, flush);
+		as.emitMovImm(X86::RDI, 2);
+		as.emitMovImm64(X86::RSI, base + message);
+		as.emitMovImm(X86::RDX, length);
+		syscall(as, SYS_WRITE);
+		as.emitMovImm(X86::RDI, 1);
+		syscall(as, SYS_EXIT);
+	};
+
+	// @return next input byte in eax or -1, leaves r8 at IN_STATE
+	int getc = as.size();
+	as.emitMovImm64(X86::R8, IN_STATE);
+	as.emitMemOp({0x8B}, X86::RAX, X86::R8, -1, 0);
+	as.emitMemOp({0x3B}, X86::RAX, X86::R8, -1, 4);
+	int buffered = as.emitJump({0x0F, X86::JL});
+	as.emitMovImm(X86::RDI, 0);
+	as.emitMemOp({0x8D}, X86::RSI, X86::R8, -1, 8, true);
+	as.emitMovImm(X86::RDX, ELF::BUFFER_SIZE);
+	syscall(as, SYS_READ);
+	as.emitRegOp({0x85}, X86::RAX, X86::RAX);
+	int eof = as.emitJump({0x0F, X86::JLE});
+	as.emitMemOp({0x89}, X86::RAX, X86::R8, -1, 4);
+	as.emitMovImm(X86::RAX, 0);
+	as.patch(buffered, as.size());
+	as.emitMemOp({0x0F, 0xB6}, X86::RCX, X86::R8, X86::RAX, 8);
+	addImm(as, X86::RAX, 1);
+	as.emitMemOp({0x89}, X86::RAX, X86::R8, -1, 0);
+	as.emitMov(X86::RAX, X86::RCX);
+	as.emitByte(0xC3);
+	as.patch(eof, as.size());
+	as.emitMovImm(X86::RAX, -1);
+	as.emitByte(0xC3);
+
+	// the sign is kept in r9 and the number in r10, which getc preserves
+	runtime.inputNum = base + as.size();
+	int skip = as.size();
+	call(as, getc);
+	cmpImm(as, X86::RAX, ' ');
+	as.patch(as.emitJump({0x0F, X86::JE}), skip);
+	as.emitMemOp({0x8D}, X86::RCX, X86::RAX, -1, -'\t');
+	cmpImm(as, X86::RCX, '\r' - '\t');
+	as.patch(as.emitJump({0x0F, X86::JBE}), skip);
+	as.emitMovImm(X86::R9, 0);
+	cmpImm(as, X86::RAX, '-');
+	int notMinus = as.emitJump({0x0F, X86::JNE});
+	as.emitMovImm(X86::R9, 1);
+	call(as, getc);
+	int afterSign = as.emitJump({0xE9});
+	as.patch(notMinus, as.size());
+	cmpImm(as, X86::RAX, '+');
+	int notPlus = as.emitJump({0x0F, X86::JNE});
+	call(as, getc);
+	as.patch(notPlus, as.size());
+	as.patch(afterSign, as.size());
+	as.emitMemOp({0x8D}, X86::RCX, X86::RAX, -1, -'0');
+	cmpImm(as, X86::RCX, 9);
+	int notNumber = as.emitJump({0x0F, X86::JA});
+	as.emitMovImm(X86::R10, 0);
+	int digit = as.size();
+	as.emitRegOp({0x69}, X86::R10, X86::R10);
+	as.emitImm32(10);
+	as.emitRegOp({0x01}, X86::RCX, X86::R10);
+	call(as, getc);
+	as.emitMemOp({0x8D}, X86::RCX, X86::RAX, -1, -'0');
+	cmpImm(as, X86::RCX, 9);
+	as.patch(as.emitJump({0x0F, X86::JBE}), digit);
+	// the byte after the number is read again by the next call
+	cmpImm(as, X86::RAX, -1);
+	int atEnd = as.emitJump({0x0F, X86::JE});
+	as.emitMemOp({0x81}, 5, X86::R8, -1, 0);
+	as.emitImm32(1);
+	as.patch(atEnd, as.size());
+	as.emitMov(X86::RAX, X86::R10);
+	as.emitRegOp({0x85}, X86::R9, X86::R9);
+	int positive = as.emitJump({0x0F, X86::JE});
+	as.emitRegOp({0xF7}, 3, X86::RAX);
+	as.patch(positive, as.size());
+	as.emitByte(0xC3);
+	as.patch(notNumber, as.size());
+	exitWithError(inputError, strlen(INPUT_ERROR));
+
+	// digits are written backwards below rsp, in the red zone
+	runtime.outputNum = base + as.size();
+	as.emitMov(X86::R9, X86::RDI);
+	reserveOutput(as, flush);
+	as.emitMov(X86::RAX, X86::R9);
+	as.emitRegOp({0x85}, X86::RAX, X86::RAX);
+	int notNegative = as.emitJump({0x0F, X86::JNS});
+	as.emitRegOp({0xF7}, 3, X86::RAX);
+	as.patch(notNegative, as.size());
+	as.emitRegOp({0x89}, X86::RSP, X86::RSI, true);
+	as.emitMovImm(X86::RCX, 10);
+	int divide = as.size();
+	as.emitMovImm(X86::RDX, 0);
+	as.emitRegOp({0xF7}, 6, X86::RCX);
+	addImm(as, X86::RDX, '0');
+	addImm(as, X86::RSI, -1, true);
+	as.emitMemOp({0x88}, X86::RDX, X86::RSI, -1, 0);
+	as.emitRegOp({0x85}, X86::RAX, X86::RAX);
+	as.patch(as.emitJump({0x0F, X86::JNE}), divide);
+	as.emitRegOp({0x85}, X86::R9, X86::R9);
+	int noSign = as.emitJump({0x0F, X86::JNS});
+	addImm(as, X86::RSI, -1, true);
+	as.emitMemOp({0xC6}, 0, X86::RSI, -1, 0);
+	as.emitByte('-');
+	as.patch(noSign, as.size());
+	as.emitMemOp({0x8B}, X86::RAX, X86::R8, -1, 0);
+	int copy = as.size();
+	as.emitRegOp({0x39}, X86::RSP, X86::RSI, true);
+	int copied = as.emitJump({0x0F, X86::JE});
+	as.emitMemOp({0x0F, 0xB6}, X86::RCX, X86::RSI, -1, 0);
+	as.emitMemOp({0x88}, X86::RCX, X86::R8, X86::RAX, 8);
+	addImm(as, X86::RAX, 1);
+	addImm(as, X86::RSI, 1, true);
+	as.patch(as.emitJump({0xE9}), copy);
+	as.patch(copied, as.size());
+	as.emitMemOp({0x89}, X86::RAX, X86::R8, -1, 0);
+	appendOutput(as, ' ');
+	as.emitByte(0xC3);
+
+	runtime.outputNewLine = base + as.size();
+	reserveOutput(as, flush);
+	appendOutput(as, '\n');
+	as.emitByte(0xC3);
+
+	runtime.divisionByZero = base + as.size();
+	exitWithError(divisionError, strlen(DIVISION_ERROR));
+
+	runtime.outOfBounds = base + as.size();
+	exitWithError(boundsError, strlen(BOUNDS_ERROR));
+
+	int start = as.size();
+	entryCall = as.emitJump({0xE8});
+	call(as, flush);
+	as.emitMovImm(X86::RDI, 0);
+	syscall(as, SYS_EXIT);
+	return start;
+}
+
+void ELF::writeExecutable(SSA::Module* ir, std::string fileName)
+{
+	X86Gen gen(ir);
+	X86::Assembler runtimeCode;
+	X86Gen::Runtime runtime;
+	runtime.globalReg = GLOBALS + gen.getGlobalSize();
+	int entryCall;
+	int start = generateRuntime(runtimeCode, TEXT_ADDRESS + HEADERS_SIZE, runtime, entryCall);
+	// the generated code follows the runtime, its entry is at offset 0
+	runtimeCode.patch(entryCall, runtimeCode.size());
+	gen.generate(runtime);
+
+	uint64_t textSize = HEADERS_SIZE + runtimeCode.size() + gen.getCode().size();
+	uint64_t dataSize = GLOBALS - DATA_ADDRESS + gen.getGlobalSize();
+	if (TEXT_ADDRESS + textSize > DATA_ADDRESS)
+	{
+		std::cerr << "program too large for an executable" << std::endl;
+		exit(1);
+	}
+
+	std::vector<uint8_t> image;
+	const uint8_t ident[] = {0x7F, 'E', 'L', 'F', 2, 1, 1, 0};
+	image.insert(image.end(), ident, ident + sizeof(ident));
+	put(image, 0, 8);
+	put(image, 2, 2); // ET_EXEC
+	put(image, 62, 2); // EM_X86_64
+	put(image, 1, 4);
+	put(image, TEXT_ADDRESS + HEADERS_SIZE + start, 8);
+	put(image, ELF_HEADER_SIZE, 8);
+	put(image, 0, 8);
+	put(image, 0, 4);
+	put(image, ELF_HEADER_SIZE, 2);
+	put(image, PROGRAM_HEADER_SIZE, 2);
+	put(image, 2, 2);
+	put(image, 64, 2);
+	put(image, 0, 2);
+	put(image, 0, 2);
+
+	// PT_LOAD segments: the whole file, read and execute, then the data
+	put(image, 1, 4);
+	put(image, 5, 4);
+	put(image, 0, 8);
+	put(image, TEXT_ADDRESS, 8);
+	put(image, TEXT_ADDRESS, 8);
+	put(image, textSize, 8);
+	put(image, textSize, 8);
+	put(image, 0x1000, 8);
+
+	put(image, 1, 4);
+	put(image, 6, 4);
+	put(image, 0, 8);
+	put(image, DATA_ADDRESS, 8);
+	put(image, DATA_ADDRESS, 8);
+	put(image, 0, 8);
+	put(image, dataSize, 8);
+	put(image, 0x1000, 8);
+
+	image.insert(image.end(), runtimeCode.getCode().begin(), runtimeCode.getCode().end());
+	image.insert(image.end(), gen.getCode().begin(), gen.getCode().end());
+
+	writeFileAsync(fileName, std::string(image.begin(), image.end()), true);
+}
@@ -0,0 +1,108 @@
+/*
+ * FunctionCache.cpp
+ * Author: Joshua Cao
+ */
+
+#include "FunctionCache.h"
+#include "BinaryIR.h"
+#include "SSAutils.h"
+#include <map>
+
+// name, return, number of parameters and summary of every function f calls,
+// by name
+static std::string calleeSignatures(SSA::Function* f)
+{
+	std::map<std::string, SSA::Function*> callees;
+	for (SSA::Function* callee : SSA::getCallees(f))
+	{
+		callees[callee->getName()] = callee;
+	}
+	std::string s;
+	for (auto pair : callees)
+	{
+		SSA::Function* callee = pair.second;
+		std::string signature = callee->isVoid() ? "void" : "value";
+		if (callee->isBuiltin())
+		{
+			signature += " builtin";
+		}
+		else
+		{
+			int params = 0;
+			for (SSA::Instruction* param : callee->getBBs().front()->getInstructions())
+			{
+				params += param->getOpcode() == SSA::pop;
+			}
+			signature += ' ' + std::to_string(params) + ' ' + callee->getSummary().toStr();
+		}
+		s += pair.first + ' ' + signature + '\n';
+	}
+	return s;
+}
+
+FunctionCache::FunctionCache(CompileCache& cache, const std::string& options, SSA::Module* ir,
+		const std::list<Parser::FunctionSource>& sources) : cache(cache)
+{
+	SSA::Function* main = ir->getFunction("main");
+	for (SSA::Instruction* i : main->getBBs().front()->getInstructions())
+	{
+		foreignIds[i] = foreign.size();
+		foreign.push_back(i);
+	}
+	// callees are declared first, so their keys are known. a caller's
+	// registers depend on the ones its callees write, so it changes with them
+	std::unordered_map<SSA::Function*, std::string> functionKeys;
+	for (const Parser::FunctionSource& source : sources)
+	{
+		std::string signature = source.tokens + '\0' + source.context + '\0' + calleeSignatures(source.function);
+		for (SSA::Function* callee : SSA::getCallees(source.function))
+		{
+			if (callee != source.function && functionKeys.find(callee) != functionKeys.cend())
+			{
+				signature += '\0' + functionKeys[callee];
+			}
+		}
+		functionKeys[source.function] = CompileCache::key(options + " function", signature);
+		if (source.cacheable)
+		{
+			keys.push_back({source.function, functionKeys[source.function]});
+		}
+	}
+}
+
+void FunctionCache::reuse()
+{
+	for (auto key : keys)
+	{
+		SSA::Function* f = key.first;
+		bool hit = cache.lookupData(key.second, [&](const char* data, std::size_t size)
+		{
+			return BinaryIR::deserializeFunction(data, size, f, foreign);
+		});
+		if (hit)
+		{
+			reused.insert(f);
+		}
+	}
+}
+
+bool FunctionCache::isReused(SSA::Function* f) const
+{
+	return reused.find(f) != reused.cend();
+}
+
+void FunctionCache::store()
+{
+	for (auto key : keys)
+	{
+		if (isReused(key.first))
+		{
+			continue;
+		}
+		std::string data = BinaryIR::serializeFunction(key.first, foreignIds);
+		if (!data.empty())
+		{
+			cache.storeData(key.second, data);
+		}
+	}
+}
@@ -0,0 +1,342 @@
+/*
+ * GVN.cpp
+ * Author: Joshua Cao
+ */
+
+#include "GVN.h"
+#include "SSAutils.h"
+
+GlobalValueNumbering::GlobalValueNumbering(SSA::Function* f) : f(f), domTree(f->getAnalyses().getDominatorTree())
+{
+}
+
+/*
+ * walk the dominator tree in preorder, so every instruction in scope
+ * dominates the block being visited
+ */
+void GlobalValueNumbering::visit(SSA::BasicBlock* b)
+{
+	valueStack.push_front(std::map<SSA::Opcode, std::list<SSA::Instruction*>>());
+
+	// stores on any path from the immediate dominator kill loads in scope
+	SSA::BasicBlock* idom = domTree->getIDom(b);
+	if (idom)
+	{
+		for (SSA::BasicBlock* between : getBlocksBetween(idom, b))
+		{
+			for (SSA::Instruction* i : between->getInstructions())
+			{
+				memoryKill(i);
+			}
+		}
+	}
+
+	for (SSA::Instruction* i : b->getInstructions())
+	{
+		rewriteOperands(i);
+		memoryKill(i);
+		if (isCandidate(i))
+		{
+			SSA::Instruction* leader = lookup(i);
+			if (leader != i)
+			{
+				leaders[i] = leader;
+				redundant.push_back(i);
+			}
+		}
+	}
+
+	for (SSA::BasicBlock* child : domTree->getChildren(b))
+	{
+		visit(child);
+	}
+
+	valueStack.pop_front();
+}
+
+bool GlobalValueNumbering::isCandidate(SSA::Instruction* i) const
+{
+	switch (i->getOpcode())
+	{
+	case SSA::add:
+	case SSA::sub:
+	case SSA::mul:
+	case SSA::div:
+	case SSA::cmp:
+	case SSA::adda:
+	case SSA::load:
+	case SSA::constant:
+		return true;
+	case SSA::call:
+	{
+		SSA::Operand* call = i->getOperand1();
+		if (!call || call->getType() != SSA::Operand::call)
+		{
+			return false;
+		}
+		SSA::Function* callee = call->getFunctionCall()->function;
+		return !callee->isBuiltin() && !callee->isVoid() && callee->getSummary().isReadOnly();
+	}
+	}
+	return false;
+}
+
+bool GlobalValueNumbering::isEqual(SSA::Instruction* x, SSA::Instruction* y) const
+{
+	if (x->equals(y))
+	{
+		return true;
+	}
+	// calls are equal if the callee and the arguments are
+	if (x->getOpcode() == SSA::call && y->getOpcode() == SSA::call)
+	{
+		SSA::Operand::FunctionCall* xCall = x->getOperand1()->getFunctionCall();
+		SSA::Operand::FunctionCall* yCall = y->getOperand1()->getFunctionCall();
+		if (xCall->function != yCall->function || xCall->args.size() != yCall->args.size())
+		{
+			return false;
+		}
+		auto yArg = yCall->args.cbegin();
+		for (SSA::Operand* xArg : xCall->args)
+		{
+			if (!xArg->equals(*yArg++))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+	if (x->getOpcode() == y->getOpcode()
+			&& (x->getOpcode() == SSA::add || x->getOpcode() == SSA::mul))
+	{
+		return x->getOperand1()->equals(y->getOperand2())
+				&& x->getOperand2()->equals(y->getOperand1());
+	}
+	return false;
+}
+
+SSA::Instruction* GlobalValueNumbering::lookup(SSA::Instruction* i)
+{
+	SSA::Opcode op = i->getOpcode();
+	for (std::map<SSA::Opcode, std::list<SSA::Instruction*>>& level : valueStack)
+	{
+		if (level.find(op) != level.cend())
+		{
+			for (SSA::Instruction* other : level[op])
+			{
+				if (isEqual(i, other))
+				{
+					return other;
+				}
+			}
+		}
+	}
+	valueStack.front()[op].push_back(i);
+	return i;
+}
+
+/*
+ * same rules as Parser::memoryKill for stores. a call only kills the loads
+ * of arrays its callee may store to, see FunctionSummary. stores and calls
+ * also kill calls to functions that may load what they write
+ */
+void GlobalValueNumbering::memoryKill(SSA::Instruction* i)
+{
+	const SSA::FunctionSummary* callee = nullptr;
+	bool killAll = false;
+	SSA::Operand* offset = nullptr;
+	if (i->getOpcode() == SSA::call)
+	{
+		SSA::Operand* call = i->getOperand1();
+		if (!call || call->getType() != SSA::Operand::call)
+		{
+			killAll = true;
+		}
+		else if (!call->getFunctionCall()->function->isBuiltin())
+		{
+			callee = &call->getFunctionCall()->function->getSummary();
+			if (callee->isReadOnly())
+			{
+				return;
+			}
+		}
+	}
+	else if (i->getOpcode() == SSA::store)
+	{
+		offset = SSA::getMemoryAccessOffset(i);
+		killAll = !offset || offset->getType() != SSA::Operand::constant;
+	}
+	if (!killAll && !offset && !callee)
+	{
+		return;
+	}
+
+	for (auto& level : valueStack)
+	{
+		if (level.find(SSA::call) != level.cend())
+		{
+			level[SSA::call].remove_if([&](SSA::Instruction* call)
+			{
+				const SSA::FunctionSummary& reader = call->getOperand1()->getFunctionCall()->function->getSummary();
+				if (callee)
+				{
+					return callee->mayClobber(reader);
+				}
+				return reader.mayRead(SSA::getAccessedArray(i));
+			});
+		}
+		if (level.find(SSA::load) == level.cend())
+		{
+			continue;
+		}
+		auto& loads = level[SSA::load];
+		auto iter = loads.begin();
+		while (iter != loads.end())
+		{
+			SSA::Operand* loadOffset = SSA::getMemoryAccessOffset(*iter);
+			bool killed;
+			if (callee)
+			{
+				killed = callee->mayWrite(SSA::getAccessedArray(*iter));
+			}
+			else
+			{
+				killed = killAll || !loadOffset || loadOffset->getType() != SSA::Operand::constant
+						|| offset->equals(loadOffset);
+			}
+			if (killed)
+			{
+				iter = loads.erase(iter);
+				continue;
+			}
+			++iter;
+		}
+	}
+}
+
+/*
+ * @return blocks that can run after leaving idom and before entering b,
+ * including b itself if it is in a loop
+ */
+std::unordered_set<SSA::BasicBlock*> GlobalValueNumbering::getBlocksBetween(
+		SSA::BasicBlock* idom, SSA::BasicBlock* b) const
+{
+	std::unordered_set<SSA::BasicBlock*> visited;
+	std::list<SSA::BasicBlock*> worklist = b->getPredecessors();
+	while (!worklist.empty())
+	{
+		SSA::BasicBlock* pred = worklist.front();
+		worklist.pop_front();
+		if (pred == idom || visited.find(pred) != visited.cend())
+		{
+			continue;
+		}
+		visited.insert(pred);
+		for (SSA::BasicBlock* p : pred->getPredecessors())
+		{
+			worklist.push_back(p);
+		}
+	}
+	return visited;
+}
+
+SSA::Instruction* GlobalValueNumbering::getLeader(SSA::Instruction* i) const
+{
+	while (leaders.find(i) != leaders.cend())
+	{
+		i = leaders.at(i);
+	}
+	return i;
+}
+
+void GlobalValueNumbering::rewriteOperands(SSA::Instruction* i)
+{
+	SSA::Module* m = f->getParent();
+	SSA::Operand* operands[2] = {i->getOperand1(), i->getOperand2()};
+	for (int n = 0; n < 2; ++n)
+	{
+		SSA::Operand* o = operands[n];
+		if (!o)
+		{
+			continue;
+		}
+		switch (o->getType())
+		{
+		case SSA::Operand::val:
+			if (leaders.find(o->getInstruction()) != leaders.cend())
+			{
+				SSA::Operand* leader = new SSA::ValOperand(getLeader(o->getInstruction()));
+				m->addOperand(leader);
+				if (n == 0)
+				{
+					i->setOperand1(leader);
+				}
+				else
+				{
+					i->setOperand2(leader);
+				}
+			}
+			break;
+		case SSA::Operand::call:
+		case SSA::Operand::phi:
+			for (SSA::Operand* arg : o->getArgs())
+			{
+				if (arg->getType() == SSA::Operand::val
+						&& leaders.find(arg->getInstruction()) != leaders.cend())
+				{
+					SSA::Operand* leader = new SSA::ValOperand(getLeader(arg->getInstruction()));
+					m->addOperand(leader);
+					o->replaceArg(arg, leader);
+				}
+			}
+			break;
+		}
+	}
+}
+
+int GlobalValueNumbering::run()
+{
+	if (!domTree->getEntry())
+	{
+		return 0;
+	}
+	visit(domTree->getEntry());
+	if (redundant.empty())
+	{
+		return 0;
+	}
+
+	// phis and other functions may still refer to eliminated instructions
+	for (SSA::Function* func : f->getParent()->getFuncs())
+	{
+		for (SSA::BasicBlock* b : func->getBBs())
+		{
+			for (SSA::Instruction* i : b->getInstructions())
+			{
+				rewriteOperands(i);
+			}
+		}
+	}
+	for (SSA::Instruction* i : redundant)
+	{
+		i->getParent()->remove(i);
+		delete i;
+	}
+	return redundant.size();
+}
+
+int globalValueNumbering(SSA::Function* f)
+{
+	GlobalValueNumbering gvn(f);
+	return gvn.run();
+}
+
+int globalValueNumbering(SSA::Module* ir)
+{
+	int eliminated = 0;
+	for (SSA::Function* f : ir->getFuncs())
+	{
+		eliminated += globalValueNumbering(f);
+	}
+	return eliminated;
+}
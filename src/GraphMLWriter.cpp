@@ -4,8 +4,124 @@
  */
 
 #include <GraphMLWriter.h>
+#include <AsyncWriter.h>
+#include <fnmatch.h>
+#include <list>
 
-std::ofstream GraphML::getFile(char const* subdir, char const* footer)
+static int dumpPoints = 0;
+static std::list<std::string> dumpFunctions;
+
+GraphML::Writer::Writer(std::string fileName) : fileName(fileName)
+{
+	buffer.reserve(1 << 16);
+}
+
+GraphML::Writer::~Writer()
+{
+	writeFileAsync(fileName, std::move(buffer));
+}
+
+GraphML::Writer& GraphML::Writer::operator<<(const char* s)
+{
+	buffer.append(s);
+	return *this;
+}
+
+GraphML::Writer& GraphML::Writer::operator<<(const std::string& s)
+{
+	buffer.append(s);
+	return *this;
+}
+
+GraphML::Writer& GraphML::Writer::operator<<(int i)
+{
+	char digits[16];
+	buffer.append(digits, snprintf(digits, sizeof(digits), "%d", i));
+	return *this;
+}
+
+// calls f with every non empty name in a comma separated list
+template<typename F>
+static void forEachName(const std::string& spec, F f)
+{
+	std::size_t start = 0;
+	while (start <= spec.size())
+	{
+		std::size_t end = spec.find(',', start);
+		if (end == std::string::npos)
+		{
+			end = spec.size();
+		}
+		if (end > start)
+		{
+			f(spec.substr(start, end - start));
+		}
+		start = end + 1;
+	}
+}
+
+bool GraphML::setDumpPoints(std::string spec)
+{
+	int points = 0;
+	bool valid = true;
+	forEachName(spec, [&](std::string name)
+	{
+		if (name == "ssa-first")
+		{
+			points |= DUMP_SSA_FIRST;
+		}
+		else if (name == "regalloc")
+		{
+			points |= DUMP_REGALLOC;
+		}
+		else if (name == "igraph")
+		{
+			points |= DUMP_IGRAPH;
+		}
+		else if (name == "all")
+		{
+			points |= DUMP_SSA_FIRST | DUMP_REGALLOC | DUMP_IGRAPH;
+		}
+		else
+		{
+			valid = false;
+		}
+	});
+	if (valid)
+	{
+		dumpPoints = points;
+	}
+	return valid;
+}
+
+void GraphML::setDumpFunctions(std::string spec)
+{
+	dumpFunctions.clear();
+	forEachName(spec, [](std::string pattern) { dumpFunctions.push_back(pattern); });
+}
+
+bool GraphML::isDumping(DumpPoint point)
+{
+	return dumpPoints & point;
+}
+
+bool GraphML::isDumpingFunction(const std::string& funcName)
+{
+	if (dumpFunctions.empty())
+	{
+		return true;
+	}
+	for (const std::string& pattern : dumpFunctions)
+	{
+		if (fnmatch(pattern.c_str(), funcName.c_str(), 0) == 0)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+std::string GraphML::getFileName(char const* subdir, char const* footer)
 {
 	std::string str = currFileName;
 	std::size_t testcaseDirIndex = str.find(TESTCASE_DIR) + TESTCASE_DIR.length();
@@ -14,134 +130,96 @@ std::ofstream GraphML::getFile(char const* subdir, char const* footer)
 	std::size_t fileIndex = str.find_last_of("/\\");
 	str.insert(fileIndex+1, std::string(subdir));
 
-	fileIndex = str.find_last_of("/\\");
-	system(("mkdir -p " + OUT_DIR + str.substr(0, fileIndex)).c_str());
-
 	std::size_t extensionIndex = str.find(".txt");
-	std::string fname = OUT_DIR + str.substr(0, extensionIndex) + footer + EXTENSION;
-
-	return std::ofstream(fname);
+	return OUT_DIR + str.substr(0, extensionIndex) + footer + EXTENSION;
 }
 
-void GraphML::writeSSAEdge(std::ofstream& f, std::map<SSA::BasicBlock*, std::string>& BBtoNodeId,
+void GraphML::writeSSAEdge(Writer& w, std::map<SSA::BasicBlock*, int>& BBtoNodeId, std::string& funcName,
 				SSA::BasicBlock* from, SSA::BasicBlock* to, int& edgeId)
 {
 	if (from && to)
 	{
-		std::string str = std::string(EDGE);
-		str.replace(str.find("{id}"), 4, "e" + std::to_string(edgeId));
-		str.replace(str.find("{from}"), 6, BBtoNodeId[from]);
-		str.replace(str.find("{to}"), 4, BBtoNodeId[to]);
+		w << EDGE[0] << "e" << edgeId << EDGE[1] << funcName << BBtoNodeId[from]
+				<< EDGE[2] << funcName << BBtoNodeId[to] << EDGE[3];
 		++edgeId;
-		f << str;
 	}
 }
 
-void GraphML::writeSSAFunc(std::ofstream& f, SSA::Function* func)
+void GraphML::writeSSAFunc(Writer& w, SSA::Function* func)
 {
 	std::string funcName = func->getName();
-	std::map<SSA::BasicBlock*, std::string> BBtoNodeId;
+	std::map<SSA::BasicBlock*, int> BBtoNodeId;
 	int bbId = 0;
-	std::string funcHeader = GRAPH_HEADER;
-	funcHeader.replace(funcHeader.find("{graph_id}"), 10, funcName);
-	funcHeader.replace(funcHeader.find("{graph_id}"), 10, funcName);
-	funcHeader.replace(funcHeader.find("{graph_type}"), 12, "directed");
-	f << funcHeader;
+	w << GRAPH_HEADER[0] << funcName << GRAPH_HEADER[1] << funcName << GRAPH_HEADER[2] << "directed"
+			<< GRAPH_HEADER[3];
 	std::list<SSA::BasicBlock*> BBs = func->getBBs();
 	for (SSA::BasicBlock* bb : BBs)
 	{
-		BBtoNodeId[bb] = funcName + std::to_string(bbId);
-		std::string bbHeader = std::string(NODE_HEADER);
-		bbHeader.replace(bbHeader.find("{node_id}"), 9, funcName + std::to_string(bbId));
-		f << bbHeader;
+		BBtoNodeId[bb] = bbId;
+		w << NODE_HEADER[0] << funcName << bbId << NODE_HEADER[1];
 		for (SSA::Instruction* instruction : bb->getInstructions())
 		{
-			f << std::endl << instruction->toStr();
+			w << "\n" << instruction->toStr();
 		}
 		++bbId;
-		f << NODE_FOOTER;
+		w << NODE_FOOTER;
 	}
 	int edgeId = 0;
 	for (SSA::BasicBlock* bb : BBs)
 	{
 		for (SSA::BasicBlock* succ : bb->getSuccessors())
 		{
-			writeSSAEdge(f, BBtoNodeId, bb, succ, edgeId);
-		}
+			writeSSAEdge(w, BBtoNodeId, funcName, bb, succ, edgeId);
 		}
-	f << GRAPH_FOOTER;
+	}
+	w << GRAPH_FOOTER;
 }
 
 void GraphML::SSAtoGraphML(SSA::Module* module, char const* subdir)
 {
-	std::ofstream f = getFile(subdir);
-	if (f)
+	Writer w(getFileName(subdir));
+	w << HEADER;
+	for (SSA::Function* func : module->getFuncs())
 	{
-		f << HEADER;
-		for (SSA::Function* func : module->getFuncs())
+		if (func->getName() != "InputNum"
+				&& func->getName() != "OutputNum"
+				&& func->getName() != "OutputNewLine"
+				&& isDumpingFunction(func->getName()))
 		{
-			if (func->getName() != "InputNum"
-					&& func->getName() != "OutputNum"
-					&& func->getName() != "OutputNewLine")
-			{
-				writeSSAFunc(f, func);
-			}
+			writeSSAFunc(w, func);
 		}
-		f << FOOTER;
-		f.close();
-	}
-	else
-	{
-		std::cout << ERR << std::endl;
 	}
+	w << FOOTER;
 }
 
-void GraphML::InterferenceGraphToGraphML(InterferenceGraph graph, char const* subdir, char const* footer)
+void GraphML::InterferenceGraphToGraphML(const InterferenceGraph& graph, char const* subdir, char const* footer)
 {
-	std::ofstream f = getFile(subdir, footer);
+	Writer w(getFileName(subdir, footer));
+	w << HEADER;
+	w << GRAPH_HEADER[0] << "{graph_id}" << GRAPH_HEADER[1] << "{graph_id}" << GRAPH_HEADER[2] << "undirected"
+			<< GRAPH_HEADER[3];
 
-	if (f)
-	{
-		f << HEADER;
-		std::string graphHeader = std::string(GRAPH_HEADER);
-		graphHeader.replace(graphHeader.find("{graph_type}"), 12, "undirected");
-		f << graphHeader;
-
-		std::list<InterferenceGraph::Node> nodes = graph.getNodes();
-		std::unordered_map<SSA::Instruction*, int> nodeIds;
-		int nodeId = 0;
+	std::list<InterferenceGraph::Node> nodes = graph.getNodes();
+	std::unordered_map<SSA::Instruction*, int> nodeIds;
+	int nodeId = 0;
 
-		for (InterferenceGraph::Node node : nodes)
-		{
-			std::string nodeStr = std::string(NODE_HEADER);
-			nodeStr.replace(nodeStr.find("{node_id}"), 9, std::to_string(nodeId));
-			f << nodeStr << node.instruction->toStr() << NODE_FOOTER;
+	for (InterferenceGraph::Node& node : nodes)
+	{
+		w << NODE_HEADER[0] << nodeId << NODE_HEADER[1] << node.instruction->toStr() << NODE_FOOTER;
 
-			nodeIds[node.instruction] = nodeId;
-			++nodeId;
-		}
+		nodeIds[node.instruction] = nodeId;
+		++nodeId;
+	}
 
-		int edgeId = 0;
-		for (InterferenceGraph::Node node : nodes)
+	int edgeId = 0;
+	for (InterferenceGraph::Node& node : nodes)
+	{
+		for (SSA::Instruction* i : node.edges)
 		{
-			for (SSA::Instruction* i : node.edges)
-			{
-				std::string edge = std::string(EDGE);
-				edge.replace(edge.find("{id}"), 4, std::to_string(edgeId));
-				edge.replace(edge.find("{from}"), 6, std::to_string(nodeIds[node.instruction]));
-				edge.replace(edge.find("{to}"), 4, std::to_string(nodeIds[i]));
-				f << edge;
-				++edgeId;
-			}
+			w << EDGE[0] << edgeId << EDGE[1] << nodeIds[node.instruction] << EDGE[2] << nodeIds[i] << EDGE[3];
+			++edgeId;
 		}
-
-		f << GRAPH_FOOTER << FOOTER;
-		f.close();
 	}
-	else
-	{
-		std::cout << ERR << std::endl;
-	}
-}
-
 
+	w << GRAPH_FOOTER << FOOTER;
+}
@@ -0,0 +1,441 @@
+/*
+ * Interpreter.cpp
+ * Author: Joshua Cao
+ */
+
+#include "Interpreter.h"
+#include "RegAllocStructs.h"
+#include "SSAutils.h"
+#include <iostream>
+
+static void addForeignReads(SSA::Function* f, SSA::Operand* o,
+		std::unordered_set<SSA::Instruction*>& foreignReads)
+{
+	if (!o)
+	{
+		return;
+	}
+	switch (o->getType())
+	{
+	case SSA::Operand::val:
+		if (o->getInstruction()->getParent()->getParent() != f)
+		{
+			foreignReads.insert(o->getInstruction());
+		}
+		break;
+	case SSA::Operand::phi:
+	case SSA::Operand::call:
+		for (SSA::Operand* arg : o->getArgs())
+		{
+			addForeignReads(f, arg, foreignReads);
+		}
+		break;
+	}
+}
+
+Interpreter::Interpreter(SSA::Module* ir, bool allocated, FILE* in, FILE* out)
+	: ir(ir), allocated(allocated), in(in), out(out), globalSize(0), halted(false),
+	  instructionCount(0), opcodeCounts(SSA::constant + 1, 0),
+	  spillLoadCount(0), spillStoreCount(0)
+{
+	for (SSA::Function* f : ir->getFuncs())
+	{
+		globalSize = std::max(globalSize, -f->getLocalVariableOffset());
+		for (SSA::BasicBlock* b : f->getBBs())
+		{
+			for (SSA::Instruction* i : b->getInstructions())
+			{
+				addForeignReads(f, i->getOperand1(), foreignReads);
+				addForeignReads(f, i->getOperand2(), foreignReads);
+			}
+		}
+	}
+	globals.assign(globalSize / 4, 0);
+}
+
+void Interpreter::run()
+{
+	SSA::Function* main = ir->getFunction("main");
+	if (!main)
+	{
+		std::cerr << "no main function" << std::endl;
+		exit(1);
+	}
+	call(main, std::list<int>());
+	fflush(out);
+}
+
+int Interpreter::call(SSA::Function* f, std::list<int> args)
+{
+	if (f->isBuiltin())
+	{
+		return callBuiltin(f, args);
+	}
+
+	Frame frame;
+	frame.f = f;
+	frame.regs.assign(NUM_REG, 0);
+	frame.slots.assign(f->getFrameSize() / 4, 0);
+	frame.args = args;
+
+	std::list<SSA::BasicBlock*> BBs = f->getBBs();
+	SSA::BasicBlock* prev = nullptr;
+	SSA::BasicBlock* b = BBs.empty() ? nullptr : BBs.front();
+	while (b)
+	{
+		std::list<SSA::Instruction*>& instructions = b->getInstructions();
+		++blockCounts[b];
+		if (prev)
+		{
+			++edgeCounts[prev][b];
+		}
+
+		// phis read their args in parallel on the edge from prev
+		if (!allocated && prev)
+		{
+			std::list<std::pair<SSA::Instruction*, int>> phis;
+			for (SSA::Instruction* i : instructions)
+			{
+				if (i->getOpcode() == SSA::phi && i->getOperand1())
+				{
+					SSA::Operand* arg = i->getOperand1()->getPhiArg(prev);
+					if (arg)
+					{
+						phis.push_back({i, getValue(frame, arg)});
+					}
+				}
+			}
+			for (auto phi : phis)
+			{
+				setValue(frame, phi.first, phi.second);
+			}
+		}
+
+		bool taken = false;
+		for (auto iter = instructions.begin(); iter != instructions.end(); ++iter)
+		{
+			SSA::Instruction* i = *iter;
+			SSA::Operand* x = i->getOperand1();
+			SSA::Operand* y = i->getOperand2();
+			if (i->getOpcode() != SSA::phi)
+			{
+				count(i);
+			}
+			switch (i->getOpcode())
+			{
+			case SSA::phi:
+				break;
+			case SSA::constant:
+				setValue(frame, i, x->getConst());
+				break;
+			case SSA::add:
+				setValue(frame, i, getValue(frame, x) + getValue(frame, y));
+				break;
+			case SSA::sub:
+				setValue(frame, i, getValue(frame, x) - getValue(frame, y));
+				break;
+			case SSA::mul:
+				setValue(frame, i, getValue(frame, x) * getValue(frame, y));
+				break;
+			case SSA::div:
+			{
+				int divisor = getValue(frame, y);
+				if (divisor == 0)
+				{
+					error(i, "division by zero");
+				}
+				setValue(frame, i, getValue(frame, x) / divisor);
+				break;
+			}
+			case SSA::cmp:
+			{
+				int a = getValue(frame, x);
+				int c = getValue(frame, y);
+				setValue(frame, i, (a > c) - (a < c));
+				break;
+			}
+			case SSA::adda:
+				setValue(frame, i, getValue(frame, x) + getValue(frame, y));
+				break;
+			case SSA::load:
+				setValue(frame, i, memory(frame, getValue(frame, x)));
+				break;
+			case SSA::store:
+				memory(frame, getValue(frame, x)) = getValue(frame, y);
+				break;
+			case SSA::move:
+			{
+				// consecutive moves are a parallel copy
+				std::list<std::pair<SSA::Instruction*, int>> moves;
+				moves.push_back({i, getValue(frame, x)});
+				auto next = std::next(iter);
+				while (next != instructions.end() && (*next)->getOpcode() == SSA::move)
+				{
+					iter = next++;
+					count(*iter);
+					moves.push_back({*iter, getValue(frame, (*iter)->getOperand1())});
+				}
+				for (auto move : moves)
+				{
+					setValue(frame, move.first, move.second);
+				}
+				break;
+			}
+			case SSA::bra:
+				taken = true;
+				break;
+			case SSA::bne:
+				taken = getValue(frame, x) != 0;
+				break;
+			case SSA::beq:
+				taken = getValue(frame, x) == 0;
+				break;
+			case SSA::ble:
+				taken = getValue(frame, x) <= 0;
+				break;
+			case SSA::blt:
+				taken = getValue(frame, x) < 0;
+				break;
+			case SSA::bge:
+				taken = getValue(frame, x) >= 0;
+				break;
+			case SSA::bgt:
+				taken = getValue(frame, x) > 0;
+				break;
+			case SSA::read:
+				setValue(frame, i, callBuiltin(ir->getFunction("InputNum"), std::list<int>()));
+				break;
+			case SSA::write:
+				callBuiltin(ir->getFunction("OutputNum"), std::list<int>(1, getValue(frame, x)));
+				break;
+			case SSA::writeNL:
+				callBuiltin(ir->getFunction("OutputNewLine"), std::list<int>());
+				break;
+			case SSA::call:
+			{
+				SSA::Operand::FunctionCall* functionCall = x->getFunctionCall();
+				std::list<int> callArgs;
+				for (SSA::Operand* arg : functionCall->args)
+				{
+					callArgs.push_back(getValue(frame, arg));
+				}
+				int ret = call(functionCall->function, callArgs);
+				if (halted)
+				{
+					return 0;
+				}
+				if (i->hasOutput())
+				{
+					setValue(frame, i, ret);
+				}
+				break;
+			}
+			case SSA::pop:
+				if (frame.args.empty())
+				{
+					error(i, "missing argument");
+				}
+				setValue(frame, i, frame.args.front());
+				frame.args.pop_front();
+				break;
+			case SSA::ret:
+				return x ? getValue(frame, x) : 0;
+			case SSA::end:
+				halted = true;
+				return 0;
+			}
+		}
+
+		// the branch target is the second successor
+		std::list<SSA::BasicBlock*> succs = b->getSuccessors();
+		prev = b;
+		if (succs.empty())
+		{
+			b = nullptr;
+		}
+		else if (taken && succs.size() > 1)
+		{
+			b = *std::next(succs.begin());
+		}
+		else
+		{
+			b = succs.front();
+		}
+	}
+	return 0;
+}
+
+int Interpreter::callBuiltin(SSA::Function* f, std::list<int> args)
+{
+	std::string name = f->getName();
+	if (name == "InputNum")
+	{
+		int num;
+		if (fscanf(in, "%d", &num) != 1)
+		{
+			std::cerr << "InputNum: expected a number" << std::endl;
+			exit(1);
+		}
+		return num;
+	}
+	if (name == "OutputNum")
+	{
+		fprintf(out, "%d ", args.empty() ? 0 : args.front());
+	}
+	else if (name == "OutputNewLine")
+	{
+		fprintf(out, "\n");
+	}
+	return 0;
+}
+
+int Interpreter::getValue(Frame& frame, SSA::Operand* o)
+{
+	switch (o->getType())
+	{
+	case SSA::Operand::constant:
+		return o->getConst();
+	case SSA::Operand::globalReg:
+		return globalSize;
+	case SSA::Operand::val:
+	{
+		SSA::Instruction* i = o->getInstruction();
+		if (i->getParent()->getParent() != frame.f)
+		{
+			if (i->getOpcode() == SSA::constant)
+			{
+				return i->getOperand1()->getConst();
+			}
+			return foreignValues[i];
+		}
+		if (!allocated)
+		{
+			return frame.values[i];
+		}
+		if (i->getReg() < 0 || i->getReg() >= NUM_REG)
+		{
+			error(i, "value has no register");
+		}
+		return frame.regs[i->getReg()];
+	}
+	}
+	std::cerr << "cannot evaluate operand " << o->toStr() << std::endl;
+	exit(1);
+}
+
+void Interpreter::setValue(Frame& frame, SSA::Instruction* i, int v)
+{
+	if (foreignReads.find(i) != foreignReads.cend())
+	{
+		foreignValues[i] = v;
+	}
+	if (!allocated)
+	{
+		frame.values[i] = v;
+	}
+	else if (i->getReg() >= 0 && i->getReg() < NUM_REG)
+	{
+		frame.regs[i->getReg()] = v;
+	}
+}
+
+int& Interpreter::memory(Frame& frame, int address)
+{
+	if (address % 4 != 0 || address < 0)
+	{
+		std::cerr << "invalid memory address " << address << std::endl;
+		exit(1);
+	}
+	if (address < globalSize)
+	{
+		return globals[address / 4];
+	}
+	int slot = (address - globalSize) / 4;
+	if (slot >= frame.slots.size())
+	{
+		std::cerr << "memory access out of bounds at " << address << std::endl;
+		exit(1);
+	}
+	return frame.slots[slot];
+}
+
+void Interpreter::count(SSA::Instruction* i)
+{
+	++instructionCount;
+	++opcodeCounts[i->getOpcode()];
+	if (i->getOpcode() == SSA::load || i->getOpcode() == SSA::store)
+	{
+		// spill slots are at constant non negative offsets, arrays at negative ones
+		SSA::Operand* offset = SSA::getMemoryAccessOffset(i);
+		if (offset && offset->getType() == SSA::Operand::constant && offset->getConst() >= 0)
+		{
+			if (i->getOpcode() == SSA::load)
+			{
+				++spillLoadCount;
+			}
+			else
+			{
+				++spillStoreCount;
+			}
+		}
+	}
+}
+
+void Interpreter::error(SSA::Instruction* i, std::string msg) const
+{
+	std::cerr << msg << " at {" << i->toStr() << "}" << std::endl;
+	exit(1);
+}
+
+unsigned long Interpreter::getInstructionCount() const
+{
+	return instructionCount;
+}
+
+unsigned long Interpreter::getOpcodeCount(SSA::Opcode op) const
+{
+	return opcodeCounts[op];
+}
+
+unsigned long Interpreter::getSpillLoadCount() const
+{
+	return spillLoadCount;
+}
+
+unsigned long Interpreter::getSpillStoreCount() const
+{
+	return spillStoreCount;
+}
+
+unsigned long Interpreter::getBlockCount(SSA::BasicBlock* b) const
+{
+	auto count = blockCounts.find(b);
+	return count == blockCounts.cend() ? 0 : count->second;
+}
+
+unsigned long Interpreter::getEdgeCount(SSA::BasicBlock* from, SSA::BasicBlock* to) const
+{
+	auto edges = edgeCounts.find(from);
+	if (edges == edgeCounts.cend())
+	{
+		return 0;
+	}
+	auto count = edges->second.find(to);
+	return count == edges->second.cend() ? 0 : count->second;
+}
+
+std::string Interpreter::statsToStr() const
+{
+	std::string s = "dynamic instructions: " + std::to_string(instructionCount) + '\n';
+	for (int op = 0; op < opcodeCounts.size(); ++op)
+	{
+		if (opcodeCounts[op])
+		{
+			s += '\t' + SSA::opToStr(SSA::Opcode(op)) + ": "
+					+ std::to_string(opcodeCounts[op]) + '\n';
+		}
+	}
+	s += "spill loads: " + std::to_string(spillLoadCount) + '\n';
+	s += "spill stores: " + std::to_string(spillStoreCount) + '\n';
+	return s;
+}
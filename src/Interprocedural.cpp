@@ -0,0 +1,230 @@
+/*
+ * Interprocedural.cpp
+ * Author: Joshua Cao
+ */
+
+#include "Interprocedural.h"
+#include "SSAutils.h"
+#include <unordered_map>
+
+// divisions by zero are runtime errors
+static bool isNonZero(SSA::Operand* o)
+{
+	if (o && o->getType() == SSA::Operand::val && o->getInstruction()->getOpcode() == SSA::constant)
+	{
+		o = o->getInstruction()->getOperand1();
+	}
+	return o && o->getType() == SSA::Operand::constant && o->getConst() != 0;
+}
+
+// whether f has no loops and no divisions that may fail, ignoring its callees
+static bool alwaysReturns(SSA::Function* f)
+{
+	for (SSA::BasicBlock* b : f->getBBs())
+	{
+		for (SSA::Instruction* i : b->getInstructions())
+		{
+			if (i->getOpcode() == SSA::div && !isNonZero(i->getOperand2()))
+			{
+				return false;
+			}
+		}
+	}
+	return f->getBBs().empty() || f->getAnalyses().getLoopForest()->getLoops().empty();
+}
+
+// effects of f given the current summaries of its callees
+static SSA::FunctionSummary summarize(SSA::Function* f, bool returns)
+{
+	SSA::FunctionSummary s;
+	s.readsAnywhere = false;
+	s.writesAnywhere = false;
+	s.io = false;
+	s.speculatable = returns;
+	for (SSA::BasicBlock* b : f->getBBs())
+	{
+		for (SSA::Instruction* i : b->getInstructions())
+		{
+			switch (i->getOpcode())
+			{
+			case SSA::load:
+			case SSA::store:
+			{
+				int array = SSA::getAccessedArray(i);
+				bool load = i->getOpcode() == SSA::load;
+				if (array)
+				{
+					(load ? s.readArrays : s.writtenArrays).insert(array);
+				}
+				else
+				{
+					(load ? s.readsAnywhere : s.writesAnywhere) = true;
+				}
+				break;
+			}
+			case SSA::read:
+			case SSA::write:
+			case SSA::writeNL:
+				s.io = true;
+				break;
+			case SSA::call:
+			{
+				SSA::Function* callee = SSA::getCallee(i);
+				if (!callee)
+				{
+					s.readsAnywhere = s.writesAnywhere = s.io = true;
+					s.speculatable = false;
+					break;
+				}
+				const SSA::FunctionSummary& c = callee->getSummary();
+				s.readArrays.insert(c.readArrays.cbegin(), c.readArrays.cend());
+				s.readsAnywhere |= c.readsAnywhere;
+				s.writtenArrays.insert(c.writtenArrays.cbegin(), c.writtenArrays.cend());
+				s.writesAnywhere |= c.writesAnywhere;
+				s.io |= c.io;
+				s.speculatable &= c.speculatable;
+				break;
+			}
+			}
+		}
+	}
+	s.speculatable &= s.isPure();
+	return s;
+}
+
+void summarizeFunctions(SSA::Module* ir)
+{
+	std::unordered_map<SSA::Function*, bool> returns;
+	for (SSA::Function* f : ir->getFuncs())
+	{
+		SSA::FunctionSummary s;
+		s.readsAnywhere = false;
+		s.writesAnywhere = false;
+		s.speculatable = false;
+		// the builtins only do I/O
+		s.io = f->isBuiltin();
+		f->setSummary(s);
+		if (!f->isBuiltin())
+		{
+			returns[f] = alwaysReturns(f);
+		}
+	}
+
+	// effects only grow, so this stops after at most a few passes per call graph level
+	bool changed = true;
+	while (changed)
+	{
+		changed = false;
+		for (SSA::Function* f : ir->getFuncs())
+		{
+			if (f->isBuiltin())
+			{
+				continue;
+			}
+			SSA::FunctionSummary s = summarize(f, returns[f]);
+			if (!(s == f->getSummary()))
+			{
+				f->setSummary(s);
+				changed = true;
+			}
+		}
+	}
+}
+
+static bool isHoistable(SSA::Instruction* i, SSA::LoopForest::Loop* loop)
+{
+	SSA::Function* callee = SSA::getCallee(i);
+	if (!callee || callee->isBuiltin() || !callee->getSummary().speculatable)
+	{
+		return false;
+	}
+	for (SSA::Instruction* arg : SSA::getValues(i))
+	{
+		if (loop->contains(arg->getParent()))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// @return the only block outside of loop that enters it, if it has no other successor
+static SSA::BasicBlock* getPreheader(SSA::LoopForest::Loop* loop)
+{
+	SSA::BasicBlock* preheader = nullptr;
+	for (SSA::BasicBlock* pred : loop->header->getPredecessors())
+	{
+		if (!loop->contains(pred))
+		{
+			if (preheader)
+			{
+				return nullptr;
+			}
+			preheader = pred;
+		}
+	}
+	if (!preheader || preheader->getSuccessors().size() != 1)
+	{
+		return nullptr;
+	}
+	return preheader;
+}
+
+int hoistInvariantCalls(SSA::Function* f)
+{
+	std::list<SSA::LoopForest::Loop*> loops = f->getAnalyses().getLoopForest()->getLoops();
+	loops.sort([](SSA::LoopForest::Loop* x, SSA::LoopForest::Loop* y) { return x->depth > y->depth; });
+	int hoisted = 0;
+	for (SSA::LoopForest::Loop* loop : loops)
+	{
+		SSA::BasicBlock* preheader = getPreheader(loop);
+		if (!preheader)
+		{
+			continue;
+		}
+		// a call may use the result of one hoisted after it
+		bool changed = true;
+		while (changed)
+		{
+			changed = false;
+			for (SSA::BasicBlock* b : f->getBBs())
+			{
+				if (!loop->contains(b))
+				{
+					continue;
+				}
+				std::list<SSA::Instruction*> instructions = b->getInstructions();
+				for (SSA::Instruction* i : instructions)
+				{
+					if (!isHoistable(i, loop))
+					{
+						continue;
+					}
+					b->remove(i);
+					std::list<SSA::Instruction*>& preheaderInstructions = preheader->getInstructions();
+					if (!preheaderInstructions.empty() && SSA::isBranch(preheaderInstructions.back()->getOpcode()))
+					{
+						preheader->emitBefore(i, preheaderInstructions.back());
+					}
+					else
+					{
+						preheader->emit(i);
+					}
+					++hoisted;
+					changed = true;
+				}
+			}
+		}
+	}
+	return hoisted;
+}
+
+int hoistInvariantCalls(SSA::Module* ir)
+{
+	int hoisted = 0;
+	for (SSA::Function* f : ir->getFuncs())
+	{
+		hoisted += hoistInvariantCalls(f);
+	}
+	return hoisted;
+}
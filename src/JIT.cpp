@@ -0,0 +1,101 @@
+/*
+ * JIT.cpp
+ * Author: Joshua Cao
+ */
+
+#include "JIT.h"
+#include "X86Gen.h"
+#include <cstring>
+#include <iostream>
+#include <sys/mman.h>
+
+static FILE* jitIn = stdin;
+static FILE* jitOut = stdout;
+
+static int inputNum()
+{
+	int num;
+	if (fscanf(jitIn, "%d", &num) != 1)
+	{
+		std::cerr << "InputNum: expected a number" << std::endl;
+		exit(1);
+	}
+	return num;
+}
+
+static void outputNum(int num)
+{
+	fprintf(jitOut, "%d ", num);
+}
+
+static void outputNewLine()
+{
+	fprintf(jitOut, "\n");
+}
+
+static void divisionByZero()
+{
+	fflush(jitOut);
+	std::cerr << "division by zero" << std::endl;
+	exit(1);
+}
+
+static void outOfBounds()
+{
+	fflush(jitOut);
+	std::cerr << "memory access out of bounds" << std::endl;
+	exit(1);
+}
+
+JIT::JIT(SSA::Module* ir) : buffer(nullptr), bufferSize(0)
+{
+	X86Gen gen(ir);
+	globals.assign(gen.getGlobalSize() / 4, 0);
+	X86Gen::Runtime runtime;
+	runtime.globalReg = reinterpret_cast<uint64_t>(globals.data()) + gen.getGlobalSize();
+	runtime.inputNum = reinterpret_cast<uint64_t>(inputNum);
+	runtime.outputNum = reinterpret_cast<uint64_t>(outputNum);
+	runtime.outputNewLine = reinterpret_cast<uint64_t>(outputNewLine);
+	runtime.divisionByZero = reinterpret_cast<uint64_t>(divisionByZero);
+	runtime.outOfBounds = reinterpret_cast<uint64_t>(outOfBounds);
+	gen.generate(runtime);
+	codeSize = gen.getCode().size();
+
+	long pageSize = 4096;
+	bufferSize = (codeSize + pageSize - 1) / pageSize * pageSize;
+	void* mem = mmap(nullptr, bufferSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (mem == MAP_FAILED)
+	{
+		std::cerr << "cannot allocate executable memory" << std::endl;
+		exit(1);
+	}
+	buffer = static_cast<uint8_t*>(mem);
+	memcpy(buffer, gen.getCode().data(), codeSize);
+	if (mprotect(buffer, bufferSize, PROT_READ | PROT_EXEC) != 0)
+	{
+		std::cerr << "cannot make JIT code executable" << std::endl;
+		exit(1);
+	}
+}
+
+JIT::~JIT()
+{
+	if (buffer)
+	{
+		munmap(buffer, bufferSize);
+	}
+}
+
+void JIT::run(FILE* in, FILE* out)
+{
+	jitIn = in;
+	jitOut = out;
+	std::fill(globals.begin(), globals.end(), 0);
+	reinterpret_cast<void (*)()>(buffer)();
+	fflush(out);
+}
+
+std::size_t JIT::getCodeSize() const
+{
+	return codeSize;
+}
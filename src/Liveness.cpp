@@ -0,0 +1,315 @@
+/*
+ * Liveness.cpp
+ * Author: Joshua Cao
+ */
+
+#include "Liveness.h"
+#include <deque>
+#include <set>
+#include <unordered_set>
+
+void BitVector::set(int i)
+{
+	words[i / 64] |= uint64_t(1) << (i % 64);
+}
+
+void BitVector::reset(int i)
+{
+	words[i / 64] &= ~(uint64_t(1) << (i % 64));
+}
+
+bool BitVector::test(int i) const
+{
+	return words[i / 64] & (uint64_t(1) << (i % 64));
+}
+
+bool BitVector::unionWith(const BitVector& other)
+{
+	bool changed = false;
+	for (int i = 0; i < words.size(); ++i)
+	{
+		uint64_t word = words[i] | other.words[i];
+		changed |= word != words[i];
+		words[i] = word;
+	}
+	return changed;
+}
+
+void BitVector::subtract(const BitVector& other)
+{
+	for (int i = 0; i < words.size(); ++i)
+	{
+		words[i] &= ~other.words[i];
+	}
+}
+
+bool BitVector::operator==(const BitVector& other) const
+{
+	return words == other.words;
+}
+
+std::vector<int> BitVector::toIndices() const
+{
+	std::vector<int> indices;
+	for (int i = 0; i < words.size(); ++i)
+	{
+		uint64_t word = words[i];
+		while (word)
+		{
+			indices.push_back(i * 64 + __builtin_ctzll(word));
+			word &= word - 1;
+		}
+	}
+	return indices;
+}
+
+int BitVector::count() const
+{
+	int n = 0;
+	for (uint64_t word : words)
+	{
+		n += __builtin_popcountll(word);
+	}
+	return n;
+}
+
+void Liveness::addValue(SSA::Instruction* i)
+{
+	if (i && valueIds.find(i) == valueIds.cend())
+	{
+		valueIds[i] = values.size();
+		values.push_back(i);
+	}
+}
+
+void Liveness::addValues(SSA::Operand* o)
+{
+	if (!o)
+	{
+		return;
+	}
+	switch (o->getType())
+	{
+	case SSA::Operand::val:
+		addValue(o->getInstruction());
+		break;
+	case SSA::Operand::phi:
+	case SSA::Operand::call:
+		for (SSA::Operand* arg : o->getArgs())
+		{
+			addValues(arg);
+		}
+		break;
+	}
+}
+
+Liveness::Liveness(SSA::Function* f) : f(f)
+{
+	std::list<SSA::BasicBlock*> BBs = f->getBBs();
+
+	// number every value defined or used in the function. operands may refer
+	// to instructions in other functions, which are then live on entry
+	for (SSA::BasicBlock* b : BBs)
+	{
+		for (SSA::Instruction* i : b->getInstructions())
+		{
+			if (i->hasOutput())
+			{
+				addValue(i);
+			}
+		}
+	}
+	for (SSA::BasicBlock* b : BBs)
+	{
+		for (SSA::Instruction* i : b->getInstructions())
+		{
+			addValues(i->getOperand1());
+			addValues(i->getOperand2());
+		}
+	}
+
+	// local sets
+	int numValues = values.size();
+	std::unordered_map<SSA::BasicBlock*, BitVector> uses;
+	std::unordered_map<SSA::BasicBlock*, BitVector> defs;
+	std::unordered_map<SSA::BasicBlock*, BitVector> phiUses;
+	for (SSA::BasicBlock* b : BBs)
+	{
+		uses[b] = BitVector(numValues);
+		defs[b] = BitVector(numValues);
+		phiUses[b] = BitVector(numValues);
+		liveIn[b] = BitVector(numValues);
+		liveOut[b] = BitVector(numValues);
+	}
+	for (SSA::BasicBlock* b : BBs)
+	{
+		std::list<SSA::Instruction*>& instructions = b->getInstructions();
+		for (auto iter = instructions.rbegin(); iter != instructions.rend(); ++iter)
+		{
+			SSA::Instruction* i = *iter;
+			if (i->hasOutput())
+			{
+				defs[b].set(valueIds[i]);
+				uses[b].reset(valueIds[i]);
+			}
+			if (i->getOpcode() == SSA::phi)
+			{
+				for (auto arg : i->getOperand1()->getPhiArgs())
+				{
+					if (phiUses.find(arg.first) != phiUses.cend())
+					{
+						addUses(phiUses[arg.first], arg.second);
+					}
+				}
+			}
+			else
+			{
+				addUses(uses[b], i->getOperand1());
+				addUses(uses[b], i->getOperand2());
+			}
+		}
+	}
+
+	// backwards problem, so start from the end of the reverse post order
+	std::deque<SSA::BasicBlock*> worklist;
+	std::unordered_set<SSA::BasicBlock*> inWorklist;
+	std::vector<SSA::BasicBlock*> order = f->getAnalyses().getDominatorTree()->getReversePostOrder();
+	for (auto iter = order.rbegin(); iter != order.rend(); ++iter)
+	{
+		worklist.push_back(*iter);
+		inWorklist.insert(*iter);
+	}
+	for (SSA::BasicBlock* b : BBs)
+	{
+		if (inWorklist.find(b) == inWorklist.cend())
+		{
+			worklist.push_back(b);
+			inWorklist.insert(b);
+		}
+	}
+
+	while (!worklist.empty())
+	{
+		SSA::BasicBlock* b = worklist.front();
+		worklist.pop_front();
+		inWorklist.erase(b);
+
+		BitVector out = phiUses[b];
+		for (SSA::BasicBlock* succ : b->getSuccessors())
+		{
+			if (liveIn.find(succ) != liveIn.cend())
+			{
+				out.unionWith(liveIn[succ]);
+			}
+		}
+		liveOut[b] = out;
+		out.subtract(defs[b]);
+		out.unionWith(uses[b]);
+		if (!(out == liveIn[b]))
+		{
+			liveIn[b] = out;
+			for (SSA::BasicBlock* pred : b->getPredecessors())
+			{
+				if (liveIn.find(pred) != liveIn.cend() && inWorklist.find(pred) == inWorklist.cend())
+				{
+					worklist.push_back(pred);
+					inWorklist.insert(pred);
+				}
+			}
+		}
+	}
+}
+
+void Liveness::addUses(BitVector& live, SSA::Operand* o) const
+{
+	if (!o)
+	{
+		return;
+	}
+	switch (o->getType())
+	{
+	case SSA::Operand::val:
+		if (valueIds.find(o->getInstruction()) != valueIds.cend())
+		{
+			live.set(valueIds.at(o->getInstruction()));
+		}
+		break;
+	case SSA::Operand::phi:
+	case SSA::Operand::call:
+		for (SSA::Operand* arg : o->getArgs())
+		{
+			addUses(live, arg);
+		}
+		break;
+	}
+}
+
+int Liveness::getNumValues() const
+{
+	return values.size();
+}
+
+int Liveness::getValueId(SSA::Instruction* i) const
+{
+	if (valueIds.find(i) == valueIds.cend())
+	{
+		return -1;
+	}
+	return valueIds.at(i);
+}
+
+SSA::Instruction* Liveness::getValue(int id) const
+{
+	return values[id];
+}
+
+const BitVector& Liveness::getLiveIn(SSA::BasicBlock* b) const
+{
+	return liveIn.at(b);
+}
+
+const BitVector& Liveness::getLiveOut(SSA::BasicBlock* b) const
+{
+	return liveOut.at(b);
+}
+
+std::unordered_map<SSA::Instruction*, std::vector<int>> getRegsLiveAcrossCalls(SSA::Function* f,
+		const ClobberSets& clobbers)
+{
+	std::unordered_map<SSA::Instruction*, std::vector<int>> regs;
+	Liveness liveness(f);
+	for (SSA::BasicBlock* b : f->getBBs())
+	{
+		BitVector live = liveness.getLiveOut(b);
+		std::list<SSA::Instruction*>& instructions = b->getInstructions();
+		for (auto iter = instructions.rbegin(); iter != instructions.rend(); ++iter)
+		{
+			SSA::Instruction* i = *iter;
+			if (i->hasOutput())
+			{
+				live.reset(liveness.getValueId(i));
+			}
+			if (i->getOpcode() == SSA::call)
+			{
+				auto clobbered = clobbers.find(i->getOperand1()->getFunctionCall()->function);
+				std::set<int> callRegs;
+				for (int id : live.toIndices())
+				{
+					SSA::Instruction* value = liveness.getValue(id);
+					if (value->getParent()->getParent() == f && value->getReg() >= 0
+							&& (clobbered == clobbers.cend() || clobbered->second.count(value->getReg())))
+					{
+						callRegs.insert(value->getReg());
+					}
+				}
+				regs[i] = std::vector<int>(callRegs.begin(), callRegs.end());
+			}
+			if (i->getOpcode() != SSA::phi)
+			{
+				liveness.addUses(live, i->getOperand1());
+				liveness.addUses(live, i->getOperand2());
+			}
+		}
+	}
+	return regs;
+}
@@ -0,0 +1,653 @@
+/*
+ * LoopUnroll.cpp
+ * Author: Joshua Cao
+ */
+
+#include "LoopUnroll.h"
+#include "SSAutils.h"
+#include <algorithm>
+#include <climits>
+
+typedef std::map<SSA::Instruction*, SSA::Operand*> ValueMap;
+
+static bool getConstValue(SSA::Operand* o, int& c)
+{
+	if (!o)
+	{
+		return false;
+	}
+	if (o->getType() == SSA::Operand::constant)
+	{
+		c = o->getConst();
+		return true;
+	}
+	if (o->getType() == SSA::Operand::val)
+	{
+		SSA::Instruction* i = o->getInstruction();
+		if (i && i->getOpcode() == SSA::constant)
+		{
+			c = i->getOperand1()->getConst();
+			return true;
+		}
+	}
+	return false;
+}
+
+static bool isInvariant(SSA::Operand* o, CountedLoop& loop);
+
+static bool isInvariant(SSA::Instruction* i, CountedLoop& loop)
+{
+	if (i->getParent() == loop.body)
+	{
+		return false;
+	}
+	if (i->getParent() != loop.header)
+	{
+		return true;
+	}
+	switch (i->getOpcode())
+	{
+	case SSA::add:
+	case SSA::sub:
+	case SSA::mul:
+	case SSA::div:
+	case SSA::adda:
+	case SSA::constant:
+		return isInvariant(i->getOperand1(), loop) && isInvariant(i->getOperand2(), loop);
+	}
+	return false;
+}
+
+static bool isInvariant(SSA::Operand* o, CountedLoop& loop)
+{
+	if (!o)
+	{
+		return true;
+	}
+	switch (o->getType())
+	{
+	case SSA::Operand::constant:
+	case SSA::Operand::globalReg:
+		return true;
+	case SSA::Operand::val:
+		return isInvariant(o->getInstruction(), loop);
+	}
+	return false;
+}
+
+static SSA::Opcode swapBranch(SSA::Opcode op)
+{
+	switch (op)
+	{
+	case SSA::bge: return SSA::ble;
+	case SSA::bgt: return SSA::blt;
+	case SSA::ble: return SSA::bge;
+	case SSA::blt: return SSA::bgt;
+	}
+	return op;
+}
+
+static int computeTripCount(CountedLoop& loop)
+{
+	int init, bound;
+	SSA::Operand* initOp = loop.iv->getOperand1()->getPhiArg(loop.preheader);
+	if (!getConstValue(initOp, init) || !getConstValue(loop.bound, bound))
+	{
+		return -1;
+	}
+	int step = loop.step > 0 ? loop.step : -loop.step;
+	switch (loop.exitOp)
+	{
+	case SSA::bge:
+		return init >= bound ? 0 : (bound - init + step - 1) / step;
+	case SSA::bgt:
+		return init > bound ? 0 : (bound - init) / step + 1;
+	case SSA::ble:
+		return init <= bound ? 0 : (init - bound + step - 1) / step;
+	case SSA::blt:
+		return init < bound ? 0 : (init - bound) / step + 1;
+	}
+	return -1;
+}
+
+bool matchCountedLoop(SSA::BasicBlock* header, CountedLoop& loop)
+{
+	if (!header->getParent()->getAnalyses().getLoopForest()->isLoopHeader(header))
+	{
+		return false;
+	}
+	std::list<SSA::BasicBlock*> preds = header->getPredecessors();
+	std::list<SSA::BasicBlock*> succs = header->getSuccessors();
+	if (preds.size() != 2 || succs.size() != 2)
+	{
+		return false;
+	}
+	loop.header = header;
+	loop.preheader = preds.front();
+	loop.body = preds.back();
+	loop.exit = succs.back();
+
+	// only unroll innermost loops with straight line bodies
+	if (succs.front() != loop.body || loop.body->getPredecessors().size() != 1
+			|| loop.body->getSuccessors().size() != 1)
+	{
+		return false;
+	}
+	for (SSA::Instruction* i : loop.body->getInstructions())
+	{
+		if (i->getOpcode() == SSA::phi || i->getOpcode() == SSA::ret)
+		{
+			return false;
+		}
+	}
+	for (SSA::Instruction* i : loop.exit->getInstructions())
+	{
+		if (i->getOpcode() == SSA::phi)
+		{
+			return false;
+		}
+	}
+
+	// header must end in cmp and branch
+	std::list<SSA::Instruction*>& headerIns = header->getInstructions();
+	if (headerIns.empty())
+	{
+		return false;
+	}
+	loop.branch = headerIns.back();
+	switch (loop.branch->getOpcode())
+	{
+	case SSA::bge:
+	case SSA::bgt:
+	case SSA::ble:
+	case SSA::blt:
+		break;
+	default:
+		return false;
+	}
+	SSA::Operand* cond = loop.branch->getOperand1();
+	if (!cond || cond->getType() != SSA::Operand::val
+			|| cond->getInstruction()->getOpcode() != SSA::cmp
+			|| cond->getInstruction()->getParent() != header)
+	{
+		return false;
+	}
+	loop.cmp = cond->getInstruction();
+
+	// find the induction variable among the cmp operands
+	SSA::Operand* x = loop.cmp->getOperand1();
+	SSA::Operand* y = loop.cmp->getOperand2();
+	loop.iv = nullptr;
+	if (x->getType() == SSA::Operand::val && x->getInstruction()->getOpcode() == SSA::phi
+			&& x->getInstruction()->getParent() == header)
+	{
+		loop.iv = x->getInstruction();
+		loop.bound = y;
+		loop.ivLeft = true;
+		loop.exitOp = loop.branch->getOpcode();
+	}
+	else if (y->getType() == SSA::Operand::val && y->getInstruction()->getOpcode() == SSA::phi
+			&& y->getInstruction()->getParent() == header)
+	{
+		loop.iv = y->getInstruction();
+		loop.bound = x;
+		loop.ivLeft = false;
+		loop.exitOp = swapBranch(loop.branch->getOpcode());
+	}
+	if (!loop.iv || !isInvariant(loop.bound, loop))
+	{
+		return false;
+	}
+
+	// everything else in the header must be loop invariant so that it can be
+	// shared by every copy of the body and by the remainder loop
+	for (SSA::Instruction* i : headerIns)
+	{
+		if (i->getOpcode() != SSA::phi && i != loop.cmp && i != loop.branch
+				&& !isInvariant(i, loop))
+		{
+			return false;
+		}
+	}
+
+	// induction variable must be incremented by a constant exactly once in the body
+	SSA::Operand* next = loop.iv->getOperand1()->getPhiArg(loop.body);
+	if (!next || next->getType() != SSA::Operand::val
+			|| next->getInstruction()->getParent() != loop.body)
+	{
+		return false;
+	}
+	SSA::Instruction* inc = next->getInstruction();
+	SSA::Operand* incX = inc->getOperand1();
+	SSA::Operand* incY = inc->getOperand2();
+	bool xIsIv = incX->getType() == SSA::Operand::val && incX->getInstruction() == loop.iv;
+	bool yIsIv = incY->getType() == SSA::Operand::val && incY->getInstruction() == loop.iv;
+	if (inc->getOpcode() == SSA::add && xIsIv && incY->getType() == SSA::Operand::constant)
+	{
+		loop.step = incY->getConst();
+	}
+	else if (inc->getOpcode() == SSA::add && yIsIv && incX->getType() == SSA::Operand::constant)
+	{
+		loop.step = incX->getConst();
+	}
+	else if (inc->getOpcode() == SSA::sub && xIsIv && incY->getType() == SSA::Operand::constant)
+	{
+		loop.step = -incY->getConst();
+	}
+	else
+	{
+		return false;
+	}
+
+	// iv must move towards the bound
+	if (!((loop.step > 0 && (loop.exitOp == SSA::bge || loop.exitOp == SSA::bgt))
+			|| (loop.step < 0 && (loop.exitOp == SSA::ble || loop.exitOp == SSA::blt))))
+	{
+		return false;
+	}
+
+	loop.tripCount = computeTripCount(loop);
+	return true;
+}
+
+static SSA::Operand* remapOperand(SSA::Operand* o, ValueMap& values, SSA::Module* m)
+{
+	if (!o)
+	{
+		return nullptr;
+	}
+	switch (o->getType())
+	{
+	case SSA::Operand::val:
+		if (values.find(o->getInstruction()) != values.cend())
+		{
+			return values[o->getInstruction()];
+		}
+		break;
+	case SSA::Operand::call:
+	{
+		std::list<SSA::Operand*> args;
+		for (SSA::Operand* arg : o->getArgs())
+		{
+			args.push_back(remapOperand(arg, values, m));
+		}
+		SSA::Operand* call = new SSA::CallOperand(o->getFunctionCall()->function, args);
+		m->addOperand(call);
+		return call;
+	}
+	}
+	return o;
+}
+
+/*
+ * append a copy of instructions to b, where operands are renamed using values.
+ * values is updated with the copies so that later instructions use them
+ */
+static void cloneInstructions(std::list<SSA::Instruction*>& instructions,
+		SSA::BasicBlock* b, ValueMap& values)
+{
+	SSA::Module* m = b->getParent()->getParent();
+	for (SSA::Instruction* i : instructions)
+	{
+		SSA::Instruction* copy = new SSA::Instruction(i->getOpcode(),
+				remapOperand(i->getOperand1(), values, m),
+				remapOperand(i->getOperand2(), values, m));
+		b->emit(copy);
+		values[i] = new SSA::ValOperand(copy);
+		m->addOperand(values[i]);
+	}
+}
+
+static std::list<SSA::Instruction*> getPhis(SSA::BasicBlock* b)
+{
+	std::list<SSA::Instruction*> phis;
+	for (SSA::Instruction* i : b->getInstructions())
+	{
+		if (i->getOpcode() == SSA::phi)
+		{
+			phis.push_back(i);
+		}
+	}
+	return phis;
+}
+
+// estimates profile counts after unrolling, with remainders evenly spread
+static void updateCounts(CountedLoop& loop, int factor, SSA::BasicBlock* entry, SSA::BasicBlock* remHeader,
+		SSA::BasicBlock* remBody)
+{
+	long iterations = loop.body->getCount();
+	long entries = loop.header->getCount() - iterations;
+	if (iterations < 0 || entries < 0)
+	{
+		return;
+	}
+	long remainder = remBody ? std::min(iterations, entries * (factor - 1) / 2) : 0;
+	long unrolled = (iterations - remainder) / factor;
+	loop.header->setCount(entries + unrolled);
+	loop.header->setEdgeCount(loop.body, unrolled);
+	loop.body->setCount(unrolled);
+	loop.body->setEdgeCount(loop.header, unrolled);
+	if (!remBody)
+	{
+		return;
+	}
+	entry->setCount(entries);
+	entry->setEdgeCount(remHeader, entries);
+	remHeader->setCount(entries + remainder);
+	remHeader->setEdgeCount(remBody, remainder);
+	remHeader->setEdgeCount(loop.exit, entries);
+	remBody->setCount(remainder);
+	remBody->setEdgeCount(remHeader, remainder);
+}
+
+/*
+ * the unrolled loop runs while the last copy's induction variable,
+ * iv + (factor-1)*step, passes the original condition. that sum overflows
+ * for bounds near the ends of int, so the guard compares iv against
+ * bound - shift instead, with bgt and blt turned into bge and ble
+ */
+struct Guard
+{
+	SSA::Opcode exitOp;
+	long shift;
+	// the guard bound if bound is a constant
+	bool constant;
+	int value;
+};
+
+// @return false if the guard bound cannot be computed without overflow
+static bool getGuard(CountedLoop& loop, int factor, Guard& guard)
+{
+	guard.exitOp = loop.exitOp;
+	guard.shift = long(factor - 1) * loop.step;
+	if (loop.exitOp == SSA::bgt)
+	{
+		guard.exitOp = SSA::bge;
+		guard.shift -= 1;
+	}
+	else if (loop.exitOp == SSA::blt)
+	{
+		guard.exitOp = SSA::ble;
+		guard.shift += 1;
+	}
+	if (guard.shift < INT_MIN || guard.shift > INT_MAX)
+	{
+		return false;
+	}
+	int bound;
+	guard.constant = getConstValue(loop.bound, bound);
+	if (guard.constant)
+	{
+		long value = bound - guard.shift;
+		guard.value = value;
+		return value >= INT_MIN && value <= INT_MAX;
+	}
+	// otherwise it is checked for overflow at the end of the preheader, see buildGuardBound
+	std::list<SSA::Instruction*>& instructions = loop.preheader->getInstructions();
+	return loop.preheader->getSuccessors().size() == 1
+			&& (instructions.empty() || !SSA::isBranch(instructions.back()->getOpcode()));
+}
+
+/*
+ * a runtime bound is checked once before the loop. if bound - shift would
+ * overflow, no iv passes the guard, so the unrolled loop is skipped:
+ *
+ * preheader: header invariants; cmp bound limit; branch to skip
+ * enter:     t = bound - shift
+ * header:    phis; cmp iv t; branch to entry
+ * skip:      empty, so that phi moves for the remainder stay off the
+ *            preheader -> enter edge
+ * @param skip set to the block to connect to the remainder loop, or nullptr
+ */
+static SSA::Operand* buildGuardBound(CountedLoop& loop, const Guard& guard, SSA::BasicBlock*& skip)
+{
+	skip = nullptr;
+	if (guard.constant)
+	{
+		return new SSA::ConstOperand(guard.value);
+	}
+	if (guard.shift == 0)
+	{
+		return loop.bound;
+	}
+	SSA::BasicBlock* preheader = loop.preheader;
+	SSA::Function* f = preheader->getParent();
+	SSA::Module* m = f->getParent();
+	// the remainder loop can now be entered without passing the header, so
+	// the invariants it shares with the header move before the loop
+	std::list<SSA::Instruction*> headerIns = loop.header->getInstructions();
+	for (SSA::Instruction* i : headerIns)
+	{
+		if (i->getOpcode() != SSA::phi && i != loop.cmp && i != loop.branch)
+		{
+			loop.header->remove(i);
+			preheader->emit(i);
+		}
+	}
+
+	bool up = loop.step > 0;
+	SSA::Instruction* check = new SSA::Instruction(SSA::cmp, loop.bound,
+			new SSA::ConstOperand(up ? INT_MIN + guard.shift : INT_MAX + guard.shift));
+	preheader->emit(check);
+	SSA::Operand* checkVal = new SSA::ValOperand(check);
+	m->addOperand(checkVal);
+	preheader->emit(new SSA::Instruction(up ? SSA::blt : SSA::bgt, checkVal));
+
+	SSA::BasicBlock* enter = new SSA::BasicBlock();
+	skip = new SSA::BasicBlock();
+	f->emitAfter(enter, preheader);
+	preheader->replaceSuccessor(loop.header, enter);
+	preheader->addSuccessor(skip);
+	enter->addPredecessor(preheader);
+	enter->addSuccessor(loop.header);
+	skip->addPredecessor(preheader);
+	loop.header->replacePredecessor(preheader, enter);
+	for (SSA::Instruction* phi : getPhis(loop.header))
+	{
+		phi->getOperand1()->replacePhiBlock(preheader, enter);
+	}
+
+	// with a profile, the bound is assumed to be safe
+	long entries = preheader->getCount() >= 0 ? preheader->getEdgeCount(enter) : -1;
+	if (entries >= 0)
+	{
+		preheader->setEdgeCount(skip, 0);
+		enter->setCount(entries);
+		enter->setEdgeCount(loop.header, entries);
+		skip->setCount(0);
+	}
+	loop.preheader = enter;
+
+	SSA::Instruction* guardBound = new SSA::Instruction(SSA::sub, loop.bound, new SSA::ConstOperand(guard.shift));
+	enter->emit(guardBound);
+	SSA::Operand* guardVal = new SSA::ValOperand(guardBound);
+	m->addOperand(guardVal);
+	return guardVal;
+}
+
+/*
+ * unroll the loop by factor. each iteration of the unrolled loop runs factor
+ * copies of the body back to back, guarded by checking that the last copy
+ * would still have passed the original condition. remaining iterations run
+ * in a copy of the original loop placed after it:
+ *
+ * header:    phis; cmp iv bound-(factor-1)*step; branch to entry
+ * body:      body copy 1 ... body copy factor
+ * entry:     empty, so that phi moves for the remainder do not land on the
+ *            header -> body edge
+ * remainder: phis; cmp iv' bound; branch to exit
+ * remBody:   body copy
+ *
+ * if the trip count is a known multiple of factor, the remainder is skipped
+ */
+bool unrollLoop(SSA::BasicBlock* header, int factor)
+{
+	CountedLoop loop;
+	if (factor < 2 || !matchCountedLoop(header, loop))
+	{
+		return false;
+	}
+	if (loop.tripCount != -1 && loop.tripCount < factor)
+	{
+		return false;
+	}
+	// with a profile, skip loops averaging fewer than factor iterations
+	long iterations = loop.body->getCount();
+	long entries = header->getCount() - iterations;
+	if (iterations >= 0 && header->getCount() >= 0 && (iterations == 0 || iterations < factor * entries))
+	{
+		return false;
+	}
+	bool needsRemainder = loop.tripCount == -1 || loop.tripCount % factor != 0;
+	Guard guard;
+	if (needsRemainder && !getGuard(loop, factor, guard))
+	{
+		return false;
+	}
+
+	SSA::Function* f = header->getParent();
+	SSA::Module* m = f->getParent();
+	std::list<SSA::Instruction*> bodyIns = loop.body->getInstructions();
+	std::list<SSA::Instruction*> phis = getPhis(header);
+
+	// latch values of the original loop, before they are overwritten
+	std::map<SSA::Instruction*, SSA::Operand*> latch;
+	for (SSA::Instruction* phi : phis)
+	{
+		latch[phi] = phi->getOperand1()->getPhiArg(loop.body);
+	}
+
+	// the original body acts as the first copy
+	ValueMap values;
+	for (int k = 1; k < factor; ++k)
+	{
+		ValueMap next;
+		for (SSA::Instruction* phi : phis)
+		{
+			next[phi] = remapOperand(latch[phi], values, m);
+		}
+		values = next;
+		cloneInstructions(bodyIns, loop.body, values);
+	}
+	for (SSA::Instruction* phi : phis)
+	{
+		SSA::Operand* arg = remapOperand(latch[phi], values, m);
+		phi->getOperand1()->addPhiArg(loop.body, arg);
+	}
+
+	if (!needsRemainder)
+	{
+		updateCounts(loop, factor, nullptr, nullptr, nullptr);
+		return true;
+	}
+
+	// guard the unrolled loop on the last copy's induction variable
+	SSA::BasicBlock* skip;
+	SSA::Operand* guardBound = buildGuardBound(loop, guard, skip);
+	SSA::Operand* guardIv = new SSA::ValOperand(loop.iv);
+	m->addOperand(guardIv);
+	loop.cmp->setOperand1(guardIv);
+	loop.cmp->setOperand2(guardBound);
+	loop.branch->setOpcode(guard.exitOp);
+
+	SSA::BasicBlock* entry = new SSA::BasicBlock();
+	SSA::BasicBlock* remHeader = new SSA::BasicBlock(true);
+	SSA::BasicBlock* remBody = new SSA::BasicBlock();
+	f->emitAfter(entry, loop.body);
+	f->emitAfter(remHeader, entry);
+	f->emitAfter(remBody, remHeader);
+
+	header->replaceSuccessor(loop.exit, entry);
+	entry->addPredecessor(header);
+	entry->addSuccessor(remHeader);
+	remHeader->addPredecessor(entry);
+	remHeader->addSuccessor(remBody);
+	remBody->addPredecessor(remHeader);
+	remBody->addSuccessor(remHeader);
+	remHeader->addPredecessor(remBody);
+	remHeader->addSuccessor(loop.exit);
+	loop.exit->replacePredecessor(header, remHeader);
+
+	// remainder loop, with the unrolled loop's phis as initial values
+	ValueMap remValues;
+	std::map<SSA::Instruction*, SSA::Instruction*> remPhis;
+	for (SSA::Instruction* phi : phis)
+	{
+		SSA::Operand* init = new SSA::ValOperand(phi);
+		m->addOperand(init);
+		SSA::Instruction* remPhi = new SSA::Instruction(SSA::phi,
+				new SSA::PhiOperand(phi->getOperand1()->getVarName(), entry, init));
+		remHeader->emit(remPhi);
+		remPhis[phi] = remPhi;
+		remValues[phi] = new SSA::ValOperand(remPhi);
+		m->addOperand(remValues[phi]);
+	}
+	cloneInstructions(bodyIns, remBody, remValues);
+	for (SSA::Instruction* phi : phis)
+	{
+		SSA::Operand* arg = remapOperand(latch[phi], remValues, m);
+		m->addOperand(arg);
+		remPhis[phi]->getOperand1()->addPhiArg(remBody, arg);
+	}
+	if (skip)
+	{
+		f->emitAfter(skip, remBody);
+		skip->addSuccessor(remHeader);
+		remHeader->addPredecessor(skip);
+		if (skip->getCount() >= 0)
+		{
+			skip->setEdgeCount(remHeader, 0);
+		}
+		for (SSA::Instruction* phi : phis)
+		{
+			remPhis[phi]->getOperand1()->addPhiArg(skip, phi->getOperand1()->getPhiArg(loop.preheader));
+		}
+	}
+	SSA::Operand* remIv = remValues[loop.iv];
+	SSA::Instruction* remCmp = new SSA::Instruction(SSA::cmp, remIv, loop.bound);
+	remHeader->emit(remCmp);
+	remHeader->emit(new SSA::Instruction(loop.exitOp, new SSA::ValOperand(remCmp)));
+
+	// uses after the loop now see the values leaving the remainder loop
+	for (SSA::BasicBlock* b : f->getBBs())
+	{
+		if (b == header || b == loop.body || b == entry || b == remHeader || b == remBody)
+		{
+			continue;
+		}
+		for (SSA::Instruction* i : b->getInstructions())
+		{
+			for (SSA::Instruction* phi : phis)
+			{
+				SSA::ValOperand* oldVal = new SSA::ValOperand(phi);
+				if (i->containsArg(oldVal))
+				{
+					i->replaceArg(oldVal, remValues[phi]);
+				}
+				else
+				{
+					delete oldVal;
+				}
+			}
+		}
+	}
+
+	updateCounts(loop, factor, entry, remHeader, remBody);
+	return true;
+}
+
+void unrollLoops(SSA::Function* f, int factor)
+{
+	for (SSA::BasicBlock* b : f->getBBs())
+	{
+		unrollLoop(b, factor);
+	}
+}
+
+void unrollLoops(SSA::Module* ir, int factor)
+{
+	for (SSA::Function* f : ir->getFuncs())
+	{
+		unrollLoops(f, factor);
+	}
+}
@@ -4,10 +4,11 @@
  */
 
 #include "Parser.h"
+#include "SSAutils.h"
 
 Parser::Parser(char const *s) :
 		scan(s), module(new SSA::Module()), func(nullptr), currBB(nullptr), joinBB(
-				nullptr)
+				nullptr), cseLoopDepth(0), mainEntry(nullptr)
 {
 	scan.next();
 	pushVarMap();
@@ -22,6 +23,7 @@ SSA::Module* Parser::parse()
 	mustParse(LexAnalysis::main);
 	currBB = new SSA::BasicBlock();
 	emitBB(currBB);
+	mainEntry = currBB;
 	declarationList();
 	functionBody();
 	mustParse(LexAnalysis::period);
@@ -42,6 +44,7 @@ Parser::Array::Array(Parser *parser, std::vector<int> dims) :
 	totalOffset -= length * INT_SIZE;
 	offset = totalOffset;
 	parser->func->setLocalVariableOffset(totalOffset);
+	parser->module->addArray(offset, length * INT_SIZE);
 }
 
 Parser::Array& Parser::Array::operator=(const Array other)
@@ -56,6 +59,11 @@ void Parser::Array::resetTotalOffset()
 	totalOffset = 0;
 }
 
+int Parser::Array::getTotalOffset()
+{
+	return totalOffset;
+}
+
 int Parser::Array::getOffset()
 {
 	return offset;
@@ -66,13 +74,89 @@ std::vector<int> Parser::Array::getDims() const
 	return dims;
 }
 
+const std::list<Parser::FunctionSource>& Parser::getFunctionSources() const
+{
+	return functionSources;
+}
+
+/*
+ * everything a function sees before its first token: the values of visible
+ * variables, the arrays, and the offset its own arrays start at
+ */
+std::string Parser::describeContext()
+{
+	std::string context;
+	for (const std::unordered_map<std::string, SSA::Operand*>& map : varMapStack)
+	{
+		std::map<std::string, SSA::Operand*> sorted(map.cbegin(), map.cend());
+		for (auto var : sorted)
+		{
+			context += var.first + '=' + describeValue(var.second) + ' ';
+		}
+		context += '\n';
+	}
+	std::map<std::string, Array> arrays(arrayMap.cbegin(), arrayMap.cend());
+	for (auto array : arrays)
+	{
+		context += array.first + '@' + std::to_string(array.second.getOffset());
+		for (int dim : array.second.getDims())
+		{
+			context += '[' + std::to_string(dim) + ']';
+		}
+		context += ' ';
+	}
+	return context + "\narrays from " + std::to_string(Array::getTotalOffset());
+}
+
+/*
+ * constants by value and instructions of main's first block by position,
+ * which are the same in every parse of the same declarations. anything
+ * else is "?", and a function using it cannot be cached
+ */
+std::string Parser::describeValue(SSA::Operand* value)
+{
+	if (!value)
+	{
+		return "undefined";
+	}
+	if (value->getType() == SSA::Operand::constant)
+	{
+		return std::to_string(value->getConst());
+	}
+	if (value->getType() == SSA::Operand::val)
+	{
+		std::size_t position = 0;
+		for (SSA::Instruction* i : mainEntry->getInstructions())
+		{
+			if (i == value->getInstruction())
+			{
+				return '#' + std::to_string(position);
+			}
+			++position;
+		}
+	}
+	return "?";
+}
+
 // TODO: store function somewhere, still not sure how to handle functions
 void Parser::function()
 {
+	FunctionSource source;
+	source.context = describeContext();
+	std::size_t numSources = functionSources.size();
+	scan.startRecording();
 	mustParse(LexAnalysis::func);
 	SSA::Function* oldFunc = func;
 	SSA::BasicBlock* oldCurrBB = currBB;
 	func = new SSA::Function(module, scan.id);
+	// instructions of one function cannot be reused by another, in either direction
+	std::list<std::map<SSA::Opcode, std::list<SSA::Instruction*>>> oldCSEstack;
+	oldCSEstack.swap(cseStack);
+	std::size_t oldCSELoopDepth = cseLoopDepth;
+	cseLoopDepth = 0;
+	pushCSEmap();
+	// parameters and locals shadow globals only inside the function
+	pushVarMap();
 	emitFunc();
 	mustParse(LexAnalysis::id_tk);
 	currBB = new SSA::BasicBlock();
@@ -100,9 +184,16 @@ void Parser::function()
 	mustParse(LexAnalysis::semicolon);
 	declarationList();
 	functionBody();
+	cseStack.swap(oldCSEstack);
+	cseLoopDepth = oldCSELoopDepth;
+	popVarMap();
 	currBB = oldCurrBB;
+	source.function = func;
 	func = oldFunc;
 	mustParse(LexAnalysis::semicolon);
+	source.tokens = scan.stopRecording();
+	source.cacheable = functionSources.size() == numSources;
+	functionSources.push_back(source);
 }
 
 void Parser::declarationList()
@@ -240,6 +331,9 @@ void Parser::whileLoop()
 	joinBB = currBB;
 	SSA::BasicBlock *oldJoin = joinBB;
 	pushUseChain();
+	std::size_t oldCSELoopDepth = cseLoopDepth;
+	cseLoopDepth = cseStack.size();
+	pushCSEmap();
 	conditional();
 
 	mustParse(LexAnalysis::do_tk);
@@ -258,6 +352,8 @@ void Parser::whileLoop()
 
 	commitPhis(joinBB, true);
 	popUseChain();
+	popCSEmap();
+	cseLoopDepth = oldCSELoopDepth;
 	currBB = new SSA::BasicBlock();
 	emitBB(currBB);
 	linkBB(joinBB, currBB);
@@ -353,14 +449,8 @@ void Parser::conditional()
 	}
 
 	SSA::Operand *y = expression();
+	// not CSEd, every conditional needs its own branch
 	SSA::Instruction *ins = new SSA::Instruction(SSA::cmp, x, y);
-	SSA::Instruction *cse = cseCheck(ins);
-	if (cse != ins)
-	{
-		return;
-	}
-	ins = cse;
-
 	currBB->emit(ins);
 	currBB->emit(new SSA::Instruction(op, new SSA::ValOperand(ins)));
 
@@ -418,6 +508,7 @@ SSA::Operand* Parser::callStatement()
 
 	SSA::CallOperand *callOp = new SSA::CallOperand(f, args);
 	SSA::Instruction *ins = new SSA::Instruction(SSA::call, callOp);
+	memoryKill(ins);
 
 	if (!useChain.empty())
 	{
@@ -769,7 +860,6 @@ void Parser::popUseChain()
 
 /*
  * assumes use chain stack is not empty
- * TODO: I think we should only be updating the front of the use chain, create a testcase for this
  */
 void Parser::insertIntoUseChain(SSA::Operand *operand, SSA::Instruction *ins)
 {
@@ -860,7 +950,7 @@ void Parser::commitPhis(SSA::BasicBlock *b, bool loop)
 		if (ins->getOpcode() == SSA::phi)
 		{
 			SSA::Operand *phiOp = ins->getOperand1();
-			std::map<SSA::BasicBlock*, SSA::Operand*> phiArgs =
+			std::map<SSA::BasicBlock*, SSA::Operand*, SSA::BlockOrder> phiArgs =
 					phiOp->getPhiArgs();
 			std::string varName = phiOp->getVarName();
 			SSA::Operand *prevValue = getVarValue(varName, false);
@@ -877,23 +967,18 @@ void Parser::commitPhis(SSA::BasicBlock *b, bool loop)
 			SSA::ValOperand *newOperand = new SSA::ValOperand(ins);
 
 			// propagate phi values
+			// only into uses in this loop, the front of the use chain, since outer
+			// levels also hold uses that come before this loop
 			if (loop && !useChain.empty())
 			{
-				for (std::unordered_map<SSA::Operand*,
-						std::list<SSA::Instruction*>> useChainLevel : useChain)
+				std::unordered_map<SSA::Operand*, std::list<SSA::Instruction*>>::iterator uses =
+						useChain.front().find(prevValue);
+				if (uses != useChain.front().end())
 				{
-					for (std::pair<SSA::Operand*, std::list<SSA::Instruction*>> usePair : useChainLevel)
+					for (SSA::Instruction *i : uses->second)
 					{
-						if (prevValue == usePair.first)
-						{
-							for (SSA::Instruction *i : usePair.second)
-							{
-								replaceOldOperandWithPhi(prevValue, newOperand,
-										i, true);
-								replaceOldOperandWithPhi(prevValue, newOperand,
-										i, false);
-							}
-						}
+						replaceOldOperandWithPhi(prevValue, newOperand, i, true);
+						replaceOldOperandWithPhi(prevValue, newOperand, i, false);
 					}
 				}
 			}
@@ -920,46 +1005,18 @@ void Parser::popCSEmap()
 	cseStack.pop_front();
 }
 
-SSA::Operand* Parser::getMemoryAccessOffset(SSA::Instruction* store) const
-{
-	if (store && (store->getOpcode() == SSA::store
-			|| store->getOpcode() == SSA::load))
-	{
-		SSA::Operand* memOp = store->getOperand1();
-		if (memOp->getType() == SSA::Operand::globalReg)
-		{
-			memOp = store->getOperand2();
-		}
-		if (memOp && memOp->getType() == SSA::Operand::val)
-		{
-			SSA::Instruction* adda = memOp->getInstruction();
-			if (adda && adda->getOpcode() == SSA::adda)
-			{
-				SSA::Operand* op1 = adda->getOperand1();
-				SSA::Operand* op2 = adda->getOperand2();
-				SSA::Operand* nonGlobal = nullptr;
-				if (op1->getType() == SSA::Operand::globalReg)
-				{
-					nonGlobal = op2;
-				}
-				else if (op2->getType() == SSA::Operand::globalReg)
-				{
-					nonGlobal = op1;
-				}
-				return nonGlobal;
-			}
-		}
-	}
-	return nullptr;
-}
-
 SSA::Instruction* Parser::cseCheck(SSA::Instruction *ins)
 {
 	SSA::Opcode op = ins->getOpcode();
 
-	// check if same Instruction already exists
-	for (std::map<SSA::Opcode, std::list<SSA::Instruction*>> map : cseStack)
+	// check if same Instruction already exists, within the innermost loop
+	std::size_t levels = cseStack.size() - cseLoopDepth;
+	for (std::map<SSA::Opcode, std::list<SSA::Instruction*>>& map : cseStack)
 	{
+		if (levels-- == 0)
+		{
+			break;
+		}
 		if (map.find(op) != map.cend())
 		{
 			for (SSA::Instruction *cseIns : map[op])
@@ -990,12 +1047,21 @@ SSA::Instruction* Parser::cseCheck(SSA::Instruction *ins)
  * if store offset is a constant, kill all unknown loads and load w same offset constant
  * if store offset is unknown, kill all loads
  *    - if we did array bound checking, we can just kill loads for that array
+ * calls to non builtin functions may store anywhere, so they kill all loads.
+ * GVN narrows this down with the summaries of the callees
  */
 void Parser::memoryKill(SSA::Instruction* i)
 {
-	if (i && i->getOpcode() == SSA::store)
+	if (i && i->getOpcode() == SSA::call && !i->getOperand1()->getFunctionCall()->function->isBuiltin())
+	{
+		for (auto& cseLevel : cseStack)
+		{
+			cseLevel.erase(SSA::load);
+		}
+	}
+	else if (i && i->getOpcode() == SSA::store)
 	{
-		SSA::Operand* offset = getMemoryAccessOffset(i);
+		SSA::Operand* offset = SSA::getMemoryAccessOffset(i);
 		if (offset)
 		{
 			for (auto& cseLevel : cseStack)
@@ -1011,7 +1077,7 @@ void Parser::memoryKill(SSA::Instruction* i)
 							if (offset->getType() == SSA::Operand::constant)
 							{
 								SSA::Instruction* cseIns = *iter;
-								SSA::Operand* cseOffset = getMemoryAccessOffset(cseIns);
+								SSA::Operand* cseOffset = SSA::getMemoryAccessOffset(cseIns);
 								if (cseOffset && (cseOffset->getType() == SSA::Operand::val ||
 										offset->equals(cseOffset)))
 								{
@@ -0,0 +1,317 @@
+/*
+ * PassManager.cpp
+ * Author: Joshua Cao
+ */
+
+#include "PassManager.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+/*
+ * every heap allocation of the compiler goes through here, so a step's
+ * allocations are the difference of the counters around it. the counters
+ * are per thread, so the background writer and other threads do not show
+ * up in the steps of the thread running the passes
+ */
+static thread_local unsigned long numAllocations = 0;
+static thread_local unsigned long numBytes = 0;
+
+static void* allocate(std::size_t size, std::size_t alignment)
+{
+	numAllocations += 1;
+	numBytes += size;
+	void* p = nullptr;
+	if (alignment <= alignof(std::max_align_t))
+	{
+		p = malloc(size ? size : 1);
+	}
+	else if (posix_memalign(&p, alignment, size ? size : 1) != 0)
+	{
+		p = nullptr;
+	}
+	return p;
+}
+
+static void* allocateOrThrow(std::size_t size, std::size_t alignment)
+{
+	void* p = allocate(size, alignment);
+	if (!p)
+	{
+		throw std::bad_alloc();
+	}
+	return p;
+}
+
+void* operator new(std::size_t size)
+{
+	return allocateOrThrow(size, 0);
+}
+
+void* operator new[](std::size_t size)
+{
+	return allocateOrThrow(size, 0);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+	return allocateOrThrow(size, std::size_t(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+	return allocateOrThrow(size, std::size_t(alignment));
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	return allocate(size, 0);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+	return allocate(size, 0);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	return allocate(size, std::size_t(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	return allocate(size, std::size_t(alignment));
+}
+
+// malloc and posix_memalign memory are both released by free
+void operator delete(void* p) noexcept
+{
+	free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+	free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+	free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+	free(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept
+{
+	free(p);
+}
+
+void operator delete[](void* p, std::align_val_t) noexcept
+{
+	free(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept
+{
+	free(p);
+}
+
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept
+{
+	free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+	free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+	free(p);
+}
+
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept
+{
+	free(p);
+}
+
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept
+{
+	free(p);
+}
+
+static long countInstructions(SSA::Module* ir)
+{
+	long count = 0;
+	if (!ir)
+	{
+		return count;
+	}
+	for (SSA::Function* f : ir->getFuncs())
+	{
+		for (SSA::BasicBlock* b : f->getBBs())
+		{
+			count += b->getInstructions().size();
+		}
+	}
+	return count;
+}
+
+PassManager::PassManager() : defaultPipeline(true)
+{
+}
+
+void PassManager::registerPass(std::string name, Pass pass)
+{
+	passes.push_back({name, pass, false});
+	if (defaultPipeline)
+	{
+		pipeline.push_back(name);
+	}
+}
+
+void PassManager::registerAnalysis(std::string name, Pass pass)
+{
+	passes.push_back({name, pass, true});
+}
+
+const PassManager::Registered* PassManager::find(std::string name) const
+{
+	for (const Registered& registered : passes)
+	{
+		if (registered.name == name)
+		{
+			return &registered;
+		}
+	}
+	return nullptr;
+}
+
+bool PassManager::setPipeline(std::string spec)
+{
+	std::list<std::string> names;
+	std::size_t start = 0;
+	while (start <= spec.size())
+	{
+		std::size_t end = spec.find(',', start);
+		if (end == std::string::npos)
+		{
+			end = spec.size();
+		}
+		std::string name = spec.substr(start, end - start);
+		if (!name.empty())
+		{
+			if (!find(name))
+			{
+				return false;
+			}
+			names.push_back(name);
+		}
+		start = end + 1;
+	}
+	pipeline = names;
+	defaultPipeline = false;
+	return true;
+}
+
+bool PassManager::contains(std::string name) const
+{
+	for (const std::string& p : pipeline)
+	{
+		if (p == name)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void PassManager::run(SSA::Module* ir)
+{
+	for (const std::string& name : pipeline)
+	{
+		Pass pass = find(name)->pass;
+		time(name, ir, [&]() { pass(ir); });
+	}
+}
+
+void PassManager::time(std::string name, SSA::Module* const& ir, std::function<void()> step)
+{
+	long before = countInstructions(ir);
+	unsigned long allocations = numAllocations;
+	unsigned long bytes = numBytes;
+	auto start = std::chrono::steady_clock::now();
+	step();
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	allocations = numAllocations - allocations;
+	bytes = numBytes - bytes;
+	long after = countInstructions(ir);
+
+	Stats* s = nullptr;
+	for (Stats& existing : stats)
+	{
+		if (existing.name == name)
+		{
+			s = &existing;
+		}
+	}
+	if (!s)
+	{
+		stats.push_back({name, 0, 0, 0, 0, 0, 0});
+		s = &stats.back();
+	}
+	s->runs += 1;
+	s->seconds += elapsed.count();
+	s->instructionsBefore += before;
+	s->instructionsAfter += after;
+	s->allocations += allocations;
+	s->bytes += bytes;
+}
+
+std::string PassManager::statsToStr() const
+{
+	char line[256];
+	snprintf(line, sizeof(line), "%-20s %5s %10s %12s %12s %12s %12s\n", "pass", "runs", "time (ms)",
+			"ins before", "ins after", "allocations", "bytes");
+	std::string s = line;
+	double total = 0;
+	unsigned long totalAllocations = 0;
+	unsigned long totalBytes = 0;
+	for (const Stats& stat : stats)
+	{
+		snprintf(line, sizeof(line), "%-20s %5lu %10.3f %12ld %12ld %12lu %12lu\n", stat.name.c_str(), stat.runs,
+				stat.seconds * 1000, stat.instructionsBefore, stat.instructionsAfter, stat.allocations, stat.bytes);
+		s += line;
+		total += stat.seconds;
+		totalAllocations += stat.allocations;
+		totalBytes += stat.bytes;
+	}
+	snprintf(line, sizeof(line), "%-20s %5s %10.3f %12s %12s %12lu %12lu\n", "total", "", total * 1000, "", "",
+			totalAllocations, totalBytes);
+	return s + line;
+}
+
+std::string PassManager::passesToStr() const
+{
+	std::string s;
+	for (const Registered& registered : passes)
+	{
+		s += registered.name + (registered.analysis ? " (analysis)" : "") + '\n';
+	}
+	return s;
+}
+
+std::string PassManager::pipelineToStr() const
+{
+	std::string s;
+	for (const std::string& name : pipeline)
+	{
+		s += (s.empty() ? "" : ",") + name;
+	}
+	return s;
+}
@@ -0,0 +1,106 @@
+/*
+ * Profile.cpp
+ * Author: Joshua Cao
+ */
+
+#include "Profile.h"
+#include "AsyncWriter.h"
+#include "Interpreter.h"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+void recordProfile(SSA::Module* ir, std::string fileName, FILE* in, FILE* out)
+{
+	Interpreter interpreter(ir, false, in, out);
+	interpreter.run();
+
+	std::ostringstream file;
+	for (SSA::Function* f : ir->getFuncs())
+	{
+		if (f->isBuiltin())
+		{
+			continue;
+		}
+		std::list<SSA::BasicBlock*> BBs = f->getBBs();
+		std::unordered_map<SSA::BasicBlock*, int> indices;
+		int index = 0;
+		for (SSA::BasicBlock* b : BBs)
+		{
+			indices[b] = index++;
+		}
+		file << "function " << f->getName() << ' ' << BBs.size() << '\n';
+		for (SSA::BasicBlock* b : BBs)
+		{
+			file << "block " << indices[b] << ' ' << interpreter.getBlockCount(b) << '\n';
+			for (SSA::BasicBlock* succ : b->getSuccessors())
+			{
+				file << "edge " << indices[b] << ' ' << indices[succ] << ' '
+						<< interpreter.getEdgeCount(b, succ) << '\n';
+			}
+		}
+	}
+	writeFileAsync(fileName, file.str());
+}
+
+void loadProfile(SSA::Module* ir, std::string fileName)
+{
+	// the profile may still be queued by recordProfile. failed writes are
+	// left for main to report
+	waitForWrites();
+	std::ifstream file(fileName);
+	if (!file)
+	{
+		std::cerr << "cannot read profile " << fileName << std::endl;
+		exit(1);
+	}
+
+	// blocks of the current function, empty if it is unknown or stale
+	std::vector<SSA::BasicBlock*> BBs;
+	std::string line;
+	while (std::getline(file, line))
+	{
+		std::istringstream entry(line);
+		std::string kind;
+		entry >> kind;
+		if (kind == "function")
+		{
+			std::string name;
+			std::size_t size;
+			entry >> name >> size;
+			SSA::Function* f = ir->getFunction(name);
+			BBs.clear();
+			if (!f || f->getBBs().size() != size)
+			{
+				std::cerr << "profile " << fileName << " is stale for " << name << ", ignoring it" << std::endl;
+				continue;
+			}
+			std::list<SSA::BasicBlock*> blocks = f->getBBs();
+			BBs.assign(blocks.begin(), blocks.end());
+		}
+		else if (kind == "block")
+		{
+			std::size_t index;
+			long count;
+			if ((entry >> index >> count) && index < BBs.size())
+			{
+				BBs[index]->setCount(count);
+			}
+		}
+		else if (kind == "edge")
+		{
+			std::size_t from, to;
+			long count;
+			if ((entry >> from >> to >> count) && from < BBs.size() && to < BBs.size())
+			{
+				BBs[from]->setEdgeCount(BBs[to], count);
+			}
+		}
+		else if (!kind.empty())
+		{
+			std::cerr << "malformed profile " << fileName << ": " << line << std::endl;
+			exit(1);
+		}
+	}
+}
@@ -5,29 +5,18 @@
 
 #include <RegAlloc.h>
 #include "GraphMLWriter.h"
+#include "SSAutils.h"
+#include <unordered_set>
 
 int numIters = 0;
 
-void addOperandToLive(std::list<SSA::Instruction*>& live, SSA::Operand* o)
-{
-	if (o)
-	{
-		switch(o->getType())
-		{
-		case SSA::Operand::val:
-			live.push_back(o->getInstruction());
-			break;
-		case SSA::Operand::phi:
-		case SSA::Operand::call:
-			for (SSA::Operand* arg : o->getArgs())
-			{
-				live.push_back(o->getInstruction());
-			}
-			break;
-		}
-	}
-}
-
+/*
+ * the moves appended to a predecessor for the phis of one successor form a
+ * parallel copy: every arg is read before any phi is written. phis may share
+ * a register with args of other phis, so code generation has to order the
+ * moves, using a scratch register to break cycles. canonicalizeCFG splits
+ * critical edges, so the moves only run on the edge into the phi's block
+ */
 void insertMoveBeforePhi(SSA::Function* f)
 {
 	for (SSA::BasicBlock* b : f->getBBs())
@@ -58,78 +47,165 @@ void insertMoveBeforePhi(SSA::Function* f)
 	}
 }
 
+std::list<std::pair<int, int>> sequentializeMoves(std::list<std::pair<int, int>> moves, int scratch)
+{
+	std::list<std::pair<int, int>> ordered;
+	moves.remove_if([](std::pair<int, int> move) { return move.first == move.second; });
+	while (!moves.empty())
+	{
+		bool emitted = false;
+		for (auto iter = moves.begin(); iter != moves.end(); ++iter)
+		{
+			bool isRead = false;
+			for (auto other : moves)
+			{
+				isRead |= other.second == iter->first;
+			}
+			if (!isRead)
+			{
+				ordered.push_back(*iter);
+				moves.erase(iter);
+				emitted = true;
+				break;
+			}
+		}
+		if (!emitted)
+		{
+			int saved = moves.front().first;
+			ordered.push_back(std::make_pair(scratch, saved));
+			for (auto& move : moves)
+			{
+				if (move.second == saved)
+				{
+					move.second = scratch;
+				}
+			}
+		}
+	}
+	return ordered;
+}
+
+// registers written by the instructions of f, not counting its callees
+static std::set<int> getWrittenRegs(SSA::Function* f)
+{
+	std::set<int> regs;
+	for (SSA::BasicBlock* b : f->getBBs())
+	{
+		for (SSA::Instruction* i : b->getInstructions())
+		{
+			if (i->getReg() >= 0 && i->getReg() < NUM_REG)
+			{
+				regs.insert(i->getReg());
+			}
+		}
+	}
+	return regs;
+}
+
+static std::set<int> getAllRegs()
+{
+	std::set<int> regs;
+	for (int r = 0; r < NUM_REG; ++r)
+	{
+		regs.insert(r);
+	}
+	return regs;
+}
+
+ClobberSets getClobberedRegs(SSA::Module* ir)
+{
+	ClobberSets clobbers;
+	std::unordered_map<SSA::Function*, std::list<SSA::Function*>> callees;
+	std::list<SSA::Function*> worklist = ir->getFuncs();
+	while (!worklist.empty())
+	{
+		SSA::Function* f = worklist.front();
+		worklist.pop_front();
+		if (clobbers.find(f) != clobbers.cend())
+		{
+			continue;
+		}
+		clobbers[f] = getWrittenRegs(f);
+		callees[f] = SSA::getCallees(f);
+		worklist.insert(worklist.end(), callees[f].begin(), callees[f].end());
+	}
+
+	bool changed = true;
+	while (changed)
+	{
+		changed = false;
+		for (auto& pair : callees)
+		{
+			std::set<int>& regs = clobbers[pair.first];
+			std::size_t size = regs.size();
+			for (SSA::Function* callee : pair.second)
+			{
+				regs.insert(clobbers[callee].cbegin(), clobbers[callee].cend());
+			}
+			changed |= regs.size() != size;
+		}
+	}
+	return clobbers;
+}
+
 /*
  * WIMMER, C.,ANDFRANZ, M.
  * Linear scan register allocation on ssa form
  * Figure 4. BuildIntervals
  *
- * Question: don't we need to include phis in liveset in loop headers
- * to propage its liveness throughout loop?
+ * live sets come from the iterative bit vector liveness instead of a single
+ * reverse pass, so loop carried values no longer need the loop header
+ * extension. each block gets two extra positions after its last instruction
+ * for the moves insertMoveBeforePhi appends, one where phi args are read and
+ * one where phis are written
  */
-void allocateRegisters(SSA::Function* f)
+void allocateRegisters(SSA::Function* f, const ClobberSets& clobbers)
 {
-	// this is SUPER expensive but works as bandaid
-//	f->getParent()->cleanOperands();
-
-//	printf("%d\n", numIters);
-//	if (numIters > 3)
-//	{
-//		return;
-//	}
 	++numIters;
 
 	IntervalList intervals(f);
-	std::map<SSA::BasicBlock*, std::list<SSA::Instruction*>> liveIn;
 	std::list<SSA::BasicBlock*> BBs = f->getBBs();
 
-	// keep track of last lineIds to keep track of end of loop bodies
-	std::map<SSA::BasicBlock*, int> endLineIds;
-
-	uint lineId = f->resetLineIds() - 1;
+	f->resetLineIds();
 	f->resetRegs();
 
-//GraphML::SSAtoGraphML(f->getParent(), "bust/");
+	Liveness liveness(f);
+
+	// registers written by the calls each value is live across
+	std::unordered_map<SSA::Instruction*, std::set<int>> avoided;
+
+	// positions where phis are written at the end of each block
+	std::map<SSA::BasicBlock*, int> moveSlots;
+	int position = -1;
+	for (SSA::BasicBlock* b : BBs)
+	{
+		position += b->getInstructions().size() + 2;
+		moveSlots[b] = position;
+	}
 
 	// iterate through basic blocks and instructions in reverse order
 	for (std::list<SSA::BasicBlock*>::reverse_iterator it = BBs.rbegin(); it != BBs.rend(); ++it)
 	{
-		std::list<SSA::Instruction*> live;
 		SSA::BasicBlock* b = *it;
+		std::list<SSA::Instruction*>& instructions = b->getInstructions();
+		int bTo = moveSlots[b];
+		int bFrom = bTo - instructions.size() - 1;
+		int pos = bTo - 2;
 
-		// compute live from successors
+		// add live range over basic block for each value in live. values only
+		// read by phi moves die before the move slot, so a phi may reuse their register
+		BitVector live = liveness.getLiveOut(b);
+		BitVector liveThrough(liveness.getNumValues());
 		for (SSA::BasicBlock* succ : b->getSuccessors())
 		{
-			// add visited successors' liveIns to live
-			// and phi args associated with b
-			if (liveIn.find(succ) != liveIn.cend())
+			if (moveSlots.find(succ) != moveSlots.cend())
 			{
-				for (SSA::Instruction* i : liveIn[succ])
-				{
-					live.push_back(i);
-				}
-				for (SSA::Instruction* i : succ->getInstructions())
-				{
-					if (i->getOpcode() == SSA::phi)
-					{
-						SSA::Operand* phiArg = i->getOperand1()->getPhiArg(b);
-						if (phiArg && phiArg->getType() == SSA::Operand::val)
-						{
-							live.push_back(phiArg->getInstruction());
-						}
-					}
-				}
+				liveThrough.unionWith(liveness.getLiveIn(succ));
 			}
 		}
-
-		std::list<SSA::Instruction*> instructions = b->getInstructions();
-		uint bFrom = lineId - instructions.size() + 1;
-		uint bTo = lineId;
-		endLineIds[b] = lineId;
-
-		// add live range over basic block for each value in live
-		for (SSA::Instruction* i : live)
+		for (int id : live.toIndices())
 		{
-			intervals.addRange(i, bFrom, bTo);
+			intervals.addRange(liveness.getValue(id), bFrom, liveThrough.test(id) ? bTo : bTo - 1);
 		}
 
 		// compute live ranges of operands
@@ -141,9 +217,30 @@ void allocateRegisters(SSA::Function* f)
 			// output operand
 			// compute setFrom for phi in testing, in case it is not used later
 			// ideally this would be dead-code eliminated
+			// phis are written by moves before the block starts, so they are
+			// live from the start of the block
 			if (ins->hasOutput())
 			{
-				intervals.setFrom(ins, lineId + 1);
+				intervals.setFrom(ins, ins->getOpcode() == SSA::phi ? bFrom : pos + 1);
+				live.reset(liveness.getValueId(ins));
+			}
+
+			// values still live are live across the call
+			if (ins->getOpcode() == SSA::call && ins->getOperand1()->getType() == SSA::Operand::call)
+			{
+				auto clobbered = clobbers.find(ins->getOperand1()->getFunctionCall()->function);
+				for (int id : live.toIndices())
+				{
+					std::set<int>& regs = avoided[liveness.getValue(id)];
+					if (clobbered == clobbers.cend())
+					{
+						regs = getAllRegs();
+					}
+					else
+					{
+						regs.insert(clobbered->second.cbegin(), clobbered->second.cend());
+					}
+				}
 			}
 
 			if (ins->getOpcode() != SSA::phi)
@@ -151,59 +248,103 @@ void allocateRegisters(SSA::Function* f)
 				// input operand
 				SSA::Operand* op1 = ins->getOperand1();
 				SSA::Operand* op2 = ins->getOperand2();
-				intervals.addRange(op1, bFrom, lineId);
-				intervals.addRange(op2, bFrom, lineId);
-				addOperandToLive(live, op1);
-				addOperandToLive(live, op2);
+				intervals.addRange(op1, bFrom, pos);
+				intervals.addRange(op2, bFrom, pos);
+				liveness.addUses(live, op1);
+				liveness.addUses(live, op2);
 			}
-			live.remove(ins);
-			--lineId;
+			--pos;
 		}
+	}
 
-		// extend range of loop header live set to entire loop body
-		if (b->isLoopHeader())
+	// phis are written by moves at the end of each predecessor, so they must
+	// not share a register with anything live across the edge. done after the walk
+	// so setFrom does not clip ranges in predecessors laid out earlier
+	for (SSA::BasicBlock* b : BBs)
+	{
+		for (SSA::Instruction* i : b->getInstructions())
 		{
-			// predecessor that has already been visited is last node of loop body
-			int loopBodyEndId = -1;
-			for (SSA::BasicBlock* pred : b->getPredecessors())
+			if (i->getOpcode() == SSA::phi && i->getOperand1())
 			{
-				if (endLineIds.find(pred) != endLineIds.cend())
+				for (auto pair : i->getOperand1()->getPhiArgs())
 				{
-					if (endLineIds[pred] > loopBodyEndId)
+					if (moveSlots.find(pair.first) != moveSlots.cend())
 					{
-						loopBodyEndId = endLineIds[pred];
+						intervals.addRange(i, moveSlots[pair.first], moveSlots[pair.first]);
 					}
 				}
 			}
-			for (SSA::Instruction* liveIns : live)
-			{
-				intervals.addRange(liveIns, bFrom, loopBodyEndId);
-			}
 		}
-		liveIn[b] = live;
-
-//		printf("live:\n");
-//		for (SSA::Instruction* i : live)
-//		{
-//			if (i)
-//				printf("\t%s\n", i->toStr().c_str());
-//		}
 	}
 
-//	printf("%s\n", intervals.toStr().c_str());
 	InterferenceGraph igraph = intervals.buildInterferenceGraph();
-	GraphML::InterferenceGraphToGraphML(igraph,
-			"interference_graph/", ("_" + f->getName()).c_str());
-	igraph.colorGraph(NUM_REG);
+	for (auto& pair : avoided)
+	{
+		igraph.avoidRegs(pair.first, pair.second);
+	}
+	if (GraphML::isDumping(GraphML::DUMP_IGRAPH) && GraphML::isDumpingFunction(f->getName()))
+	{
+		GraphML::InterferenceGraphToGraphML(igraph,
+				"interference_graph/", ("_" + f->getName()).c_str());
+	}
+	// colors come from the graph rebuilt with the spill code
+	if (!igraph.colorGraph(NUM_REG))
+	{
+		allocateRegisters(f, clobbers);
+	}
 }
 
-void allocateRegisters(SSA::Module* ir)
+void allocateRegisters(SSA::Function* f)
 {
-	for (SSA::Function* f : ir->getFuncs())
+	allocateRegisters(f, ClobberSets());
+}
+
+/*
+ * post order over the calls from f. functions on the current path, ie. in a
+ * cycle with f, are not allocated yet and count as writing every register
+ */
+static void allocateBottomUp(SSA::Function* f, const std::unordered_set<SSA::Function*>& allocate,
+		std::unordered_set<SSA::Function*>& visited, ClobberSets& clobbers)
+{
+	if (!visited.insert(f).second)
+	{
+		return;
+	}
+	std::list<SSA::Function*> callees = SSA::getCallees(f);
+	for (SSA::Function* callee : callees)
+	{
+		allocateBottomUp(callee, allocate, visited, clobbers);
+	}
+	if (allocate.find(f) != allocate.cend() && !f->isBuiltin())
 	{
 		numIters = 0;
-		allocateRegisters(f);
+		allocateRegisters(f, clobbers);
 		insertMoveBeforePhi(f);
 	}
+	std::set<int> regs = getWrittenRegs(f);
+	for (SSA::Function* callee : callees)
+	{
+		auto clobbered = clobbers.find(callee);
+		if (clobbered == clobbers.cend())
+		{
+			regs = getAllRegs();
+			break;
+		}
+		regs.insert(clobbered->second.cbegin(), clobbered->second.cend());
+	}
+	clobbers[f] = regs;
+}
+
+void allocateRegisters(SSA::Module* ir)
+{
+	// functions that are not in the module, eg. reused by FunctionCache, are
+	// already allocated and only count as callees
+	std::unordered_set<SSA::Function*> allocate(ir->getFuncs().begin(), ir->getFuncs().end());
+	std::unordered_set<SSA::Function*> visited;
+	ClobberSets clobbers;
+	for (SSA::Function* f : ir->getFuncs())
+	{
+		allocateBottomUp(f, allocate, visited, clobbers);
+	}
 }
 
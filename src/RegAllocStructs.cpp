@@ -4,6 +4,10 @@
  */
 
 # include "RegAllocStructs.h"
+#include <cmath>
+#include <limits>
+#include <unordered_set>
+#include "SSAutils.h"
 
 InterferenceGraph::Node::Node(SSA::Instruction *i) :
 		Node(-1, i)
@@ -73,15 +77,135 @@ InterferenceGraph::Node* InterferenceGraph::popNode(int k)
 	return nullptr;
 }
 
+/*
+ * spill cost is the number of definitions and uses, where each is weighted by
+ * 10^(loop depth), or with a profile by the block's execution count plus one.
+ * uses in phis happen at the end of the matching predecessor.
+ * values whose only use is the next instruction, such as loads inserted by
+ * previous spills, can't be shortened by spilling and are never chosen
+ */
+// spill slots are at non negative offsets from the global register
+static bool isSpillSlot(SSA::Instruction* memAccess)
+{
+	SSA::Operand* offset = SSA::getMemoryAccessOffset(memAccess);
+	return offset && offset->getType() == SSA::Operand::constant && offset->getConst() >= 0;
+}
+
+static float getBlockWeight(SSA::LoopForest* loops, SSA::BasicBlock* b)
+{
+	if (b->getCount() >= 0)
+	{
+		return b->getCount() + 1.0f;
+	}
+	return std::pow(10.0f, loops->getLoopDepth(b));
+}
+
+void InterferenceGraph::computeSpillCosts()
+{
+	SSA::LoopForest* loops = f->getAnalyses().getLoopForest();
+	std::unordered_map<SSA::Instruction*, int> numUses;
+	std::unordered_map<SSA::Instruction*, SSA::Instruction*> lastUse;
+	// values that are already spilled, whose only use is the spill store
+	std::unordered_set<SSA::Instruction*> spillStores;
+	for (SSA::BasicBlock* b : f->getBBs())
+	{
+		float weight = getBlockWeight(loops, b);
+		SSA::Instruction* prev = nullptr;
+		for (SSA::Instruction* i : b->getInstructions())
+		{
+			spillCosts[i] += weight;
+			std::list<std::pair<SSA::Operand*, SSA::BasicBlock*>> uses;
+			for (SSA::Operand* o : {i->getOperand1(), i->getOperand2()})
+			{
+				if (!o)
+				{
+					continue;
+				}
+				if (o->getType() == SSA::Operand::phi)
+				{
+					for (auto arg : o->getPhiArgs())
+					{
+						uses.push_back(std::make_pair(arg.second, arg.first));
+					}
+				}
+				else if (o->getType() == SSA::Operand::call)
+				{
+					for (SSA::Operand* arg : o->getArgs())
+					{
+						uses.push_back(std::make_pair(arg, b));
+					}
+				}
+				else
+				{
+					uses.push_back(std::make_pair(o, b));
+				}
+			}
+			for (auto use : uses)
+			{
+				if (use.first->getType() == SSA::Operand::val)
+				{
+					SSA::Instruction* def = use.first->getInstruction();
+					spillCosts[def] += getBlockWeight(loops, use.second);
+					numUses[def] += 1;
+					lastUse[def] = prev == def ? i : nullptr;
+					if (i->getOpcode() == SSA::store && isSpillSlot(i) && i->getOperand2() == use.first)
+					{
+						spillStores.insert(def);
+					}
+				}
+			}
+			prev = i;
+		}
+	}
+	for (auto pair : numUses)
+	{
+		if (pair.second == 1 && (lastUse[pair.first] || spillStores.find(pair.first) != spillStores.cend()))
+		{
+			spillCosts[pair.first] = std::numeric_limits<float>::infinity();
+		}
+	}
+	// spilling a reload again only adds another reload
+	for (auto& pair : spillCosts)
+	{
+		if (pair.first->getOpcode() == SSA::load && isSpillSlot(pair.first))
+		{
+			pair.second = std::numeric_limits<float>::infinity();
+		}
+	}
+}
+
+/*
+ * G. J. Chaitin
+ * Register Allocation & Spilling via Graph Coloring
+ * spill the node with the lowest cost / degree
+ */
 std::list<InterferenceGraph::Node>::iterator InterferenceGraph::spillNode()
 {
-	// TODO: heurisitc
+	if (spillCosts.empty())
+	{
+		computeSpillCosts();
+	}
+	std::list<Node>::iterator spill = nodes.begin();
+	float minCost = std::numeric_limits<float>::infinity();
 	for (std::list<Node>::iterator iter = nodes.begin(); iter != nodes.end();
 			++iter)
 	{
-		return iter;
+		int degree = 0;
+		for (int i = 0; i < adjacencyMatrix.size(); ++i)
+		{
+			if (adjacencyMatrix[iter->id][i] && iter->id != i)
+			{
+				degree += 1;
+			}
+		}
+		float cost = spillCosts[iter->instruction] / std::max(degree, 1);
+		if (cost < minCost)
+		{
+			minCost = cost;
+			spill = iter;
+		}
 	}
-	return nodes.end();
+	return spill;
 }
 
 InterferenceGraph::InterferenceGraph(
@@ -115,6 +239,11 @@ void InterferenceGraph::addEdge(SSA::Instruction *x, SSA::Instruction *y)
 	}
 }
 
+void InterferenceGraph::avoidRegs(SSA::Instruction* i, const std::set<int>& regs)
+{
+	avoided[i] = regs;
+}
+
 std::list<InterferenceGraph::Node> InterferenceGraph::getNodes() const
 {
 	return nodes;
@@ -132,7 +261,7 @@ std::list<InterferenceGraph::Node> InterferenceGraph::getNodes() const
  * 		- no need to restore matrix since subsequent coloring only relies on nodes'
  * 		adjacency vectors
  */
-void InterferenceGraph::colorGraph(int k)
+bool InterferenceGraph::colorGraph(int k)
 {
 	std::stack<Node> stack;
 	std::list<Node> spillSet;
@@ -163,50 +292,64 @@ void InterferenceGraph::colorGraph(int k)
 	// insert spill code and reconstruct interference graph
 	if (!spillSet.empty())
 	{
-		int offset = spillSet.front().instruction->getParent()->getParent()->getLocalVariableOffset();
+		// spill slots sit at non negative offsets in the function's frame,
+		// arrays at negative offsets
+		int offset = f->getFrameSize();
 		for (Node n : spillSet)
 		{
 			SSA::Instruction* addaStore = new SSA::Instruction(SSA::adda, new SSA::GlobalRegOperand,
 					new SSA::ConstOperand(offset));
 			SSA::Instruction* store = new SSA::Instruction(SSA::store,
-					new SSA::ValOperand(n.instruction), new SSA::ValOperand(addaStore));
-			n.instruction->insertAfter(store);
-			n.instruction->insertAfter(addaStore);
+					new SSA::ValOperand(addaStore), new SSA::ValOperand(n.instruction));
+			// keep phis at the start of the block
+			SSA::Instruction* def = n.instruction;
+			if (def->getOpcode() == SSA::phi)
+			{
+				for (SSA::Instruction* i : def->getParent()->getInstructions())
+				{
+					if (i->getOpcode() == SSA::phi)
+					{
+						def = i;
+					}
+				}
+			}
+			def->insertAfter(store);
+			def->insertAfter(addaStore);
 			for (SSA::BasicBlock* b : n.instruction->getParent()->getParent()->getBBs())
 			{
 				for (SSA::Instruction* i : b->getInstructions())
 				{
 					SSA::ValOperand* val = new SSA::ValOperand(n.instruction);
-					// dont replace args in the newly inserted adda
-					// can be better by iterating from the current instruction, but more work
-					// could also make sure i != just created store a few lines before
-					// if there are cases where other stores use i
-					if (i->containsArg(val) && i->getOpcode() != SSA::adda && i->getOpcode() != SSA::store)
+					// dont replace args in the newly inserted store
+					if (i != store && i->containsArg(val))
 					{
-						SSA::Instruction* adda = new SSA::Instruction(SSA::adda, new SSA::GlobalRegOperand(), new SSA::ConstOperand(offset));
-						SSA::Instruction* load = new SSA::Instruction(SSA::load, new SSA::ValOperand(adda));
-						// in the case of phi, loads need to go in previous basic block
+						// in the case of phi, loads need to go in each previous basic block
 						if (i->getOpcode() == SSA::phi)
 						{
 							SSA::Operand* phiOp = i->getOperand1();
-							if (phiOp)
+							for (std::pair<SSA::BasicBlock*, SSA::Operand*> phiArg : phiOp->getPhiArgs())
 							{
-								for (std::pair<SSA::BasicBlock*, SSA::Operand*> phiArg : phiOp->getPhiArgs())
+								if (phiArg.second->equals(val))
 								{
-									if (phiArg.second->equals(val))
-									{
-										phiArg.first->emit(adda);
-										phiArg.first->emit(load);
-									}
+									SSA::Instruction* adda = new SSA::Instruction(SSA::adda, new SSA::GlobalRegOperand(), new SSA::ConstOperand(offset));
+									SSA::Instruction* load = new SSA::Instruction(SSA::load, new SSA::ValOperand(adda));
+									phiArg.first->emit(adda);
+									phiArg.first->emit(load);
+									SSA::Operand* loadOp = new SSA::ValOperand(load);
+									f->getParent()->addOperand(loadOp);
+									phiOp->addPhiArg(phiArg.first, loadOp);
 								}
 							}
+							delete val;
 						}
 						else
 						{
+							SSA::Instruction* adda = new SSA::Instruction(SSA::adda, new SSA::GlobalRegOperand(), new SSA::ConstOperand(offset));
+							SSA::Instruction* load = new SSA::Instruction(SSA::load, new SSA::ValOperand(adda));
 							i->insertBefore(adda);
 							i->insertBefore(load);
+							i->replaceArg(val, new SSA::ValOperand(load));
 						}
-						i->replaceArg(val, new SSA::ValOperand(load));
 					}
 					else
 					{
@@ -214,20 +357,58 @@ void InterferenceGraph::colorGraph(int k)
 					}
 				}
 			}
-			offset -= 4;
+			offset += 4;
 		}
 //		printf("allocating regs\n");
-		spillSet.front().instruction->getParent()->getParent()->setLocalVariableOffset(offset);
-		allocateRegisters(f);
+		f->setFrameSize(offset);
+		return false;
 	}
 
-	// assign lowest possible color for each node in stack
+	// phis and their args that share a register need no move
+	std::unordered_map<SSA::Instruction*, std::list<SSA::Instruction*>> related;
+	for (SSA::BasicBlock* b : f->getBBs())
+	{
+		for (SSA::Instruction* i : b->getInstructions())
+		{
+			if (i->getOpcode() != SSA::phi || !i->getOperand1())
+			{
+				continue;
+			}
+			for (auto arg : i->getOperand1()->getPhiArgs())
+			{
+				if (arg.second->getType() == SSA::Operand::val)
+				{
+					related[i].push_back(arg.second->getInstruction());
+					related[arg.second->getInstruction()].push_back(i);
+				}
+			}
+		}
+	}
+
+	// assign the color of a related node if possible, otherwise the lowest.
+	// colors to avoid come last
 	while (!stack.empty())
 	{
 		Node n = stack.top();
 		stack.pop();
-		int color;
-		for (color = 0; color < k; ++color)
+		std::list<int> colors;
+		for (SSA::Instruction* i : related[n.instruction])
+		{
+			if (i->getReg() >= 0 && i->getReg() < k)
+			{
+				colors.push_back(i->getReg());
+			}
+		}
+		for (int color = 0; color < k; ++color)
+		{
+			colors.push_back(color);
+		}
+		if (avoided.find(n.instruction) != avoided.cend())
+		{
+			const std::set<int>& avoid = avoided[n.instruction];
+			std::stable_partition(colors.begin(), colors.end(), [&](int color) { return !avoid.count(color); });
+		}
+		for (int color : colors)
 		{
 			bool foundColor = true;
 			for (SSA::Instruction *i : n.edges)
@@ -245,6 +426,7 @@ void InterferenceGraph::colorGraph(int k)
 			}
 		}
 	}
+	return true;
 }
 
 IntervalList::Interval::Interval()
@@ -334,7 +516,8 @@ InterferenceGraph IntervalList::buildInterferenceGraph() const
 
 void IntervalList::addRange(SSA::Instruction *i, int from, int to)
 {
-	if (i)
+	// values of other functions are read from their export slot, not a register
+	if (i && i->getParent()->getParent() == f)
 	{
 		intervals[i].addRange(from, to);
 	}
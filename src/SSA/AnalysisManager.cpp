@@ -0,0 +1,52 @@
+/*
+ * AnalysisManager.cpp
+ * Author: Joshua Cao
+ */
+
+#include "AnalysisManager.h"
+
+#include "Function.h"
+#include "DominatorTree.h"
+#include "LoopForest.h"
+
+SSA::AnalysisManager::~AnalysisManager()
+{
+	invalidate();
+}
+
+SSA::DominatorTree* SSA::AnalysisManager::getDominatorTree()
+{
+	if (!domTree)
+	{
+		domTree = new DominatorTree(f);
+	}
+	return domTree;
+}
+
+SSA::DominanceFrontier* SSA::AnalysisManager::getDominanceFrontier()
+{
+	if (!domFrontier)
+	{
+		domFrontier = new DominanceFrontier(getDominatorTree());
+	}
+	return domFrontier;
+}
+
+SSA::LoopForest* SSA::AnalysisManager::getLoopForest()
+{
+	if (!loops)
+	{
+		loops = new LoopForest(getDominatorTree());
+	}
+	return loops;
+}
+
+void SSA::AnalysisManager::invalidate()
+{
+	delete domTree;
+	delete domFrontier;
+	delete loops;
+	domTree = nullptr;
+	domFrontier = nullptr;
+	loops = nullptr;
+}
@@ -10,6 +10,10 @@
 #include "Function.h"
 #include "Module.h"
 
+#include <algorithm>
+
+unsigned long SSA::BasicBlock::nextSerial = 0;
+
 std::list<SSA::Instruction*>::iterator SSA::BasicBlock::getInstructionIter(Instruction* i)
 {
 	std::list<SSA::Instruction*>::iterator iter;
@@ -92,6 +96,17 @@ void SSA::BasicBlock::emitAfter(Instruction* x, Instruction* y)
 	}
 }
 
+// caller takes ownership of the removed instruction
+void SSA::BasicBlock::remove(Instruction* ins)
+{
+	auto iter = getInstructionIter(ins);
+	if (iter != instructions.end())
+	{
+		instructions.erase(iter);
+		ins->setParent(nullptr);
+	}
+}
+
 std::list<SSA::Instruction*>& SSA::BasicBlock::getInstructions()
 {
 	return instructions;
@@ -100,11 +115,40 @@ std::list<SSA::Instruction*>& SSA::BasicBlock::getInstructions()
 void SSA::BasicBlock::addPredecessor(BasicBlock* pred)
 {
 	this->pred.push_back(pred);
+	cfgChanged();
 }
 
 void SSA::BasicBlock::addSuccessor(BasicBlock* succ)
 {
 	this->succ.push_back(succ);
+	cfgChanged();
+}
+
+// replace in place to keep successor order, since the first successor is the
+// fall through and the second is the branch target
+void SSA::BasicBlock::replacePredecessor(BasicBlock* oldPred, BasicBlock* newPred)
+{
+	std::replace(pred.begin(), pred.end(), oldPred, newPred);
+	cfgChanged();
+}
+
+void SSA::BasicBlock::replaceSuccessor(BasicBlock* oldSucc, BasicBlock* newSucc)
+{
+	std::replace(succ.begin(), succ.end(), oldSucc, newSucc);
+	auto edge = edgeCounts.find(oldSucc);
+	if (edge != edgeCounts.end())
+	{
+		long count = edge->second;
+		edgeCounts.erase(edge);
+		edgeCounts[newSucc] = count;
+	}
+	cfgChanged();
+}
+
+void SSA::BasicBlock::swapSuccessors()
+{
+	succ.reverse();
+	cfgChanged();
 }
 
 std::list<SSA::BasicBlock*> SSA::BasicBlock::getPredecessors()
@@ -117,7 +161,46 @@ std::list<SSA::BasicBlock*> SSA::BasicBlock::getSuccessors()
 	return succ;
 }
 
+void SSA::BasicBlock::cfgChanged()
+{
+	if (parent)
+	{
+		parent->invalidateAnalyses();
+	}
+}
+
 bool SSA::BasicBlock::isLoopHeader() const
 {
 	return loopHeader;
 }
+
+long SSA::BasicBlock::getCount() const
+{
+	return count;
+}
+
+void SSA::BasicBlock::setCount(long count)
+{
+	this->count = count;
+}
+
+long SSA::BasicBlock::getEdgeCount(BasicBlock* succ) const
+{
+	auto edge = edgeCounts.find(succ);
+	return edge == edgeCounts.cend() ? -1 : edge->second;
+}
+
+void SSA::BasicBlock::setEdgeCount(BasicBlock* succ, long count)
+{
+	edgeCounts[succ] = count;
+}
+
+unsigned long SSA::BasicBlock::getSerial() const
+{
+	return serial;
+}
+
+bool SSA::BlockOrder::operator()(const BasicBlock* x, const BasicBlock* y) const
+{
+	return x->getSerial() < y->getSerial();
+}
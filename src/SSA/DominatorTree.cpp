@@ -0,0 +1,237 @@
+/*
+ * DominatorTree.cpp
+ * Author: Joshua Cao
+ */
+
+#include "DominatorTree.h"
+
+#include "Instruction.h"
+#include "BasicBlock.h"
+#include "Function.h"
+
+#include <stack>
+
+SSA::DominatorTree::DominatorTree(Function* f) : f(f), entry(nullptr)
+{
+	std::list<BasicBlock*> BBs = f->getBBs();
+	if (BBs.empty())
+	{
+		return;
+	}
+	entry = BBs.front();
+	computePostOrder();
+
+	// iterate in reverse post order until the idoms stop changing
+	idoms[entry] = entry;
+	bool changed = true;
+	while (changed)
+	{
+		changed = false;
+		for (auto iter = postOrder.rbegin(); iter != postOrder.rend(); ++iter)
+		{
+			BasicBlock* b = *iter;
+			if (b == entry)
+			{
+				continue;
+			}
+			BasicBlock* newIdom = nullptr;
+			for (BasicBlock* pred : b->getPredecessors())
+			{
+				if (idoms.find(pred) == idoms.cend())
+				{
+					continue;
+				}
+				newIdom = newIdom ? intersect(pred, newIdom) : pred;
+			}
+			if (newIdom && idoms[b] != newIdom)
+			{
+				idoms[b] = newIdom;
+				changed = true;
+			}
+		}
+	}
+
+	for (auto iter = postOrder.rbegin(); iter != postOrder.rend(); ++iter)
+	{
+		if (*iter != entry)
+		{
+			children[idoms[*iter]].push_back(*iter);
+		}
+	}
+	computeTreeIds();
+}
+
+void SSA::DominatorTree::computePostOrder()
+{
+	// iterative dfs, where a block is finished after all its successors are
+	std::unordered_set<BasicBlock*> visited;
+	std::stack<std::pair<BasicBlock*, std::list<BasicBlock*>>> stack;
+	visited.insert(entry);
+	stack.push(std::make_pair(entry, entry->getSuccessors()));
+	while (!stack.empty())
+	{
+		std::list<BasicBlock*>& succs = stack.top().second;
+		if (succs.empty())
+		{
+			postOrderIds[stack.top().first] = postOrder.size();
+			postOrder.push_back(stack.top().first);
+			stack.pop();
+			continue;
+		}
+		BasicBlock* succ = succs.front();
+		succs.pop_front();
+		if (visited.find(succ) == visited.cend())
+		{
+			visited.insert(succ);
+			stack.push(std::make_pair(succ, succ->getSuccessors()));
+		}
+	}
+}
+
+void SSA::DominatorTree::computeTreeIds()
+{
+	int id = 0;
+	std::stack<std::pair<BasicBlock*, bool>> stack;
+	stack.push(std::make_pair(entry, false));
+	while (!stack.empty())
+	{
+		std::pair<BasicBlock*, bool> top = stack.top();
+		stack.pop();
+		if (top.second)
+		{
+			treeIds[top.first].second = id++;
+			continue;
+		}
+		treeIds[top.first].first = id++;
+		stack.push(std::make_pair(top.first, true));
+		if (children.find(top.first) != children.cend())
+		{
+			for (BasicBlock* child : children.at(top.first))
+			{
+				stack.push(std::make_pair(child, false));
+			}
+		}
+	}
+}
+
+SSA::BasicBlock* SSA::DominatorTree::intersect(BasicBlock* x, BasicBlock* y) const
+{
+	while (x != y)
+	{
+		while (postOrderIds.at(x) < postOrderIds.at(y))
+		{
+			x = idoms.at(x);
+		}
+		while (postOrderIds.at(y) < postOrderIds.at(x))
+		{
+			y = idoms.at(y);
+		}
+	}
+	return x;
+}
+
+SSA::Function* SSA::DominatorTree::getFunction() const
+{
+	return f;
+}
+
+SSA::BasicBlock* SSA::DominatorTree::getEntry() const
+{
+	return entry;
+}
+
+SSA::BasicBlock* SSA::DominatorTree::getIDom(BasicBlock* b) const
+{
+	if (b == entry || idoms.find(b) == idoms.cend())
+	{
+		return nullptr;
+	}
+	return idoms.at(b);
+}
+
+std::list<SSA::BasicBlock*> SSA::DominatorTree::getChildren(BasicBlock* b) const
+{
+	if (children.find(b) == children.cend())
+	{
+		return std::list<BasicBlock*>();
+	}
+	return children.at(b);
+}
+
+std::vector<SSA::BasicBlock*> SSA::DominatorTree::getReversePostOrder() const
+{
+	return std::vector<BasicBlock*>(postOrder.rbegin(), postOrder.rend());
+}
+
+bool SSA::DominatorTree::isReachable(BasicBlock* b) const
+{
+	return treeIds.find(b) != treeIds.cend();
+}
+
+bool SSA::DominatorTree::dominates(BasicBlock* x, BasicBlock* y) const
+{
+	if (!isReachable(x) || !isReachable(y))
+	{
+		return false;
+	}
+	std::pair<int, int> xIds = treeIds.at(x);
+	std::pair<int, int> yIds = treeIds.at(y);
+	return xIds.first <= yIds.first && yIds.second <= xIds.second;
+}
+
+bool SSA::DominatorTree::dominates(Instruction* x, Instruction* y) const
+{
+	if (x->getParent() != y->getParent())
+	{
+		return dominates(x->getParent(), y->getParent());
+	}
+	for (Instruction* i : x->getParent()->getInstructions())
+	{
+		if (i == x)
+		{
+			return true;
+		}
+		if (i == y)
+		{
+			return false;
+		}
+	}
+	return false;
+}
+
+SSA::DominanceFrontier::DominanceFrontier(DominatorTree* domTree)
+{
+	for (BasicBlock* b : domTree->getReversePostOrder())
+	{
+		std::list<BasicBlock*> preds = b->getPredecessors();
+		if (preds.size() < 2)
+		{
+			continue;
+		}
+		for (BasicBlock* pred : preds)
+		{
+			BasicBlock* runner = pred;
+			while (runner && domTree->isReachable(runner) && runner != domTree->getIDom(b))
+			{
+				frontiers[runner].insert(b);
+				runner = domTree->getIDom(runner);
+			}
+		}
+	}
+}
+
+std::unordered_set<SSA::BasicBlock*> SSA::DominanceFrontier::getFrontier(BasicBlock* b) const
+{
+	if (frontiers.find(b) == frontiers.cend())
+	{
+		return std::unordered_set<BasicBlock*>();
+	}
+	return frontiers.at(b);
+}
+
+// @return true if y is in the dominance frontier of x
+bool SSA::DominanceFrontier::isInFrontier(BasicBlock* x, BasicBlock* y) const
+{
+	return frontiers.find(x) != frontiers.cend()
+			&& frontiers.at(x).find(y) != frontiers.at(x).cend();
+}
@@ -26,6 +26,21 @@ void SSA::Function::emit(BasicBlock *bb)
 {
 	bb->setParent(this);
 	BBs.push_back(bb);
+	invalidateAnalyses();
+}
+
+void SSA::Function::emitAfter(BasicBlock* x, BasicBlock* y)
+{
+	for (auto iter = BBs.begin(); iter != BBs.end(); ++iter)
+	{
+		if (*iter == y)
+		{
+			x->setParent(this);
+			BBs.insert(++iter, x);
+			invalidateAnalyses();
+			return;
+		}
+	}
 }
 
 std::string SSA::Function::getName()
@@ -38,6 +53,31 @@ std::list<SSA::BasicBlock*> SSA::Function::getBBs()
 	return BBs;
 }
 
+void SSA::Function::setBBs(std::list<BasicBlock*> order)
+{
+	BBs = order;
+}
+
+void SSA::Function::takeBody(Function* other)
+{
+	for (BasicBlock* bb : BBs)
+	{
+		delete bb;
+	}
+	BBs.clear();
+	for (BasicBlock* bb : other->BBs)
+	{
+		bb->setParent(this);
+		BBs.push_back(bb);
+	}
+	other->BBs.clear();
+	isVoidReturn = other->isVoidReturn;
+	localVariableOffset = other->localVariableOffset;
+	frameSize = other->frameSize;
+	invalidateAnalyses();
+	other->invalidateAnalyses();
+}
+
 SSA::Module* SSA::Function::getParent() const
 {
 	return parent;
@@ -48,6 +88,12 @@ bool SSA::Function::isVoid() const
 	return isVoidReturn;
 }
 
+// InputNum, OutputNum and OutputNewLine have no body and do not touch memory
+bool SSA::Function::isBuiltin() const
+{
+	return name == "InputNum" || name == "OutputNum" || name == "OutputNewLine";
+}
+
 int SSA::Function::getLocalVariableOffset() const
 {
 	return localVariableOffset;
@@ -63,6 +109,16 @@ void SSA::Function::setLocalVariableOffset(int i)
 	localVariableOffset = i;
 }
 
+int SSA::Function::getFrameSize() const
+{
+	return frameSize;
+}
+
+void SSA::Function::setFrameSize(int size)
+{
+	frameSize = size;
+}
+
 int SSA::Function::resetLineIds()
 {
 	uint lineId = 0;
@@ -86,3 +142,96 @@ void SSA::Function::resetRegs()
 		}
 	}
 }
+
+bool SSA::FunctionSummary::isPure() const
+{
+	return readArrays.empty() && !readsAnywhere && isReadOnly();
+}
+
+bool SSA::FunctionSummary::isReadOnly() const
+{
+	return writtenArrays.empty() && !writesAnywhere && !io;
+}
+
+bool SSA::FunctionSummary::mayRead(int array) const
+{
+	return readsAnywhere || (array ? readArrays.count(array) != 0 : !readArrays.empty());
+}
+
+bool SSA::FunctionSummary::mayWrite(int array) const
+{
+	return writesAnywhere || (array ? writtenArrays.count(array) != 0 : !writtenArrays.empty());
+}
+
+bool SSA::FunctionSummary::mayClobber(const FunctionSummary& reader) const
+{
+	if (writesAnywhere)
+	{
+		return reader.mayRead(0);
+	}
+	for (int array : writtenArrays)
+	{
+		if (reader.mayRead(array))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool SSA::FunctionSummary::operator==(const FunctionSummary& other) const
+{
+	return readArrays == other.readArrays && writtenArrays == other.writtenArrays
+			&& readsAnywhere == other.readsAnywhere && writesAnywhere == other.writesAnywhere
+			&& io == other.io && speculatable == other.speculatable;
+}
+
+static std::string arraysToStr(const std::set<int>& arrays, bool anywhere)
+{
+	if (anywhere)
+	{
+		return "*";
+	}
+	std::string s;
+	for (int array : arrays)
+	{
+		s += (s.empty() ? "" : ",") + std::to_string(array);
+	}
+	return s.empty() ? "-" : s;
+}
+
+// reads, writes, then io and speculatable if they hold
+std::string SSA::FunctionSummary::toStr() const
+{
+	std::string s = "reads " + arraysToStr(readArrays, readsAnywhere) + " writes "
+			+ arraysToStr(writtenArrays, writesAnywhere);
+	if (io)
+	{
+		s += " io";
+	}
+	if (speculatable)
+	{
+		s += " speculatable";
+	}
+	return s;
+}
+
+const SSA::FunctionSummary& SSA::Function::getSummary() const
+{
+	return summary;
+}
+
+void SSA::Function::setSummary(const FunctionSummary& s)
+{
+	summary = s;
+}
+
+SSA::AnalysisManager& SSA::Function::getAnalyses()
+{
+	return analyses;
+}
+
+void SSA::Function::invalidateAnalyses()
+{
+	analyses.invalidate();
+}
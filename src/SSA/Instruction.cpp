@@ -12,6 +12,7 @@
 #include "SSAutils.h"
 
 uint SSA::Instruction::idCount = 0;
+unsigned long SSA::Instruction::creationCount = 0;
 
 void SSA::Instruction::replaceArg(Operand* oldOp, Operand* newOp, bool left)
 {
@@ -65,6 +66,11 @@ uint SSA::Instruction::getId() const
 	return id;
 }
 
+unsigned long SSA::Instruction::getCreation() const
+{
+	return creation;
+}
+
 SSA::BasicBlock* SSA::Instruction::getParent() const
 {
 	return parent;
@@ -121,6 +127,11 @@ SSA::Opcode const SSA::Instruction::getOpcode()
 	return op;
 }
 
+void SSA::Instruction::setOpcode(Opcode op)
+{
+	this->op = op;
+}
+
 SSA::Operand* const SSA::Instruction::getOperand1()
 {
 	return x;
@@ -0,0 +1,116 @@
+/*
+ * LoopForest.cpp
+ * Author: Joshua Cao
+ */
+
+#include "LoopForest.h"
+
+#include "BasicBlock.h"
+#include "DominatorTree.h"
+
+SSA::LoopForest::Loop::Loop(BasicBlock* header, Loop* parent)
+	: header(header), parent(parent), depth(parent ? parent->depth + 1 : 1)
+{
+	blocks.insert(header);
+}
+
+bool SSA::LoopForest::Loop::contains(BasicBlock* b) const
+{
+	return blocks.find(b) != blocks.cend();
+}
+
+/*
+ * headers dominate their loop bodies, so in reverse post order a header is
+ * visited before the headers of every loop nested in it. the innermost loop
+ * seen so far containing a header is therefore its parent
+ */
+SSA::LoopForest::LoopForest(DominatorTree* domTree)
+{
+	for (BasicBlock* header : domTree->getReversePostOrder())
+	{
+		std::list<BasicBlock*> latches;
+		for (BasicBlock* pred : header->getPredecessors())
+		{
+			if (domTree->dominates(header, pred))
+			{
+				latches.push_back(pred);
+			}
+		}
+		if (latches.empty())
+		{
+			continue;
+		}
+
+		Loop* loop = new Loop(header, getLoopFor(header));
+		loop->latches = latches;
+		loops.push_back(loop);
+		if (loop->parent)
+		{
+			loop->parent->children.push_back(loop);
+		}
+		else
+		{
+			topLevelLoops.push_back(loop);
+		}
+
+		// walk backwards from the latches until reaching the header
+		std::list<BasicBlock*> worklist = latches;
+		while (!worklist.empty())
+		{
+			BasicBlock* b = worklist.front();
+			worklist.pop_front();
+			if (loop->contains(b) || !domTree->isReachable(b))
+			{
+				continue;
+			}
+			loop->blocks.insert(b);
+			for (BasicBlock* pred : b->getPredecessors())
+			{
+				worklist.push_back(pred);
+			}
+		}
+		for (BasicBlock* b : loop->blocks)
+		{
+			innermostLoops[b] = loop;
+		}
+	}
+}
+
+SSA::LoopForest::~LoopForest()
+{
+	for (Loop* loop : loops)
+	{
+		delete loop;
+	}
+}
+
+std::list<SSA::LoopForest::Loop*> SSA::LoopForest::getLoops() const
+{
+	return loops;
+}
+
+std::list<SSA::LoopForest::Loop*> SSA::LoopForest::getTopLevelLoops() const
+{
+	return topLevelLoops;
+}
+
+SSA::LoopForest::Loop* SSA::LoopForest::getLoopFor(BasicBlock* b) const
+{
+	if (innermostLoops.find(b) == innermostLoops.cend())
+	{
+		return nullptr;
+	}
+	return innermostLoops.at(b);
+}
+
+int SSA::LoopForest::getLoopDepth(BasicBlock* b) const
+{
+	Loop* loop = getLoopFor(b);
+	return loop ? loop->depth : 0;
+}
+
+bool SSA::LoopForest::isLoopHeader(BasicBlock* b) const
+{
+	Loop* loop = getLoopFor(b);
+	return loop && loop->header == b;
+}
@@ -56,6 +56,28 @@ void SSA::Module::addOperand(Operand* o)
 	}
 }
 
+void SSA::Module::addArray(int offset, int size)
+{
+	arrays[offset] = size;
+}
+
+int SSA::Module::getArray(int address) const
+{
+	auto iter = arrays.upper_bound(address);
+	if (iter == arrays.cbegin())
+	{
+		return 0;
+	}
+	--iter;
+	return address < iter->first + iter->second ? iter->first : 0;
+}
+
+int SSA::Module::getArraySize(int offset) const
+{
+	auto iter = arrays.find(offset);
+	return iter == arrays.cend() ? 0 : iter->second;
+}
+
 void SSA::Module::cleanOperands()
 {
 	std::unordered_set<SSA::Operand*> deleteOps;
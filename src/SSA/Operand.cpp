@@ -72,9 +72,9 @@ SSA::Operand* SSA::Operand::getPhiArg(BasicBlock* b) const
 	return nullptr;
 }
 
-std::map<SSA::BasicBlock*, SSA::Operand*> SSA::Operand::getPhiArgs() const
+std::map<SSA::BasicBlock*, SSA::Operand*, SSA::BlockOrder> SSA::Operand::getPhiArgs() const
 {
-	return std::map<SSA::BasicBlock*, SSA::Operand*>();
+	return std::map<SSA::BasicBlock*, SSA::Operand*, SSA::BlockOrder>();
 }
 
 int SSA::Operand::getConst()
@@ -251,7 +251,7 @@ bool SSA::PhiOperand::containsArg(Operand* o)
 	return false;
 }
 
-std::map<SSA::BasicBlock*, SSA::Operand*> SSA::PhiOperand::getPhiArgs() const
+std::map<SSA::BasicBlock*, SSA::Operand*, SSA::BlockOrder> SSA::PhiOperand::getPhiArgs() const
 {
 	return args;
 }
@@ -261,6 +261,16 @@ void SSA::PhiOperand::addPhiArg(BasicBlock* b, Operand* o)
 	args[b] = o;
 }
 
+// used when the edge from oldBlock is rerouted through newBlock
+void SSA::PhiOperand::replacePhiBlock(BasicBlock* oldBlock, BasicBlock* newBlock)
+{
+	if (args.find(oldBlock) != args.cend())
+	{
+		args[newBlock] = args[oldBlock];
+		args.erase(oldBlock);
+	}
+}
+
 std::string SSA::PhiOperand::toStr()
 {
 	std::string s = "";
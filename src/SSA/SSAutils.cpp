@@ -5,7 +5,12 @@
 
 #include "SSAutils.h"
 
+#include "BasicBlock.h"
+#include "Function.h"
 #include "Instruction.h"
+#include "Module.h"
+#include "Operand.h"
+#include <unordered_set>
 
 std::string SSA::opToStr(Opcode op)
 {
@@ -39,3 +44,134 @@ std::string SSA::opToStr(Opcode op)
 	}
 	return "";
 }
+
+SSA::Operand* SSA::getMemoryAccessOffset(Instruction* i)
+{
+	if (i && (i->getOpcode() == store || i->getOpcode() == load))
+	{
+		Operand* memOp = i->getOperand1();
+		if (memOp->getType() == Operand::globalReg)
+		{
+			memOp = i->getOperand2();
+		}
+		if (memOp && memOp->getType() == Operand::val)
+		{
+			Instruction* adda = memOp->getInstruction();
+			if (adda && adda->getOpcode() == SSA::adda)
+			{
+				Operand* op1 = adda->getOperand1();
+				Operand* op2 = adda->getOperand2();
+				Operand* nonGlobal = nullptr;
+				if (op1->getType() == Operand::globalReg)
+				{
+					nonGlobal = op2;
+				}
+				else if (op2->getType() == Operand::globalReg)
+				{
+					nonGlobal = op1;
+				}
+				return nonGlobal;
+			}
+		}
+	}
+	return nullptr;
+}
+
+int SSA::getAccessedArray(Instruction* i)
+{
+	Operand* offset = getMemoryAccessOffset(i);
+	if (!offset || !i->getParent())
+	{
+		return 0;
+	}
+	Module* m = i->getParent()->getParent()->getParent();
+	if (offset->getType() == Operand::constant)
+	{
+		return m->getArray(offset->getConst());
+	}
+	if (offset->getType() == Operand::val && offset->getInstruction()->getOpcode() == add)
+	{
+		Operand* operands[2] = {offset->getInstruction()->getOperand1(), offset->getInstruction()->getOperand2()};
+		for (Operand* o : operands)
+		{
+			if (o->getType() == Operand::constant && o->getConst() != 0 && m->getArray(o->getConst()) == o->getConst())
+			{
+				return o->getConst();
+			}
+		}
+	}
+	return 0;
+}
+
+static void addValues(SSA::Operand* o, std::list<SSA::Instruction*>& values)
+{
+	if (!o)
+	{
+		return;
+	}
+	switch (o->getType())
+	{
+	case SSA::Operand::val:
+		values.push_back(o->getInstruction());
+		break;
+	case SSA::Operand::phi:
+	case SSA::Operand::call:
+		for (SSA::Operand* arg : o->getArgs())
+		{
+			addValues(arg, values);
+		}
+		break;
+	}
+}
+
+std::list<SSA::Instruction*> SSA::getValues(Instruction* i)
+{
+	std::list<Instruction*> values;
+	addValues(i->getOperand1(), values);
+	addValues(i->getOperand2(), values);
+	return values;
+}
+
+SSA::Function* SSA::getCallee(Instruction* i)
+{
+	Operand* o = i->getOperand1();
+	if (i->getOpcode() != call || !o || o->getType() != Operand::call)
+	{
+		return nullptr;
+	}
+	return o->getFunctionCall()->function;
+}
+
+std::list<SSA::Function*> SSA::getCallees(Function* f)
+{
+	std::list<Function*> callees;
+	std::unordered_set<Function*> seen;
+	for (BasicBlock* b : f->getBBs())
+	{
+		for (Instruction* i : b->getInstructions())
+		{
+			Function* callee = getCallee(i);
+			if (callee && seen.insert(callee).second)
+			{
+				callees.push_back(callee);
+			}
+		}
+	}
+	return callees;
+}
+
+bool SSA::isBranch(Opcode op)
+{
+	switch (op)
+	{
+	case bra:
+	case bne:
+	case beq:
+	case ble:
+	case blt:
+	case bge:
+	case bgt:
+		return true;
+	}
+	return false;
+}
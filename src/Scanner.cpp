@@ -5,7 +5,7 @@
 
 #include "Scanner.h"
 
-LexAnalysis::Scanner::Scanner(char const* s) : f(s), fname(s), tk(eof), num(0), linenum(1)
+LexAnalysis::Scanner::Scanner(char const* s) : f(s), lastTokenStart(0), fname(s), tk(eof), num(0), linenum(1)
 {
 	if (!f.is_open())
 	{
@@ -16,6 +16,49 @@ LexAnalysis::Scanner::Scanner(char const* s) : f(s), fname(s), tk(eof), num(0),
 }
 
 void LexAnalysis::Scanner::next()
+{
+	scan();
+	if (!recordingStarts.empty())
+	{
+		record();
+	}
+}
+
+// a token is its number, and its text if an identifier or number
+void LexAnalysis::Scanner::record()
+{
+	lastTokenStart = recorded.size();
+	recorded += std::to_string(tk);
+	if (tk == id_tk)
+	{
+		recorded += ' ' + id;
+	}
+	else if (tk == num_tk)
+	{
+		recorded += ' ' + std::to_string(num);
+	}
+	recorded += '\n';
+}
+
+void LexAnalysis::Scanner::startRecording()
+{
+	recordingStarts.push_back(recorded.size());
+	record();
+}
+
+std::string LexAnalysis::Scanner::stopRecording()
+{
+	std::string tokens = recorded.substr(recordingStarts.back(), lastTokenStart - recordingStarts.back());
+	recordingStarts.pop_back();
+	if (recordingStarts.empty())
+	{
+		recorded.clear();
+		lastTokenStart = 0;
+	}
+	return tokens;
+}
+
+void LexAnalysis::Scanner::scan()
 {
 	if (f.eof())
 	{
@@ -163,13 +206,13 @@ void LexAnalysis::Scanner::next()
 		case '\n':
 			++linenum;
 			c = f.get();	
-			next();
+			scan();
 			break;
 		case ' ':
 		case '\t':
 		case '\r':
 			c = f.get();
-			next();
+			scan();
 			break;
 		default:
 			err();
@@ -252,7 +295,7 @@ void LexAnalysis::Scanner::comment()
 	{
 		c = f.get();
 	}
-	next();
+	scan();
 }
 
 char const* LexAnalysis::tkToStr(Token tk)
@@ -0,0 +1,291 @@
+/*
+ * Server.cpp
+ * Author: Joshua Cao
+ */
+
+#include "Server.h"
+#include "ServerProtocol.h"
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+
+static std::string listeningPath;
+// written to when a child exits, so the server waits on children and sockets at once
+static int childExited[2];
+
+static void stop(int)
+{
+	unlink(listeningPath.c_str());
+	_exit(0);
+}
+
+static void onChildExit(int)
+{
+	int savedErrno = errno;
+	char byte = 0;
+	(void) !write(childExited[1], &byte, 1);
+	errno = savedErrno;
+}
+
+// @return false if the request is malformed
+static bool readRequest(int connection, int* fds, std::string& dir, std::vector<std::string>& args)
+{
+	std::string hello, numArgs;
+	if (!ServerProtocol::receiveDescriptors(connection, fds, 3))
+	{
+		return false;
+	}
+	if (!ServerProtocol::readFrame(connection, hello) || hello != ServerProtocol::HELLO
+			|| !ServerProtocol::readFrame(connection, dir) || !ServerProtocol::readFrame(connection, numArgs))
+	{
+		return false;
+	}
+	long count = atol(numArgs.c_str());
+	for (long i = 0; i < count; ++i)
+	{
+		args.push_back("");
+		if (!ServerProtocol::readFrame(connection, args.back()))
+		{
+			return false;
+		}
+	}
+	return count >= 0;
+}
+
+/*
+ * a spare waits for the server to hand it a connection, then becomes the
+ * compiler of that request. the server answers once it exits
+ */
+static void runSpare(int handOff, std::function<int(int, char**)>& compile)
+{
+	int connection;
+	if (!ServerProtocol::receiveDescriptors(handOff, &connection, 1))
+	{
+		// the server stopped
+		_exit(0);
+	}
+	close(handOff);
+	int fds[3];
+	std::string dir;
+	std::vector<std::string> args;
+	if (!readRequest(connection, fds, dir, args))
+	{
+		ServerProtocol::writeFrame(connection, "error malformed request");
+		_exit(1);
+	}
+	close(connection);
+	for (int i = 0; i < 3; ++i)
+	{
+		dup2(fds[i], i);
+		close(fds[i]);
+	}
+	if (chdir(dir.c_str()) != 0)
+	{
+		fprintf(stderr, "cannot change to directory %s\n", dir.c_str());
+		_exit(1);
+	}
+	std::vector<char*> argv;
+	argv.push_back(const_cast<char*>("compiler"));
+	for (std::string& arg : args)
+	{
+		argv.push_back(&arg[0]);
+	}
+	argv.push_back(nullptr);
+	// exit, not _exit, so queued files are written
+	exit(compile(argv.size() - 1, argv.data()));
+}
+
+// @return pid of the new spare, and the server's end of its hand off socket in handOff
+static pid_t forkSpare(int listening, const std::unordered_map<pid_t, int>& requests,
+		std::function<int(int, char**)>& compile, int& handOff)
+{
+	int sockets[2];
+	if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sockets) != 0)
+	{
+		return -1;
+	}
+	pid_t spare = fork();
+	if (spare == 0)
+	{
+		close(sockets[0]);
+		close(listening);
+		close(childExited[0]);
+		close(childExited[1]);
+		for (auto request : requests)
+		{
+			close(request.second);
+		}
+		signal(SIGINT, SIG_DFL);
+		signal(SIGTERM, SIG_DFL);
+		signal(SIGCHLD, SIG_DFL);
+		signal(SIGPIPE, SIG_DFL);
+		runSpare(sockets[1], compile);
+	}
+	close(sockets[1]);
+	if (spare < 0)
+	{
+		close(sockets[0]);
+		return -1;
+	}
+	handOff = sockets[0];
+	return spare;
+}
+
+// @return the listening socket, or -1
+static int listenOn(const std::string& path)
+{
+	sockaddr_un address = {};
+	address.sun_family = AF_UNIX;
+	if (path.size() >= sizeof(address.sun_path))
+	{
+		fprintf(stderr, "socket path %s is too long\n", path.c_str());
+		return -1;
+	}
+	strcpy(address.sun_path, path.c_str());
+	int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (fd < 0)
+	{
+		perror("socket");
+		return -1;
+	}
+	bool bound = bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+	if (!bound && errno == EADDRINUSE)
+	{
+		int probe = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+		bool running = connect(probe, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+		close(probe);
+		if (running)
+		{
+			fprintf(stderr, "a compiler server is already listening on %s\n", path.c_str());
+			close(fd);
+			return -1;
+		}
+		unlink(path.c_str());
+		bound = bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+	}
+	if (!bound)
+	{
+		fprintf(stderr, "cannot bind %s: %s\n", path.c_str(), strerror(errno));
+		close(fd);
+		return -1;
+	}
+	if (listen(fd, SOMAXCONN) != 0)
+	{
+		fprintf(stderr, "cannot listen on %s: %s\n", path.c_str(), strerror(errno));
+		close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+/*
+ * the server only accepts connections, hands them to spares and answers
+ * with the exit status of their compiler, so no request waits for a fork
+ * or for another request
+ */
+int runServer(std::string socketPath, std::function<int(int, char**)> compile)
+{
+	int listening = listenOn(socketPath);
+	if (listening < 0 || pipe2(childExited, O_CLOEXEC | O_NONBLOCK) != 0)
+	{
+		return 1;
+	}
+	listeningPath = socketPath;
+	signal(SIGINT, stop);
+	signal(SIGTERM, stop);
+	signal(SIGCHLD, onChildExit);
+	// a client that went away does not stop the server
+	signal(SIGPIPE, SIG_IGN);
+	fprintf(stderr, "listening on %s\n", socketPath.c_str());
+
+	// connection of every running compiler
+	std::unordered_map<pid_t, int> requests;
+	int handOff = -1;
+	pid_t spare = -1;
+	while (true)
+	{
+		if (spare < 0)
+		{
+			spare = forkSpare(listening, requests, compile, handOff);
+		}
+		std::vector<pollfd> fds = {{listening, POLLIN, 0}, {childExited[0], POLLIN, 0}};
+		std::vector<pid_t> pids;
+		for (auto request : requests)
+		{
+			// the request itself is read by the compiler, only a closed connection matters here
+			fds.push_back({request.second, POLLRDHUP, 0});
+			pids.push_back(request.first);
+		}
+		if (poll(fds.data(), fds.size(), -1) < 0)
+		{
+			continue;
+		}
+		for (std::size_t i = 2; i < fds.size(); ++i)
+		{
+			if (fds[i].revents)
+			{
+				kill(pids[i - 2], SIGTERM);
+			}
+		}
+		if (fds[1].revents)
+		{
+			char bytes[64];
+			while (read(childExited[0], bytes, sizeof(bytes)) > 0)
+			{
+			}
+			int status;
+			pid_t child;
+			while ((child = waitpid(-1, &status, WNOHANG)) > 0)
+			{
+				if (child == spare)
+				{
+					close(handOff);
+					spare = -1;
+					continue;
+				}
+				auto request = requests.find(child);
+				if (request == requests.end())
+				{
+					continue;
+				}
+				if (WIFSIGNALED(status))
+				{
+					ServerProtocol::writeFrame(request->second, "signal " + std::to_string(WTERMSIG(status)));
+				}
+				else
+				{
+					ServerProtocol::writeFrame(request->second, "exit " + std::to_string(WEXITSTATUS(status)));
+				}
+				close(request->second);
+				requests.erase(request);
+			}
+		}
+		if (fds[0].revents)
+		{
+			int connection = accept4(listening, nullptr, nullptr, SOCK_CLOEXEC);
+			if (connection < 0)
+			{
+				continue;
+			}
+			if (spare < 0 || !ServerProtocol::sendDescriptors(handOff, &connection, 1))
+			{
+				ServerProtocol::writeFrame(connection, "error cannot start the compiler");
+				close(connection);
+				continue;
+			}
+			close(handOff);
+			requests[spare] = connection;
+			spare = -1;
+		}
+	}
+}
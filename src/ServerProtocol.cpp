@@ -0,0 +1,132 @@
+/*
+ * ServerProtocol.cpp
+ * Author: Joshua Cao
+ */
+
+#include "ServerProtocol.h"
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <sys/socket.h>
+#include <unistd.h>
+
+std::string ServerProtocol::defaultSocketPath()
+{
+	const char* path = getenv("COMPILER_SERVER");
+	if (path && *path)
+	{
+		return path;
+	}
+	return "/tmp/compiler-" + std::to_string(getuid()) + ".sock";
+}
+
+static bool writeAll(int fd, const char* data, std::size_t size)
+{
+	while (size > 0)
+	{
+		ssize_t written = write(fd, data, size);
+		if (written < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		if (written <= 0)
+		{
+			return false;
+		}
+		data += written;
+		size -= written;
+	}
+	return true;
+}
+
+static bool readAll(int fd, char* data, std::size_t size)
+{
+	while (size > 0)
+	{
+		ssize_t bytes = read(fd, data, size);
+		if (bytes < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		if (bytes <= 0)
+		{
+			return false;
+		}
+		data += bytes;
+		size -= bytes;
+	}
+	return true;
+}
+
+bool ServerProtocol::writeFrame(int fd, const std::string& frame)
+{
+	char length[4];
+	for (int i = 0; i < 4; ++i)
+	{
+		length[i] = char(uint32_t(frame.size()) >> (8 * i));
+	}
+	return writeAll(fd, length, 4) && writeAll(fd, frame.data(), frame.size());
+}
+
+bool ServerProtocol::readFrame(int fd, std::string& frame)
+{
+	char length[4];
+	if (!readAll(fd, length, 4))
+	{
+		return false;
+	}
+	uint32_t size = 0;
+	for (int i = 0; i < 4; ++i)
+	{
+		size |= uint32_t(uint8_t(length[i])) << (8 * i);
+	}
+	if (size > MAX_FRAME)
+	{
+		return false;
+	}
+	frame.resize(size);
+	return readAll(fd, &frame[0], size);
+}
+
+bool ServerProtocol::sendDescriptors(int socket, const int* fds, int count)
+{
+	char byte = 0;
+	iovec data = {&byte, 1};
+	std::string control(CMSG_SPACE(count * sizeof(int)), '\0');
+	msghdr message = {};
+	message.msg_iov = &data;
+	message.msg_iovlen = 1;
+	message.msg_control = &control[0];
+	message.msg_controllen = control.size();
+	cmsghdr* header = CMSG_FIRSTHDR(&message);
+	header->cmsg_level = SOL_SOCKET;
+	header->cmsg_type = SCM_RIGHTS;
+	header->cmsg_len = CMSG_LEN(count * sizeof(int));
+	memcpy(CMSG_DATA(header), fds, count * sizeof(int));
+	return sendmsg(socket, &message, 0) == 1;
+}
+
+bool ServerProtocol::receiveDescriptors(int socket, int* fds, int count)
+{
+	char byte;
+	iovec data = {&byte, 1};
+	std::string control(CMSG_SPACE(count * sizeof(int)), '\0');
+	msghdr message = {};
+	message.msg_iov = &data;
+	message.msg_iovlen = 1;
+	message.msg_control = &control[0];
+	message.msg_controllen = control.size();
+	if (recvmsg(socket, &message, MSG_CMSG_CLOEXEC) != 1 || (message.msg_flags & MSG_CTRUNC))
+	{
+		return false;
+	}
+	cmsghdr* header = CMSG_FIRSTHDR(&message);
+	if (!header || header->cmsg_level != SOL_SOCKET || header->cmsg_type != SCM_RIGHTS
+			|| header->cmsg_len != CMSG_LEN(count * sizeof(int)))
+	{
+		return false;
+	}
+	memcpy(fds, CMSG_DATA(header), count * sizeof(int));
+	return true;
+}
@@ -0,0 +1,123 @@
+/*
+ * X86.cpp
+ * Author: Joshua Cao
+ */
+
+#include "X86.h"
+#include <cstring>
+
+const std::vector<uint8_t>& X86::Assembler::getCode() const
+{
+	return code;
+}
+
+int X86::Assembler::size() const
+{
+	return code.size();
+}
+
+void X86::Assembler::emitByte(uint8_t b)
+{
+	code.push_back(b);
+}
+
+void X86::Assembler::emitImm32(int32_t imm)
+{
+	for (int k = 0; k < 4; ++k)
+	{
+		emitByte(uint32_t(imm) >> (8 * k));
+	}
+}
+
+void X86::Assembler::emitRex(bool w, int reg, int index, int base)
+{
+	uint8_t rex = 0x40 | (w ? 8 : 0) | (reg & 8 ? 4 : 0) | (index & 8 ? 2 : 0) | (base & 8 ? 1 : 0);
+	if (rex != 0x40)
+	{
+		emitByte(rex);
+	}
+}
+
+void X86::Assembler::emitRegOp(std::vector<uint8_t> opcode, int reg, int rm, bool w)
+{
+	emitRex(w, reg, 0, rm);
+	for (uint8_t b : opcode)
+	{
+		emitByte(b);
+	}
+	emitByte(0xC0 | (reg & 7) << 3 | (rm & 7));
+}
+
+void X86::Assembler::emitMemOp(std::vector<uint8_t> opcode, int reg, int base, int index, int32_t disp, bool w)
+{
+	emitRex(w, reg, index < 0 ? 0 : index, base);
+	for (uint8_t b : opcode)
+	{
+		emitByte(b);
+	}
+	if (index < 0 && (base & 7) != RSP)
+	{
+		emitByte(0x80 | (reg & 7) << 3 | (base & 7));
+	}
+	else
+	{
+		emitByte(0x80 | (reg & 7) << 3 | RSP);
+		emitByte(((index < 0 ? RSP : index) & 7) << 3 | (base & 7));
+	}
+	emitImm32(disp);
+}
+
+void X86::Assembler::emitMov(int dst, int src)
+{
+	if (dst != src)
+	{
+		emitRegOp({0x89}, src, dst);
+	}
+}
+
+void X86::Assembler::emitMovImm(int dst, int32_t imm)
+{
+	emitRex(false, 0, 0, dst);
+	emitByte(0xB8 + (dst & 7));
+	emitImm32(imm);
+}
+
+void X86::Assembler::emitMovImm64(int dst, uint64_t imm)
+{
+	emitRex(true, 0, 0, dst);
+	emitByte(0xB8 + (dst & 7));
+	for (int k = 0; k < 8; ++k)
+	{
+		emitByte(imm >> (8 * k));
+	}
+}
+
+void X86::Assembler::emitPush(int r)
+{
+	emitRex(false, 0, 0, r);
+	emitByte(0x50 + (r & 7));
+}
+
+void X86::Assembler::emitPop(int r)
+{
+	emitRex(false, 0, 0, r);
+	emitByte(0x58 + (r & 7));
+}
+
+int X86::Assembler::emitJump(std::vector<uint8_t> opcode)
+{
+	for (uint8_t b : opcode)
+	{
+		emitByte(b);
+	}
+	int pos = code.size();
+	emitImm32(0);
+	return pos;
+}
+
+void X86::Assembler::patch(int pos, int target)
+{
+	int32_t rel = target - (pos + 4);
+	memcpy(&code[pos], &rel, 4);
+}
+
@@ -0,0 +1,642 @@
+/*
+ * X86Gen.cpp
+ * Author: Joshua Cao
+ */
+
+#include "X86Gen.h"
+#include "Liveness.h"
+#include "RegAlloc.h"
+#include "SSAutils.h"
+#include <iostream>
+
+static_assert(NUM_REG <= 6, "x86-64 code maps allocator registers onto the six callee saved registers");
+
+X86Gen::X86Gen(SSA::Module* ir) : ir(ir), runtime(), globalSize(0), f(nullptr), frameBytes(0), numPops(0)
+{
+	for (SSA::Function* func : ir->getFuncs())
+	{
+		globalSize = std::max(globalSize, -func->getLocalVariableOffset());
+	}
+
+	// values of one function read by another get a word below the arrays
+	for (SSA::Function* func : ir->getFuncs())
+	{
+		for (SSA::BasicBlock* b : func->getBBs())
+		{
+			for (SSA::Instruction* i : b->getInstructions())
+			{
+				for (SSA::Instruction* value : SSA::getValues(i))
+				{
+					if (value->getParent()->getParent() != func && value->getOpcode() != SSA::constant
+							&& exports.find(value) == exports.cend())
+					{
+						globalSize += 4;
+						exports[value] = -globalSize;
+					}
+				}
+			}
+		}
+	}
+}
+
+int X86Gen::getGlobalSize() const
+{
+	return globalSize;
+}
+
+const std::vector<uint8_t>& X86Gen::getCode() const
+{
+	return as.getCode();
+}
+
+void X86Gen::generate(const Runtime& runtime)
+{
+	this->runtime = runtime;
+	SSA::Function* main = ir->getFunction("main");
+	if (!main)
+	{
+		std::cerr << "no main function" << std::endl;
+		exit(1);
+	}
+	clobbers = getClobberedRegs(ir);
+
+	// entry from C keeps the callee saved registers of the caller
+	const int calleeSaved[] = {X86::RBX, X86::RBP, X86::R12, X86::R13, X86::R14, X86::R15};
+	for (int r : calleeSaved)
+	{
+		as.emitPush(r);
+	}
+	// registers start at 0, as in the interpreter
+	for (int r : calleeSaved)
+	{
+		as.emitRegOp({0x31}, r, r);
+	}
+	as.emitRegOp({0x81}, 5, X86::RSP, true);
+	as.emitImm32(8);
+	calls.push_back(std::make_pair(as.emitJump({0xE8}), main));
+	as.emitRegOp({0x81}, 0, X86::RSP, true);
+	as.emitImm32(8);
+	for (int k = 5; k >= 0; --k)
+	{
+		as.emitPop(calleeSaved[k]);
+	}
+	as.emitByte(0xC3);
+
+	for (SSA::Function* func : ir->getFuncs())
+	{
+		if (!func->isBuiltin())
+		{
+			generate(func);
+		}
+	}
+	for (auto call : calls)
+	{
+		as.patch(call.first, entries[call.second]);
+	}
+}
+
+void X86Gen::generate(SSA::Function* func)
+{
+	f = func;
+	frameBytes = (f->getFrameSize() + 7) / 8 * 8;
+	numPops = 0;
+	numUses.clear();
+	savedRegs = getRegsLiveAcrossCalls(f, clobbers);
+	entries[f] = as.size();
+
+	std::list<SSA::BasicBlock*> BBs = f->getBBs();
+	for (SSA::BasicBlock* b : BBs)
+	{
+		for (SSA::Instruction* i : b->getInstructions())
+		{
+			for (SSA::Instruction* value : SSA::getValues(i))
+			{
+				numUses[value] += 1;
+			}
+		}
+	}
+
+	if (frameBytes)
+	{
+		as.emitRegOp({0x81}, 5, X86::RSP, true);
+		as.emitImm32(frameBytes);
+		// slots start at 0, as in the interpreter: rep stosq from rsp
+		as.emitRegOp({0x89}, X86::RSP, X86::RDI, true);
+		as.emitMovImm(X86::RCX, frameBytes / 8);
+		as.emitRegOp({0x31}, X86::RAX, X86::RAX);
+		as.emitByte(0xF3);
+		as.emitByte(0x48);
+		as.emitByte(0xAB);
+	}
+
+	// jumps are patched once every block has an offset
+	std::unordered_map<SSA::BasicBlock*, int> offsets;
+	std::list<std::pair<int, SSA::BasicBlock*>> targets;
+	for (auto bIter = BBs.begin(); bIter != BBs.end(); ++bIter)
+	{
+		SSA::BasicBlock* b = *bIter;
+		SSA::BasicBlock* next = std::next(bIter) == BBs.end() ? nullptr : *std::next(bIter);
+		offsets[b] = as.size();
+
+		std::list<SSA::Instruction*>& instructions = b->getInstructions();
+		std::list<SSA::Instruction*> moves;
+		SSA::Instruction* branch = nullptr;
+		int condition = X86::RAX;
+		SSA::Instruction* prev = nullptr;
+		for (auto iter = instructions.begin(); iter != instructions.end(); ++iter)
+		{
+			SSA::Instruction* i = *iter;
+			SSA::Instruction* nextIns = std::next(iter) == instructions.end() ? nullptr : *std::next(iter);
+			if (i->getOpcode() == SSA::move)
+			{
+				moves.push_back(i);
+			}
+			else if (SSA::isBranch(i->getOpcode()))
+			{
+				// later moves could overwrite the condition
+				branch = i;
+				if (i->getOperand1())
+				{
+					condition = use(i->getOperand1(), X86::R11);
+					if (nextIns && condition != X86::R11)
+					{
+						as.emitMov(X86::R11, condition);
+						condition = X86::R11;
+					}
+				}
+			}
+			else if (i->getOpcode() != SSA::phi)
+			{
+				generateMoves(moves);
+				moves.clear();
+				generate(i, prev, nextIns);
+			}
+			prev = i;
+		}
+		generateMoves(moves);
+
+		// the branch target is the second successor, otherwise fall through
+		// to the first
+		std::list<SSA::BasicBlock*> succs = b->getSuccessors();
+		if (succs.empty())
+		{
+			if (!prev || (prev->getOpcode() != SSA::ret && prev->getOpcode() != SSA::end))
+			{
+				generateReturn(nullptr);
+			}
+			continue;
+		}
+		SSA::BasicBlock* fallThrough = succs.front();
+		if (branch && branch->getOpcode() == SSA::bra)
+		{
+			fallThrough = succs.back();
+		}
+		else if (branch && succs.size() > 1)
+		{
+			uint8_t cc;
+			switch (branch->getOpcode())
+			{
+			case SSA::bne: cc = X86::JNE; break;
+			case SSA::beq: cc = X86::JE; break;
+			case SSA::ble: cc = X86::JLE; break;
+			case SSA::blt: cc = X86::JL; break;
+			case SSA::bge: cc = X86::JGE; break;
+			default: cc = X86::JG; break;
+			}
+			as.emitRegOp({0x85}, condition, condition);
+			targets.push_back(std::make_pair(as.emitJump({0x0F, cc}), *std::next(succs.begin())));
+		}
+		if (fallThrough != next)
+		{
+			targets.push_back(std::make_pair(as.emitJump({0xE9}), fallThrough));
+		}
+	}
+	for (auto target : targets)
+	{
+		as.patch(target.first, offsets[target.second]);
+	}
+}
+
+void X86Gen::generate(SSA::Instruction* i, SSA::Instruction* prev, SSA::Instruction* next)
+{
+	SSA::Operand* x = i->getOperand1();
+	SSA::Operand* y = i->getOperand2();
+	switch (i->getOpcode())
+	{
+	case SSA::add:
+	case SSA::sub:
+	case SSA::mul:
+	case SSA::div:
+	case SSA::cmp:
+		generateArithmetic(i);
+		break;
+	case SSA::adda:
+	{
+		// addresses are offsets from the global register
+		bool xGlobal = x->getType() == SSA::Operand::globalReg;
+		bool yGlobal = y->getType() == SSA::Operand::globalReg;
+		if (xGlobal == yGlobal)
+		{
+			generateArithmetic(i);
+		}
+		else if (!isFused(i, next))
+		{
+			as.emitMov(dest(i), use(xGlobal ? y : x, X86::RAX));
+		}
+		break;
+	}
+	case SSA::constant:
+		if (i->getReg() < 0 && exports.find(i) == exports.cend())
+		{
+			return;
+		}
+		as.emitMovImm(dest(i), x->getConst());
+		break;
+	case SSA::load:
+	case SSA::store:
+		generateMemoryAccess(i, prev);
+		break;
+	case SSA::read:
+		callHelper(runtime.inputNum);
+		as.emitMov(dest(i), X86::RAX);
+		break;
+	case SSA::write:
+		as.emitMov(X86::RDI, use(x, X86::RDI));
+		callHelper(runtime.outputNum);
+		break;
+	case SSA::writeNL:
+		callHelper(runtime.outputNewLine);
+		break;
+	case SSA::call:
+		generateCall(i);
+		break;
+	case SSA::pop:
+		if (i->getReg() >= 0 || exports.find(i) != exports.cend())
+		{
+			as.emitMemOp({0x8B}, dest(i), X86::RSP, -1, frameBytes + 8 + 8 * numPops);
+		}
+		++numPops;
+		break;
+	case SSA::ret:
+		generateReturn(x);
+		break;
+	case SSA::end:
+		generateReturn(nullptr);
+		break;
+	}
+	exportValue(i);
+}
+
+/*
+ * moves are a parallel copy, see insertMoveBeforePhi. moves between
+ * registers are ordered first, then the rest, which only write registers
+ */
+void X86Gen::generateMoves(std::list<SSA::Instruction*> moves)
+{
+	std::list<std::pair<int, int>> parallel;
+	std::list<SSA::Instruction*> rest;
+	for (SSA::Instruction* move : moves)
+	{
+		SSA::Operand* src = move->getOperand1();
+		int c;
+		if (move->getReg() < 0)
+		{
+			continue;
+		}
+		if (src->getType() == SSA::Operand::val && !getConst(src, c)
+				&& src->getInstruction()->getParent()->getParent() == f)
+		{
+			parallel.push_back(std::make_pair(move->getReg(), src->getInstruction()->getReg()));
+		}
+		else
+		{
+			rest.push_back(move);
+		}
+	}
+	for (auto move : sequentializeMoves(parallel, NUM_REG))
+	{
+		as.emitMov(reg(move.first), reg(move.second));
+	}
+	for (SSA::Instruction* move : rest)
+	{
+		as.emitMov(dest(move), use(move->getOperand1(), dest(move)));
+	}
+}
+
+// the result is computed in eax, so it may share a register with an operand
+void X86Gen::generateArithmetic(SSA::Instruction* i)
+{
+	SSA::Opcode op = i->getOpcode();
+	SSA::Operand* x = i->getOperand1();
+	SSA::Operand* y = i->getOperand2();
+	int c;
+	if ((op == SSA::add || op == SSA::mul || op == SSA::adda) && getConst(x, c) && !getConst(y, c))
+	{
+		std::swap(x, y);
+	}
+	if (x->getType() == SSA::Operand::globalReg)
+	{
+		std::swap(x, y);
+	}
+
+	int xReg = use(x, X86::RSI);
+	bool isImm = getConst(y, c) || y->getType() == SSA::Operand::globalReg;
+	if (y->getType() == SSA::Operand::globalReg)
+	{
+		c = 0;
+	}
+	switch (op)
+	{
+	case SSA::add:
+	case SSA::adda:
+	case SSA::sub:
+	{
+		int ext = op == SSA::sub ? 5 : 0;
+		as.emitMov(X86::RAX, xReg);
+		if (isImm)
+		{
+			as.emitRegOp({0x81}, ext, X86::RAX);
+			as.emitImm32(c);
+		}
+		else
+		{
+			as.emitRegOp({uint8_t(op == SSA::sub ? 0x29 : 0x01)}, use(y, X86::RDI), X86::RAX);
+		}
+		break;
+	}
+	case SSA::mul:
+		if (isImm)
+		{
+			as.emitRegOp({0x69}, X86::RAX, xReg);
+			as.emitImm32(c);
+		}
+		else
+		{
+			int yReg = use(y, X86::RDI);
+			as.emitMov(X86::RAX, xReg);
+			as.emitRegOp({0x0F, 0xAF}, X86::RAX, yReg);
+		}
+		break;
+	case SSA::div:
+	{
+		int yReg = use(y, X86::RCX);
+		as.emitRegOp({0x85}, yReg, yReg);
+		int skip = as.emitJump({0x0F, X86::JNE});
+		callHelper(runtime.divisionByZero);
+		as.patch(skip, as.size());
+		as.emitMov(X86::RAX, xReg);
+		as.emitByte(0x99);
+		as.emitRegOp({0xF7}, 7, yReg);
+		break;
+	}
+	case SSA::cmp:
+		if (isImm)
+		{
+			as.emitRegOp({0x81}, 7, xReg);
+			as.emitImm32(c);
+		}
+		else
+		{
+			as.emitRegOp({0x39}, use(y, X86::RDI), xReg);
+		}
+		// eax = (x > y) - (x < y)
+		for (uint8_t b : {0x0F, 0x9F, 0xC0, 0x0F, 0x9C, 0xC1, 0x0F, 0xB6, 0xC0, 0x0F, 0xB6, 0xC9})
+		{
+			as.emitByte(b);
+		}
+		as.emitRegOp({0x29}, X86::RCX, X86::RAX);
+		break;
+	}
+	as.emitMov(dest(i), X86::RAX);
+}
+
+/*
+ * an adda only used by the load or store right after it is not computed,
+ * the access reads its offset operand instead
+ */
+bool X86Gen::isFused(SSA::Instruction* adda, SSA::Instruction* memAccess)
+{
+	if (!memAccess || (memAccess->getOpcode() != SSA::load && memAccess->getOpcode() != SSA::store)
+			|| numUses[adda] != 1 || exports.find(adda) != exports.cend())
+	{
+		return false;
+	}
+	SSA::Operand* address = memAccess->getOperand1();
+	return address && address->getType() == SSA::Operand::val && address->getInstruction() == adda;
+}
+
+/*
+ * constant offsets address spill slots, if non negative, or array elements
+ * directly. otherwise the offset is checked against the accessed array, or
+ * the whole global buffer if the array is unknown, and added to the base of
+ * the buffer
+ */
+void X86Gen::generateMemoryAccess(SSA::Instruction* i, SSA::Instruction* prev)
+{
+	bool isLoad = i->getOpcode() == SSA::load;
+	int value = isLoad ? dest(i) : use(i->getOperand2(), X86::RAX);
+	std::vector<uint8_t> opcode = {uint8_t(isLoad ? 0x8B : 0x89)};
+	SSA::Operand* address = i->getOperand1();
+	SSA::Operand* offset = SSA::getMemoryAccessOffset(i);
+	int c;
+	if (offset && address->getType() == SSA::Operand::val && getConst(offset, c) && c >= 0)
+	{
+		as.emitMemOp(opcode, value, X86::RSP, -1, c);
+		return;
+	}
+
+	as.emitMovImm64(X86::R10, runtime.globalReg);
+	if (offset && address->getType() == SSA::Operand::val && getConst(offset, c))
+	{
+		if (c < -globalSize)
+		{
+			callHelper(runtime.outOfBounds);
+		}
+		as.emitMemOp(opcode, value, X86::R10, -1, c);
+		return;
+	}
+	int array = SSA::getAccessedArray(i);
+	int size = array ? ir->getArraySize(array) : 0;
+	if (!size)
+	{
+		array = -globalSize;
+		size = globalSize;
+	}
+	// the adda was skipped only if it is right before this access
+	if (offset && prev && prev->getOpcode() == SSA::adda && isFused(prev, i))
+	{
+		address = offset;
+	}
+	// ecx = offset - array, which is in bounds if below size as unsigned
+	as.emitMov(X86::RCX, use(address, X86::RCX));
+	as.emitRegOp({0x81}, 0, X86::RCX);
+	as.emitImm32(-array);
+	as.emitRegOp({0x81}, 7, X86::RCX);
+	as.emitImm32(size);
+	int inBounds = as.emitJump({0x0F, X86::JB});
+	callHelper(runtime.outOfBounds);
+	as.patch(inBounds, as.size());
+	as.emitMemOp(opcode, value, X86::R10, X86::RCX, array);
+}
+
+void X86Gen::generateCall(SSA::Instruction* i)
+{
+	SSA::Operand::FunctionCall* call = i->getOperand1()->getFunctionCall();
+	std::string name = call->function->getName();
+	if (name == "InputNum")
+	{
+		callHelper(runtime.inputNum);
+		as.emitMov(dest(i), X86::RAX);
+		return;
+	}
+	if (name == "OutputNum")
+	{
+		if (call->args.empty())
+		{
+			as.emitMovImm(X86::RDI, 0);
+		}
+		else
+		{
+			as.emitMov(X86::RDI, use(call->args.front(), X86::RDI));
+		}
+		callHelper(runtime.outputNum);
+		return;
+	}
+	if (name == "OutputNewLine")
+	{
+		callHelper(runtime.outputNewLine);
+		return;
+	}
+
+	std::vector<int>& saved = savedRegs[i];
+	for (int r : saved)
+	{
+		as.emitPush(reg(r));
+	}
+	for (auto iter = call->args.rbegin(); iter != call->args.rend(); ++iter)
+	{
+		as.emitPush(use(*iter, X86::RAX));
+	}
+	calls.push_back(std::make_pair(as.emitJump({0xE8}), call->function));
+	if (!call->args.empty())
+	{
+		as.emitRegOp({0x81}, 0, X86::RSP, true);
+		as.emitImm32(8 * call->args.size());
+	}
+	for (auto iter = saved.rbegin(); iter != saved.rend(); ++iter)
+	{
+		as.emitPop(reg(*iter));
+	}
+	if (i->hasOutput())
+	{
+		as.emitMov(dest(i), X86::RAX);
+	}
+}
+
+void X86Gen::generateReturn(SSA::Operand* value)
+{
+	if (value)
+	{
+		as.emitMov(X86::RAX, use(value, X86::RAX));
+	}
+	if (frameBytes)
+	{
+		as.emitRegOp({0x81}, 0, X86::RSP, true);
+		as.emitImm32(frameBytes);
+	}
+	as.emitByte(0xC3);
+}
+
+/*
+ * C calls need a 16 byte aligned stack, so the old rsp is pushed twice after
+ * aligning and reloaded afterwards
+ */
+void X86Gen::callHelper(uint64_t helper)
+{
+	as.emitRegOp({0x89}, X86::RSP, X86::RAX, true);
+	as.emitRegOp({0x83}, 4, X86::RSP, true);
+	as.emitByte(0xF0);
+	as.emitPush(X86::RAX);
+	as.emitPush(X86::RAX);
+	as.emitMovImm64(X86::RAX, helper);
+	as.emitRegOp({0xFF}, 2, X86::RAX);
+	as.emitMemOp({0x8B}, X86::RSP, X86::RSP, -1, 0, true);
+}
+
+void X86Gen::exportValue(SSA::Instruction* i)
+{
+	if (exports.find(i) != exports.cend())
+	{
+		as.emitMovImm64(X86::R10, runtime.globalReg);
+		as.emitMemOp({0x89}, dest(i), X86::R10, -1, exports[i]);
+	}
+}
+
+// constants, including constant instructions of other functions
+bool X86Gen::getConst(SSA::Operand* o, int& c)
+{
+	if (o->getType() == SSA::Operand::constant)
+	{
+		c = o->getConst();
+		return true;
+	}
+	if (o->getType() == SSA::Operand::val && o->getInstruction()->getOpcode() == SSA::constant)
+	{
+		c = o->getInstruction()->getOperand1()->getConst();
+		return true;
+	}
+	return false;
+}
+
+// @return register holding o, which is loaded into scratch if needed
+int X86Gen::use(SSA::Operand* o, int scratch)
+{
+	int c;
+	if (getConst(o, c))
+	{
+		as.emitMovImm(scratch, c);
+		return scratch;
+	}
+	switch (o->getType())
+	{
+	case SSA::Operand::globalReg:
+		as.emitMovImm(scratch, 0);
+		return scratch;
+	case SSA::Operand::val:
+	{
+		SSA::Instruction* i = o->getInstruction();
+		if (i->getParent()->getParent() != f)
+		{
+			if (exports.find(i) == exports.cend())
+			{
+				std::cerr << "no export for {" << i->toStr() << "}" << std::endl;
+				exit(1);
+			}
+			as.emitMovImm64(X86::R10, runtime.globalReg);
+			as.emitMemOp({0x8B}, scratch, X86::R10, -1, exports[i]);
+			return scratch;
+		}
+		if (i->getReg() < 0)
+		{
+			std::cerr << "no register for {" << i->toStr() << "}" << std::endl;
+			exit(1);
+		}
+		return reg(i->getReg());
+	}
+	}
+	std::cerr << "cannot compile operand " << o->toStr() << std::endl;
+	exit(1);
+}
+
+// dead values are written to eax
+int X86Gen::dest(SSA::Instruction* i)
+{
+	return i->getReg() < 0 ? X86::RAX : reg(i->getReg());
+}
+
+// NUM_REG is the scratch register of sequentializeMoves
+int X86Gen::reg(int allocReg)
+{
+	static const int regs[] = {X86::RBX, X86::RBP, X86::R12, X86::R13, X86::R14, X86::R15};
+	return allocReg == NUM_REG ? X86::RAX : regs[allocReg];
+}
@@ -3,27 +3,412 @@
  * Author: Joshua Cao
  */
 
+#include <AsyncWriter.h>
+#include <BinaryIR.h>
+#include <BytecodeVM.h>
+#include <CFGLayout.h>
+#include <CodeGen.h>
+#include <CompileCache.h>
+#include <DLXSimulator.h>
+#include <ELFWriter.h>
+#include <FunctionCache.h>
 #include <GraphMLWriter.h>
+#include <GVN.h>
+#include <Interprocedural.h>
+#include <Interpreter.h>
+#include <JIT.h>
+#include <LoopUnroll.h>
+#include <PassManager.h>
+#include <Profile.h>
 #include <RegAlloc.h>
+#include <Server.h>
+#include <ServerProtocol.h>
 #include "Parser.h"
 #include "SSA.h"
+#include <cstring>
+#include <fstream>
+#include <iterator>
 
 std::string currFileName;
 
-int main(int argc, char* argv[])
+// {dir}{file}{extension}, with the same layout as graphml/
+static std::string getOutputFileName(std::string dir, std::string file, std::string extension)
+{
+	std::size_t testcaseDirIndex = file.find("testcases/");
+	if (testcaseDirIndex != std::string::npos)
+	{
+		file = file.substr(testcaseDirIndex + 10);
+	}
+	return dir + file.substr(0, file.find(".txt")) + extension;
+}
+
+// @return false if the file cannot be read
+static bool readFile(std::string fileName, std::string& contents)
+{
+	std::ifstream file(fileName, std::ios::binary);
+	if (!file)
+	{
+		return false;
+	}
+	contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	return true;
+}
+
+static bool isIRFile(std::string file)
 {
+	std::string extension = BinaryIR::EXTENSION;
+	return file.size() >= extension.size() && file.compare(file.size() - extension.size(), extension.size(), extension) == 0;
+}
+
+// the command line compiler
+static int compile(int argc, char* argv[])
+{
+	int unrollFactor = DEFAULT_UNROLL_FACTOR;
+	bool interpret = false;
+	bool runBytecode = false;
+	bool runJIT = false;
+	bool emitELF = false;
+	bool emitDLX = false;
+	bool simulate = false;
+	bool profile = false;
+	bool profileGenerate = false;
+	bool profileUse = false;
+	bool timePasses = false;
+	bool emitIR = false;
+	bool useCache = false;
+	std::string cacheDir = "cache/";
+	std::size_t cacheSize = DEFAULT_CACHE_SIZE;
+	std::string latencies = "";
+	std::string passes = "";
+	std::string dumps = "";
+	std::list<char*> files;
 	for (int i = 1; i < argc; ++i)
 	{
-		printf("compiling %s\n", argv[i]);
-		currFileName = std::string(argv[i]);
+		if (strncmp(argv[i], "--unroll=", 9) == 0)
+		{
+			unrollFactor = atoi(argv[i] + 9);
+		}
+		else if (strcmp(argv[i], "--interpret") == 0)
+		{
+			interpret = true;
+		}
+		else if (strcmp(argv[i], "--bytecode") == 0)
+		{
+			runBytecode = true;
+		}
+		else if (strcmp(argv[i], "--run") == 0)
+		{
+			runJIT = true;
+		}
+		else if (strcmp(argv[i], "--elf") == 0)
+		{
+			emitELF = true;
+		}
+		else if (strcmp(argv[i], "--dlx") == 0)
+		{
+			emitDLX = true;
+		}
+		else if (strcmp(argv[i], "--simulate") == 0)
+		{
+			simulate = true;
+		}
+		else if (strcmp(argv[i], "--profile") == 0)
+		{
+			simulate = true;
+			profile = true;
+		}
+		else if (strcmp(argv[i], "--profile-generate") == 0)
+		{
+			profileGenerate = true;
+		}
+		else if (strcmp(argv[i], "--profile-use") == 0)
+		{
+			profileUse = true;
+		}
+		else if (strncmp(argv[i], "--passes=", 9) == 0)
+		{
+			passes = argv[i] + 9;
+		}
+		else if (strncmp(argv[i], "--dump=", 7) == 0)
+		{
+			dumps = argv[i] + 7;
+		}
+		else if (strncmp(argv[i], "--dump-functions=", 17) == 0)
+		{
+			GraphML::setDumpFunctions(argv[i] + 17);
+		}
+		else if (strcmp(argv[i], "--emit-ir") == 0)
+		{
+			emitIR = true;
+		}
+		else if (strcmp(argv[i], "--cache") == 0)
+		{
+			useCache = true;
+		}
+		else if (strncmp(argv[i], "--cache-dir=", 12) == 0)
+		{
+			useCache = true;
+			cacheDir = argv[i] + 12;
+		}
+		else if (strncmp(argv[i], "--cache-size=", 13) == 0)
+		{
+			cacheSize = std::size_t(atol(argv[i] + 13)) << 20;
+		}
+		else if (strcmp(argv[i], "--time-passes") == 0)
+		{
+			timePasses = true;
+		}
+		else if (strncmp(argv[i], "--latency=", 10) == 0)
+		{
+			latencies = argv[i] + 10;
+		}
+		else
+		{
+			files.push_back(argv[i]);
+		}
+	}
+
+	if (!GraphML::setDumpPoints(dumps))
+	{
+		fprintf(stderr, "invalid dumps %s, available dumps are ssa-first, regalloc, igraph and all\n", dumps.c_str());
+		exit(1);
+	}
 
-		Parser parser(argv[i]);
-		SSA::Module* ssa = parser.parse();
-		GraphML::SSAtoGraphML(ssa, "SSA_first_pass/");
-		allocateRegisters(ssa);
-		GraphML::SSAtoGraphML(ssa, "SSA_reg_alloc/");
+	PassManager pm;
+	pm.registerPass("graphml-first-pass", [](SSA::Module* ir)
+	{
+		if (GraphML::isDumping(GraphML::DUMP_SSA_FIRST))
+		{
+			GraphML::SSAtoGraphML(ir, "SSA_first_pass/");
+		}
+	});
+	pm.registerPass("summarize", [](SSA::Module* ir) { summarizeFunctions(ir); });
+	pm.registerPass("unroll", [unrollFactor](SSA::Module* ir) { unrollLoops(ir, unrollFactor); });
+	pm.registerPass("hoist-calls", [](SSA::Module* ir) { hoistInvariantCalls(ir); });
+	pm.registerPass("gvn", [](SSA::Module* ir) { globalValueNumbering(ir); });
+	pm.registerPass("canonicalize-cfg", [](SSA::Module* ir) { canonicalizeCFG(ir); });
+	pm.registerPass("regalloc", [](SSA::Module* ir) { allocateRegisters(ir); });
+	pm.registerPass("graphml-reg-alloc", [](SSA::Module* ir)
+	{
+		if (GraphML::isDumping(GraphML::DUMP_REGALLOC))
+		{
+			GraphML::SSAtoGraphML(ir, "SSA_reg_alloc/");
+		}
+	});
+	pm.registerAnalysis("domtree", [](SSA::Module* ir)
+	{
+		for (SSA::Function* f : ir->getFuncs())
+		{
+			f->getAnalyses().getDominatorTree();
+		}
+	});
+	pm.registerAnalysis("loops", [](SSA::Module* ir)
+	{
+		for (SSA::Function* f : ir->getFuncs())
+		{
+			f->getAnalyses().getLoopForest();
+		}
+	});
+	if (!passes.empty() && !pm.setPipeline(passes))
+	{
+		fprintf(stderr, "invalid passes %s, available passes are\n%s", passes.c_str(), pm.passesToStr().c_str());
+		exit(1);
+	}
+	bool needsAllocation = runBytecode || runJIT || emitELF || emitDLX || simulate;
+	if (!pm.contains("regalloc") && needsAllocation)
+	{
+		for (char* file : files)
+		{
+			if (!isIRFile(file))
+			{
+				fprintf(stderr, "code generation needs the regalloc pass\n");
+				exit(1);
+			}
+		}
+	}
+
+	// dumps and recorded profiles come from running the pipeline, so they bypass the cache
+	CompileCache* cache = nullptr;
+	if (useCache && dumps.empty() && !profileGenerate)
+	{
+		cache = new CompileCache(cacheDir, cacheSize);
+	}
+	std::string cacheOptions = "passes=" + pm.pipelineToStr() + " unroll=" + std::to_string(unrollFactor);
+
+	for (char* file : files)
+	{
+		printf("compiling %s\n", file);
+		currFileName = std::string(file);
+
+		SSA::Module* ssa = nullptr;
+		bool allocated = pm.contains("regalloc");
+		if (isIRFile(file))
+		{
+			// already compiled, so the pipeline does not run again
+			pm.time("load-ir", ssa, [&]() { ssa = BinaryIR::load(file, allocated); });
+			if (!ssa)
+			{
+				fprintf(stderr, "cannot load %s\n", file);
+				exit(1);
+			}
+			if (!allocated && needsAllocation)
+			{
+				fprintf(stderr, "code generation needs the regalloc pass, %s was saved without it\n", file);
+				exit(1);
+			}
+		}
+		else
+		{
+			std::string cacheKey;
+			std::string options = cacheOptions;
+			if (cache)
+			{
+				std::string source;
+				std::string profileData;
+				if (profileUse && readFile(getOutputFileName("profile/", file, ".profile"), profileData))
+				{
+					options += " profile=" + profileData;
+				}
+				if (readFile(file, source))
+				{
+					cacheKey = CompileCache::key(options, source);
+					pm.time("cache-lookup", ssa, [&]() { ssa = cache->lookup(cacheKey, allocated); });
+				}
+			}
+			if (!ssa)
+			{
+				std::list<Parser::FunctionSource> sources;
+				pm.time("parse", ssa, [&]()
+				{
+					Parser parser(file);
+					ssa = parser.parse();
+					sources = parser.getFunctionSources();
+				});
+				if (profileGenerate)
+				{
+					recordProfile(ssa, getOutputFileName("profile/", file, ".profile"));
+				}
+				if (profileUse)
+				{
+					loadProfile(ssa, getOutputFileName("profile/", file, ".profile"));
+				}
+				// unchanged functions come back compiled, and the pipeline only sees the others
+				FunctionCache* functionCache = nullptr;
+				std::list<SSA::Function*> funcs = ssa->getFuncs();
+				if (!cacheKey.empty())
+				{
+					pm.time("function-cache-lookup", ssa, [&]()
+					{
+						// callers depend on the summaries of their callees, which
+						// reused functions cannot recompute from compiled bodies
+						if (pm.contains("summarize"))
+						{
+							summarizeFunctions(ssa);
+						}
+						functionCache = new FunctionCache(*cache, options, ssa, sources);
+						functionCache->reuse();
+					});
+					ssa->getFuncs().remove_if([&](SSA::Function* f) { return functionCache->isReused(f); });
+				}
+				pm.run(ssa);
+				ssa->getFuncs() = funcs;
+				if (!cacheKey.empty())
+				{
+					pm.time("cache-store", ssa, [&]()
+					{
+						cache->store(cacheKey, ssa, allocated);
+						functionCache->store();
+					});
+					delete functionCache;
+				}
+			}
+			if (emitIR)
+			{
+				pm.time("emit-ir", ssa, [&]()
+				{
+					writeFileAsync(getOutputFileName("ir/", file, BinaryIR::EXTENSION), BinaryIR::serialize(ssa, allocated));
+				});
+			}
+		}
+		if (emitELF)
+		{
+			pm.time("elf", ssa, [&]() { ELF::writeExecutable(ssa, getOutputFileName("bin/", file, "")); });
+		}
+		if (emitDLX || simulate)
+		{
+			CodeGen* codeGenPtr = nullptr;
+			pm.time("codegen", ssa, [&]() { codeGenPtr = new CodeGen(ssa); });
+			CodeGen& codeGen = *codeGenPtr;
+			if (emitDLX)
+			{
+				codeGen.write(getOutputFileName("dlx/", file, ".dlx"));
+				writeFileAsync(getOutputFileName("dlx/", file, ".asm"), codeGen.toStr());
+			}
+			if (simulate)
+			{
+				DLXSimulator simulator(codeGen.getProgram());
+				if (!simulator.setLatencies(latencies))
+				{
+					fprintf(stderr, "invalid latencies %s\n", latencies.c_str());
+					exit(1);
+				}
+				simulator.run();
+				fprintf(stderr, "%s", simulator.statsToStr().c_str());
+				if (profile)
+				{
+					fprintf(stderr, "%s", simulator.profileToStr(codeGen, 10).c_str());
+				}
+			}
+			delete codeGenPtr;
+		}
+		if (interpret)
+		{
+			Interpreter interpreter(ssa, allocated);
+			interpreter.run();
+			fprintf(stderr, "%s", interpreter.statsToStr().c_str());
+		}
+		if (runBytecode)
+		{
+			Bytecode bytecode(ssa);
+			BytecodeVM vm(bytecode);
+			vm.run();
+			fprintf(stderr, "bytecode instructions: %lu\n", vm.getInstructionCount());
+		}
+		if (runJIT)
+		{
+			JIT jit(ssa);
+			jit.run();
+		}
 		delete ssa;
-	}	
+	}
 
-	return 0;
+	if (timePasses)
+	{
+		fprintf(stderr, "%s", pm.statsToStr().c_str());
+	}
+	bool written = finishWrites();
+	if (cache)
+	{
+		cache->evict();
+		delete cache;
+	}
+	return written ? 0 : 1;
+}
+
+int main(int argc, char* argv[])
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "--server") == 0 || strncmp(argv[i], "--server=", 9) == 0)
+		{
+			if (argc != 2)
+			{
+				fprintf(stderr, "--server takes no other options, clients send theirs with every request\n");
+				exit(1);
+			}
+			std::string socketPath = argv[i][8] == '=' ? argv[i] + 9 : ServerProtocol::defaultSocketPath();
+			return runServer(socketPath, compile);
+		}
+	}
+	return compile(argc, argv);
 }
@@ -0,0 +1,78 @@
+#!/bin/bash
+#
+# backends.sh
+# Author: Joshua Cao
+#
+# backend check: runs every test program and the kernels in
+# benchmark/kernels/ on their fixed input, benchmark/inputs/<name>.in or no
+# input, with --interpret, --bytecode, --simulate, --run and as an --elf
+# executable, at each unroll factor, and compares the output of each with
+# that of --interpret. programs that fail or time out with --interpret,
+# eg. on division by zero, are skipped
+#
+# usage: testcases/backends.sh
+# the exit status is 1 if any backend printed something else or failed
+#
+# environment:
+# 	COMPILER	compiler to check (./compiler)
+# 	UNROLL		unroll factors to compile with (1 2 3 4)
+# 	TIMEOUT		seconds before a run is abandoned (10)
+#
+
+COMPILER=${COMPILER:-./compiler}
+UNROLL=${UNROLL:-1 2 3 4}
+TIMEOUT=${TIMEOUT:-10}
+PROGRAMS="testcases/public/*.txt testcases/custom/*.txt benchmark/kernels/*.txt"
+BACKENDS="--bytecode --simulate --run --elf"
+
+if [ ! -x "$COMPILER" ]; then
+	echo "$COMPILER not found, run make" >&2
+	exit 1
+fi
+
+# prints what the program writes with one backend, or "failed"
+run()
+{
+	local program=$1 input=$2 unroll=$3 backend=$4
+	local output
+	if [ "$backend" = --elf ]; then
+		# bin/ has the same layout as graphml/
+		local exe=${program#*testcases/}
+		exe=bin/${exe%.txt}
+		rm -f "$exe"
+		timeout "$TIMEOUT" $COMPILER --unroll="$unroll" --elf "$program" >/dev/null 2>&1 </dev/null || { echo failed; return; }
+		output=$(timeout "$TIMEOUT" "$exe" 2>/dev/null <"$input") || { echo failed; return; }
+	else
+		output=$(timeout "$TIMEOUT" $COMPILER --unroll="$unroll" $backend "$program" 2>/dev/null <"$input") \
+			|| { echo failed; return; }
+		output=$(echo "$output" | grep -v '^compiling ')
+	fi
+	echo "$output"
+}
+
+failures=0
+for program in $PROGRAMS; do
+	name=$(basename "$program" .txt)
+	input=/dev/null
+	[ -f "benchmark/inputs/$name.in" ] && input="benchmark/inputs/$name.in"
+	for unroll in $UNROLL; do
+		expected=$(run "$program" "$input" "$unroll" --interpret)
+		if [ "$expected" = failed ]; then
+			echo "$program --unroll=$unroll: skipped, --interpret failed"
+			continue
+		fi
+		for backend in $BACKENDS; do
+			actual=$(run "$program" "$input" "$unroll" $backend)
+			if [ "$actual" != "$expected" ]; then
+				echo "$program --unroll=$unroll $backend: differs from --interpret"
+				failures=$((failures + 1))
+			fi
+		done
+	done
+done
+
+if [ $failures -gt 0 ]; then
+	echo "$failures runs differ"
+	exit 1
+fi
+echo "all backends agree"